@@ -5,10 +5,12 @@
 #include <GBAdev_functions.h>
 #include <assert.h>
 #include <stdint.h>
+#include <string.h>
 #include "chess_board_state.h"
 #include "GBAdev_util_macros.h"
 #include "chess_ai_types.h"
 #include "chess_board.h"
+#include "chess_board_state_analysis.h"
 #include "chess_move_iterator.h"
 #include "chess_ai.h"
 #include "debug_io.h"
@@ -22,10 +24,26 @@ static const u32 CASTLE_FLAGS_CORRESPONDING_ROOK_RIDS[CASTLE_FLAG_COUNT] = {
   BLACK_ROSTER_ID(ROOK0)
 };
 
+#define PIECE_ZKEY(loc, piece)\
+  (BOARD_ZKEY_ENTS(zobrist_table)[BOARD_IDX(loc)]\
+                                 [ZID_FROM_BOARD_PIECE_DATA((u32)(piece))])
+/* Pawns' contribution to the pawn key, which is the low half of the same
+ * PIECE_ZKEY the full zobrist key uses. Every other piece's key is masked off
+ * to nothing. */
+#define PAWN_ZKEY(piece_zkey, piece)\
+  ((u32)(piece_zkey)&-(u32)(PAWN_IDX==(PIECE_IDX_MASK&(piece))))
+
 #define BOARD_STATE_COUNT 4U
 static IWRAM_BSS BoardState_t g_board_states[BOARD_STATE_COUNT]={0};
 static EWRAM_BSS BOOL g_board_state_occupied[BOARD_STATE_COUNT]={0};
 
+// Vertices saved off by BoardState_MakeMove for BoardState_UnmakeMove. Worst
+// case, every live piece gets its edges rebuilt on every ply.
+#define UNDO_VERTEX_STACK_SIZE (CHESS_TOTAL_PIECE_COUNT*MAX_SEARCH_PLY)
+static EWRAM_BSS PieceState_Graph_Vertex_t 
+                          g_undo_vertex_stack[UNDO_VERTEX_STACK_SIZE];
+static EWRAM_BSS u32 g_undo_vertex_stack_top = 0;
+
 static EWRAM_CODE BoardState_t *Graph_FromCtx(BoardState_t *board_state, 
                                            const ChessGameCtx_t *ctx);
 static EWRAM_CODE BOOL En_Passent_Possible(const ChessBoard_t board,
@@ -33,8 +51,23 @@ static EWRAM_CODE BOOL En_Passent_Possible(const ChessBoard_t board,
                                            ChessBoard_File_e ep_file);
 static EWRAM_CODE BoardState_t *BoardState_UpdateGraphEdges(
                                                     BoardState_t *board_state);
+static EWRAM_CODE void BoardState_UpdateVertexEdges(BoardState_t *board_state,
+                                                    u32 rid);
+static EWRAM_CODE BoardState_t *BoardState_UpdateGraphEdgesFromMove(
+                                  BoardState_t *board_state,
+                                  u32 moving_idx,
+                                  const ChessBoard_Idx_Compact_t *touched,
+                                  u32 touched_ct,
+                                  u8 prev_ep_file,
+                                  BoardState_Undo_t *undo);
+static EWRAM_CODE BoardState_t *BoardState_ApplyMoveInternal(
+                                       BoardState_t *board_state,
+                                       const ChessMove_t *move_data,
+                                       BoardState_Undo_t *undo);
 
 static EWRAM_CODE void BoardState_UpdateZobristKey(BoardState_t *board_state);
+static EWRAM_CODE void BoardState_UpdateBitboards(BoardState_t *board_state);
+static EWRAM_CODE void BoardState_UpdateEvalSums(BoardState_t *board_state);
 
 EWRAM_CODE BOOL En_Passent_Possible(const ChessBoard_t board, 
                                          u32 side_to_move,
@@ -108,6 +141,7 @@ EWRAM_CODE BoardState_t *BoardState_FromCtx(BoardState_t *board_state,
     return NULL;
 
   u64 zobrist_key=0;
+  u32 pawn_key=0;
   PGN_Move_t last_mv = {  /* Give last_mv invalid init state */
     .move = {
       {.raw=INVALID_IDX_RAW_VAL},
@@ -120,7 +154,7 @@ EWRAM_CODE BoardState_t *BoardState_FromCtx(BoardState_t *board_state,
   GameState_t *state = &board_state->state;
   const PGN_Round_LL_t *move_hist = &ctx->move_hist;
   const PGN_Round_t *round;
-  u8 castle_rights, castle_forfeitures;
+  u8 castle_rights, castle_forfeitures = 0;
   u8 whose_move;
   static_assert(0==(sizeof(ChessBoard_t)%sizeof(WORD)));
   Fast_Memcpy32(board_state->board,
@@ -269,20 +303,293 @@ EWRAM_CODE BoardState_t *BoardState_FromCtx(BoardState_t *board_state,
       zobrist_key^=BOARD_ZKEY_ENTS(zobrist_table)[row]
                                     [file]
                                     [ZID_FROM_BOARD_PIECE_DATA(curpiece)];
+      if (PAWN_IDX==(PIECE_IDX_MASK&curpiece))
+        pawn_key^=(u32)BOARD_ZKEY_ENTS(zobrist_table)[row]
+                                    [file]
+                                    [ZID_FROM_BOARD_PIECE_DATA(curpiece)];
     }
   }
   if (BLACK_TO_MOVE_FLAGBIT&whose_move)
     zobrist_key^=SIDE_TO_MOVE_ZKEY_ENT(zobrist_table);
   zobrist_key^=CASTLE_ZKEY_ENTS(zobrist_table)[castle_rights];
   zobrist_key^=CASTLE_FORFEITURE_ZKEY_ENTS(zobrist_table)[castle_forfeitures];
+  state->castle_rights_forfeiture = castle_forfeitures;
   if (En_Passent_Possible(ctx->board_data, whose_move, state->ep_file)) {
     zobrist_key^=EN_PASSENT_ZKEY_ENTS(zobrist_table)[state->ep_file];
   } else {
     state->ep_file = NO_VALID_EN_PASSENT_FILE;
   }
   board_state->zobrist = zobrist_key;
+  board_state->pawn_zobrist = pawn_key;
   
-  return Graph_FromCtx(board_state, ctx);
+  if (NULL==Graph_FromCtx(board_state, ctx))
+    return NULL;
+  BoardState_UpdateBitboards(board_state);
+  BoardState_UpdateEvalSums(board_state);
+  return board_state;
+}
+
+static EWRAM_CODE ChessPiece_e Fen_CharToPiece(char c) {
+  ChessPiece_e team = WHITE_FLAGBIT;
+  if ('a'<=c && 'z'>=c) {
+    team = BLACK_FLAGBIT;
+    c -= 'a'-'A';
+  }
+  switch (c) {
+  case 'P':
+    return team|PAWN_IDX;
+  case 'B':
+    return team|BISHOP_IDX;
+  case 'R':
+    return team|ROOK_IDX;
+  case 'N':
+    return team|KNIGHT_IDX;
+  case 'Q':
+    return team|QUEEN_IDX;
+  case 'K':
+    return team|KING_IDX;
+  default:
+    return EMPTY_IDX;
+  }
+}
+
+static EWRAM_CODE const char *Fen_ParseUInt(const char *fen, u32 *ret) {
+  u32 val = 0;
+  while (' '==*fen)
+    ++fen;
+  if ('0'>*fen || '9'<*fen)
+    return NULL;
+  while ('0'<=*fen && '9'>=*fen)
+    val = val*10 + (u32)(*fen++ - '0');
+  *ret = val;
+  return fen;
+}
+
+/* Claims a roster slot for the piece at (file, row). Back-row slots may only
+ * hold the piece type BOARD_BACK_ROWS_INIT says they start with (castle 
+ * validation relies on this), so anything that doesn't fit there, i.e.: 
+ * promoted pieces, lands in a free pawn slot, same as a promotion would. */
+static EWRAM_CODE BOOL Fen_AssignRosterId(BoardState_t *board_state,
+                                          ChessBoard_File_e file,
+                                          ChessBoard_Row_e row,
+                                          u32 preferred_id) {
+  const ChessPiece_e PIECE = board_state->board[row][file];
+  const u32 TEAM_OFS = (WHITE_FLAGBIT&PIECE)
+                            ? PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT
+                            : 0;
+  const ChessBoard_Idx_Compact_t LOC = {.coord={.x=file, .y=row}};
+  u32 rid = PIECE_GRAPH_EMPTY_HASHENT;
+  ChessPiece_Roster_t *roster = &board_state->graph.roster;
+  if (PIECE_GRAPH_EMPTY_HASHENT!=board_state->graph.vertex_hashmap[row][file])
+    return TRUE;
+  if (PIECE_GRAPH_EMPTY_HASHENT!=preferred_id
+      && !CHESS_ROSTER_PIECE_ALIVE((*roster), TEAM_OFS|preferred_id)) {
+    rid = preferred_id;
+  } else {
+    for (u32 i = 0; PAWN0>i; ++i) {
+      if (CHESS_ROSTER_PIECE_ALIVE((*roster), TEAM_OFS|i))
+        continue;
+      if (BOARD_BACK_ROWS_INIT[i]!=(PIECE&PIECE_IDX_MASK))
+        continue;
+      rid = i;
+      break;
+    }
+  }
+  if (PIECE_GRAPH_EMPTY_HASHENT==rid && KING_IDX!=(PIECE&PIECE_IDX_MASK)) {
+    for (u32 i = PAWN0; CHESS_TEAM_PIECE_COUNT>i; ++i) {
+      if (CHESS_ROSTER_PIECE_ALIVE((*roster), TEAM_OFS|i))
+        continue;
+      rid = i;
+      break;
+    }
+  }
+  if (PIECE_GRAPH_EMPTY_HASHENT==rid)
+    return FALSE;
+  rid |= TEAM_OFS;
+  roster->all |= 1U<<rid;
+  board_state->graph.vertex_hashmap[row][file] = rid;
+  board_state->graph.vertices[rid].location = LOC;
+  return TRUE;
+}
+
+EWRAM_CODE BoardState_t *BoardState_FromFEN(BoardState_t *board_state,
+                                            const char *fen) {
+  static const struct {
+    CastleRightsFlag_e flag;
+    ChessPiece_e king;
+    ChessBoard_Row_e row;
+    ChessBoard_File_e rook_file;
+    u32 rook_id;
+    // Where the king and rook end up after castling this way.
+    ChessBoard_File_e castled_king_file, castled_rook_file;
+  } CASTLE_REQS[CASTLE_FLAG_COUNT] = {
+    {WK, WHITE_KING, ROW_1, FILE_H, ROOK1, FILE_G, FILE_F},
+    {WQ, WHITE_KING, ROW_1, FILE_A, ROOK0, FILE_C, FILE_D},
+    {BK, BLACK_KING, ROW_8, FILE_H, ROOK1, FILE_G, FILE_F},
+    {BQ, BLACK_KING, ROW_8, FILE_A, ROOK0, FILE_C, FILE_D},
+  };
+  GameState_t *state;
+  u32 castle_rights = 0, halfmove = 0, fullmove = 1;
+  ChessBoard_File_e file = FILE_A;
+  ChessBoard_Row_e row = ROW_8;
+  ChessPiece_e piece;
+  if (NULL==board_state || NULL==fen)
+    return NULL;
+  static_assert(0==(sizeof(BoardState_t)%sizeof(WORD)));
+  Fast_Memset32(board_state, 0, sizeof(BoardState_t)/sizeof(WORD));
+  Fast_Memset32(board_state->graph.vertex_hashmap,
+                PIECE_GRAPH_HASHMAP_INITIALIZER_WORD,
+                sizeof(u8[CHESS_BOARD_ROW_COUNT][CHESS_BOARD_FILE_COUNT])
+                          / sizeof(WORD));
+  state = &board_state->state;
+  for (u32 r = 0; CHESS_BOARD_ROW_COUNT>r; ++r)
+    for (u32 f = 0; CHESS_BOARD_FILE_COUNT>f; ++f)
+      board_state->board[r][f] = EMPTY_IDX;
+
+  // 1. Piece placement
+  for (; ' '!=*fen; ++fen) {
+    if ('\0'==*fen)
+      return NULL;
+    if ('/'==*fen) {
+      if (CHESS_BOARD_FILE_COUNT!=file || ROW_1==row)
+        return NULL;
+      file = FILE_A;
+      ++row;
+    } else if ('1'<=*fen && '8'>=*fen) {
+      file += *fen - '0';
+      if (CHESS_BOARD_FILE_COUNT<file)
+        return NULL;
+    } else {
+      if (CHESS_BOARD_FILE_COUNT<=file 
+          || EMPTY_IDX==(piece = Fen_CharToPiece(*fen)))
+        return NULL;
+      if (PAWN_IDX==(PIECE_IDX_MASK&piece) && (ROW_8==row || ROW_1==row))
+        return NULL;
+      board_state->board[row][file++] = piece;
+    }
+  }
+  if (ROW_1!=row || CHESS_BOARD_FILE_COUNT!=file)
+    return NULL;
+  ++fen;
+
+  // 2. Side to move
+  if ('w'==*fen)
+    state->side_to_move = WHITE_TO_MOVE_FLAGBIT;
+  else if ('b'==*fen)
+    state->side_to_move = BLACK_TO_MOVE_FLAGBIT;
+  else
+    return NULL;
+  if (' '!=*++fen)
+    return NULL;
+  ++fen;
+
+  // 3. Castle rights
+  for (; ' '!=*fen && '\0'!=*fen; ++fen) {
+    switch (*fen) {
+    case 'K':
+      castle_rights|=WK;
+      break;
+    case 'Q':
+      castle_rights|=WQ;
+      break;
+    case 'k':
+      castle_rights|=BK;
+      break;
+    case 'q':
+      castle_rights|=BQ;
+      break;
+    case '-':
+      break;
+    default:
+      return NULL;
+    }
+  }
+  // 4. En passent target square. Only the file is tracked, and only if the
+  // side to move actually has a pawn to take it with.
+  state->ep_file = NO_VALID_EN_PASSENT_FILE;
+  while (' '==*fen)
+    ++fen;
+  if ('-'==*fen) {
+    ++fen;
+  } else if ('a'<=*fen && 'h'>=*fen) {
+    state->ep_file = *fen++ - 'a';
+    if ('3'!=*fen && '6'!=*fen)
+      return NULL;
+    ++fen;
+  } else if ('\0'!=*fen) {
+    return NULL;
+  }
+  // 5. Clocks. Both are optional in practice, so tolerate their absence.
+  if ('\0'!=*fen) {
+    const char *next = Fen_ParseUInt(fen, &halfmove);
+    if (NULL!=next) {
+      fen = next;
+      if (NULL==Fen_ParseUInt(fen, &fullmove))
+        fullmove = 1;
+    }
+  }
+  state->halfmove_clock = MIN(halfmove, 0xFFU);
+  state->fullmove_number = MAX(fullmove, 1U);
+
+  // 6. Roster assignment. Kings and castle-eligible rooks get their home slots
+  // first, then pawns take the slot matching their file when it's free.
+  for (row = ROW_8; CHESS_BOARD_ROW_COUNT>row; ++row)
+    for (file = FILE_A; CHESS_BOARD_FILE_COUNT>file; ++file)
+      if (KING_IDX==(PIECE_IDX_MASK&board_state->board[row][file])
+          && !Fen_AssignRosterId(board_state, file, row, KING))
+        return NULL;
+  if (!CHESS_ROSTER_PIECE_ALIVE(board_state->graph.roster, 
+                                WHITE_ROSTER_ID(KING))
+      || !CHESS_ROSTER_PIECE_ALIVE(board_state->graph.roster,
+                                   BLACK_ROSTER_ID(KING)))
+    return NULL;
+  for (u32 i = 0; CASTLE_FLAG_COUNT>i; ++i) {
+    const ChessPiece_e ROOK = (CASTLE_REQS[i].king&PIECE_TEAM_MASK)|ROOK_IDX;
+    if (!(castle_rights&CASTLE_REQS[i].flag))
+      continue;
+    if (CASTLE_REQS[i].king!=board_state->board[CASTLE_REQS[i].row][FILE_E]
+        || ROOK!=board_state->board[CASTLE_REQS[i].row]
+                                   [CASTLE_REQS[i].rook_file]) {
+      castle_rights &= ~CASTLE_REQS[i].flag;
+      continue;
+    }
+    Fen_AssignRosterId(board_state, CASTLE_REQS[i].rook_file,
+                       CASTLE_REQS[i].row, CASTLE_REQS[i].rook_id);
+  }
+  for (row = ROW_8; CHESS_BOARD_ROW_COUNT>row; ++row)
+    for (file = FILE_A; CHESS_BOARD_FILE_COUNT>file; ++file)
+      if (PAWN_IDX==(PIECE_IDX_MASK&board_state->board[row][file])
+          && !Fen_AssignRosterId(board_state, file, row, PAWN0+file))
+        return NULL;
+  for (row = ROW_8; CHESS_BOARD_ROW_COUNT>row; ++row)
+    for (file = FILE_A; CHESS_BOARD_FILE_COUNT>file; ++file)
+      if (EMPTY_IDX!=board_state->board[row][file]
+          && !Fen_AssignRosterId(board_state, file, row,
+                                 PIECE_GRAPH_EMPTY_HASHENT))
+        return NULL;
+
+  // Rights absent from the FEN are forfeited, unless the king and rook are
+  // sitting exactly where castling that way would have left them, in which
+  // case it's taken as used.
+  state->castle_rights = castle_rights;
+  for (u32 i = 0; CASTLE_FLAG_COUNT>i; ++i) {
+    const ChessPiece_e ROOK = (CASTLE_REQS[i].king&PIECE_TEAM_MASK)|ROOK_IDX;
+    if (castle_rights&CASTLE_REQS[i].flag)
+      continue;
+    if (CASTLE_REQS[i].king!=board_state->board[CASTLE_REQS[i].row]
+                                          [CASTLE_REQS[i].castled_king_file]
+        || ROOK!=board_state->board[CASTLE_REQS[i].row]
+                                   [CASTLE_REQS[i].castled_rook_file])
+      state->castle_rights_forfeiture |= CASTLE_REQS[i].flag;
+  }
+  if (!En_Passent_Possible(board_state->board,
+                           state->side_to_move,
+                           state->ep_file))
+    state->ep_file = NO_VALID_EN_PASSENT_FILE;
+  BoardState_UpdateZobristKey(board_state);
+  BoardState_UpdateBitboards(board_state);
+  BoardState_UpdateEvalSums(board_state);
+  return BoardState_UpdateGraphEdges(board_state);
 }
 
 EWRAM_CODE BoardState_t *Graph_FromCtx(BoardState_t *board_state, 
@@ -385,26 +692,183 @@ EWRAM_CODE BoardState_t *Graph_FromCtx(BoardState_t *board_state,
 EWRAM_CODE BoardState_t *BoardState_ApplyMove(BoardState_t *board_state,
                                        const ChessMoveIteration_t *move_data,
                                        ChessBoard_Idx_Compact_t start_pos) {
+  const ChessMove_t MOVE = {
+    .start = start_pos,
+    .dst = BOARD_IDX_CONVERT(move_data->dst, COMPACT_IDX_TYPE),
+    .flags = move_data->special_flags,
+    .promotion = move_data->promotion_flag,
+  };
+  return BoardState_ApplyMoveInternal(board_state, &MOVE, NULL);
+}
+
+EWRAM_CODE BoardState_t *BoardState_MakeMove(BoardState_t *board_state,
+                                       const ChessMove_t *move,
+                                       BoardState_Undo_t *undo) {
+  assert(NULL!=undo);
+  return BoardState_ApplyMoveInternal(board_state, move, undo);
+}
+
+EWRAM_CODE BoardState_t *BoardState_UnmakeMove(BoardState_t *board_state,
+                                               const BoardState_Undo_t *undo) {
+  ChessBoard_t *const board = &board_state->board;
+  u8 (*const vmap)[CHESS_BOARD_FILE_COUNT] = board_state->graph.vertex_hashmap;
+  const u32 MOVING_IDX = vmap[BOARD_IDX(undo->dst)];
+  u32 stack_idx = undo->vertex_stack_base;
+  assert(PIECE_GRAPH_EMPTY_HASHENT!=MOVING_IDX);
+
+  // Restore rebuilt vertices first. These were saved after the move had
+  // already relocated the mover (and castling rook), so their locations are
+  // put back separately below.
+  for (u32 saved = undo->saved_vertices; saved; saved&=saved-1)
+    board_state->graph.vertices[__builtin_ctz(saved)]
+                                    = g_undo_vertex_stack[stack_idx++];
+  assert(g_undo_vertex_stack_top==stack_idx);
+  g_undo_vertex_stack_top = undo->vertex_stack_base;
+
+  board_state->graph.vertices[MOVING_IDX].location = undo->start;
+  Bitboard_TogglePiece(&board_state->bb,
+                       BB_SQ_FROM_COMPACT(undo->dst),
+                       (*board)[BOARD_IDX(undo->dst)]);
+  Bitboard_TogglePiece(&board_state->bb,
+                       BB_SQ_FROM_COMPACT(undo->start),
+                       undo->moving_piece);
+  (*board)[BOARD_IDX(undo->start)] = undo->moving_piece;
+  vmap[BOARD_IDX(undo->start)] = MOVING_IDX;
+  (*board)[BOARD_IDX(undo->dst)] = EMPTY_IDX;
+  vmap[BOARD_IDX(undo->dst)] = PIECE_GRAPH_EMPTY_HASHENT;
+  if (MOVE_CAPTURE&undo->flags) {
+    ChessBoard_Idx_Compact_t capt_loc = undo->dst;
+    if (MOVE_EN_PASSENT&undo->flags)
+      capt_loc.coord.y = undo->start.coord.y;
+    (*board)[BOARD_IDX(capt_loc)] = undo->captured_piece;
+    Bitboard_TogglePiece(&board_state->bb,
+                         BB_SQ_FROM_COMPACT(capt_loc),
+                         undo->captured_piece);
+    vmap[BOARD_IDX(capt_loc)] = undo->captured_idx;
+    assert(!CHESS_ROSTER_PIECE_ALIVE(board_state->graph.roster,
+                                     undo->captured_idx));
+    board_state->graph.roster.all |= 1U<<undo->captured_idx;
+  } else if (MOVE_CASTLE_MOVE_FLAGS_MASK&undo->flags) {
+    ChessBoard_Idx_Compact_t rook_start = undo->start, rook_end = undo->start;
+    if (MOVE_CASTLE_QUEENSIDE&undo->flags) {
+      rook_start.coord.x = FILE_A;
+      rook_end.coord.x = FILE_D;
+    } else {
+      rook_start.coord.x = FILE_H;
+      rook_end.coord.x = FILE_F;
+    }
+    board_state->graph.vertices[vmap[BOARD_IDX(rook_end)]].location
+                                                                = rook_start;
+    Bitboard_TogglePiece(&board_state->bb,
+                         BB_SQ_FROM_COMPACT(rook_start),
+                         (*board)[BOARD_IDX(rook_end)]);
+    Bitboard_TogglePiece(&board_state->bb,
+                         BB_SQ_FROM_COMPACT(rook_end),
+                         (*board)[BOARD_IDX(rook_end)]);
+    (*board)[BOARD_IDX(rook_start)] = (*board)[BOARD_IDX(rook_end)];
+    vmap[BOARD_IDX(rook_start)] = vmap[BOARD_IDX(rook_end)];
+    (*board)[BOARD_IDX(rook_end)] = EMPTY_IDX;
+    vmap[BOARD_IDX(rook_end)] = PIECE_GRAPH_EMPTY_HASHENT;
+  }
+  board_state->state = undo->state;
+  board_state->zobrist = undo->zobrist;
+  board_state->pawn_zobrist = undo->pawn_zobrist;
+  board_state->eval = undo->eval;
+  return board_state;
+}
+
+EWRAM_CODE BoardState_t *BoardState_MakeNullMove(BoardState_t *board_state,
+                                                 BoardState_Undo_t *undo) {
+  const u8 EP_FILE = board_state->state.ep_file;
+  u64 zobrist_key = board_state->zobrist;
+  assert(NULL!=undo);
+  undo->zobrist = zobrist_key;
+  undo->state = board_state->state;
+  // Passing forfeits any en passent capture, same as any other move would.
+  if (EN_PASSENT_POSSIBLE(EP_FILE))
+    zobrist_key ^= EN_PASSENT_ZKEY_ENTS(zobrist_table)[EP_FILE];
+  board_state->state.ep_file = NO_VALID_EN_PASSENT_FILE;
+  // A pass never happens in a real game, so a line through one can't really
+  // repeat anything from before it. Treating it as irreversible keeps
+  // repetition checks from looking back past it.
+  board_state->state.halfmove_clock = 0;
+  board_state->state.side_to_move ^= SIDE_TO_MOVE_MASK;
+  zobrist_key ^= SIDE_TO_MOVE_ZKEY_ENT(zobrist_table);
+  board_state->zobrist = zobrist_key;
+  return board_state;
+}
+
+EWRAM_CODE BoardState_t *BoardState_UnmakeNullMove(
+                                               BoardState_t *board_state,
+                                               const BoardState_Undo_t *undo) {
+  board_state->state = undo->state;
+  board_state->zobrist = undo->zobrist;
+  return board_state;
+}
+
+EWRAM_CODE BoardState_t *BoardState_ApplyMoveInternal(
+                                       BoardState_t *board_state,
+                                       const ChessMove_t *move_data,
+                                       BoardState_Undo_t *undo) {
   // Update graph.hashmap[move[0]] = PIECE_GRAPH_EMPTY_HASHENT
   // Update graph.hashmap[move[1]] = moving_idx
   // Update graph.vertices[moving_idx].location = move[1], but only after
   // lazy deleting of captured piece if there is one at move[1]
   const ChessBoard_Idx_t move[2] = {
-    BOARD_IDX_CONVERT(start_pos, NORMAL_IDX_TYPE),
-    move_data->dst,
+    BOARD_IDX_CONVERT(move_data->start, NORMAL_IDX_TYPE),
+    BOARD_IDX_CONVERT(move_data->dst, NORMAL_IDX_TYPE),
   };
+  const ChessBoard_Idx_Compact_t start_pos = move_data->start;
   u32 moving_idx = board_state->graph.vertex_hashmap[BOARD_IDX(move[0])];
   ChessPiece_e moving_piece = board_state->board[BOARD_IDX(move[0])],
                moving_side, moving_piece_type;
-  Move_Validation_Flag_e flags = move_data->special_flags;
+  Move_Validation_Flag_e flags = move_data->flags;
+  // Squares whose contents change. At most: from, to, and either the en 
+  // passent capture square or the castling rook's start and end squares.
+  ChessBoard_Idx_Compact_t touched[4] = {
+    start_pos,
+    move_data->dst,
+  };
+  u32 touched_ct = 2;
+  const u8 PREV_EP_FILE = board_state->state.ep_file,
+           PREV_CASTLE_RIGHTS = board_state->state.castle_rights,
+           PREV_FORFEITURES = board_state->state.castle_rights_forfeiture;
+  u64 zobrist_key = board_state->zobrist;
+  u64 piece_zkey;
+  u32 pawn_key = board_state->pawn_zobrist;
   moving_side = moving_piece&PIECE_TEAM_MASK;
   moving_piece_type = moving_piece&PIECE_IDX_MASK;
 
   assert((moving_piece_type|moving_side)==moving_piece);
   assert(moving_side&moving_piece);
+  if (NULL!=undo) {
+    *undo = (BoardState_Undo_t) {
+      .zobrist = zobrist_key,
+      .pawn_zobrist = pawn_key,
+      .eval = board_state->eval,
+      .saved_vertices = 0,
+      .vertex_stack_base = g_undo_vertex_stack_top,
+      .flags = flags,
+      .moving_piece = moving_piece,
+      .captured_piece = EMPTY_IDX,
+      .start = start_pos,
+      .dst = touched[1],
+      .captured_idx = PIECE_GRAPH_EMPTY_HASHENT,
+    };
+    // Plain assignment so GameState_t's padding comes along too, and the
+    // unmade state compares equal byte for byte.
+    undo->state = board_state->state;
+  }
   board_state->graph.vertex_hashmap[BOARD_IDX(move[0])]
     = PIECE_GRAPH_EMPTY_HASHENT;
   assert (PIECE_GRAPH_EMPTY_HASHENT != moving_idx);
+  piece_zkey = PIECE_ZKEY(move[0], moving_piece);
+  zobrist_key ^= piece_zkey;
+  pawn_key ^= PAWN_ZKEY(piece_zkey, moving_piece);
+  Bitboard_TogglePiece(&board_state->bb, BB_SQ_FROM_IDX(move[0]), moving_piece);
+  EvalSums_RemovePiece(&board_state->eval,
+                       BB_SQ_FROM_IDX(move[0]),
+                       moving_piece);
   if (MOVE_CAPTURE&flags) {
     ChessBoard_Idx_t capt_loc = move[1];
     u32 captured_idx;
@@ -422,6 +886,7 @@ EWRAM_CODE BoardState_t *BoardState_ApplyMove(BoardState_t *board_state,
     if (MOVE_EN_PASSENT&flags) {
       *captured_vertex_hashent = PIECE_GRAPH_EMPTY_HASHENT;
       assert(((moving_side^PIECE_TEAM_MASK)|PAWN_IDX)==captured_piece);
+      touched[touched_ct++] = BOARD_IDX_CONVERT(capt_loc, COMPACT_IDX_TYPE);
     }
     assert(PIECE_GRAPH_EMPTY_HASHENT!=captured_idx);
     
@@ -431,6 +896,19 @@ EWRAM_CODE BoardState_t *BoardState_ApplyMove(BoardState_t *board_state,
     // Lazy deletion therefore dont bother with clearing anything in 
     // captured vertex
     board_state->board[BOARD_IDX(capt_loc)] = EMPTY_IDX;
+    piece_zkey = PIECE_ZKEY(capt_loc, captured_piece);
+    zobrist_key ^= piece_zkey;
+    pawn_key ^= PAWN_ZKEY(piece_zkey, captured_piece);
+    Bitboard_TogglePiece(&board_state->bb,
+                         BB_SQ_FROM_IDX(capt_loc),
+                         captured_piece);
+    EvalSums_RemovePiece(&board_state->eval,
+                         BB_SQ_FROM_IDX(capt_loc),
+                         captured_piece);
+    if (NULL!=undo) {
+      undo->captured_piece = captured_piece;
+      undo->captured_idx = captured_idx;
+    }
   } else if (MOVE_CASTLE_MOVE_FLAGS_MASK&flags) {
     // Update graph.hashmap[rook_start_loc] = PIECE_GRAPH_EMPTY_HASHENT
     // Update graph.hashmap[rook_end_loc] = rook_idx
@@ -480,17 +958,38 @@ EWRAM_CODE BoardState_t *BoardState_ApplyMove(BoardState_t *board_state,
                     ==EMPTY_IDX);
     board_state->board[BOARD_IDX(rook_end)] = rook_piece;
     board_state->board[BOARD_IDX(rook_start)] = EMPTY_IDX;
+    touched[touched_ct++] = rook_start;
+    touched[touched_ct++] = rook_end;
+    zobrist_key ^= PIECE_ZKEY(rook_start, rook_piece)
+                 ^ PIECE_ZKEY(rook_end, rook_piece);
+    Bitboard_TogglePiece(&board_state->bb,
+                         BB_SQ_FROM_COMPACT(rook_start),
+                         rook_piece);
+    Bitboard_TogglePiece(&board_state->bb,
+                         BB_SQ_FROM_COMPACT(rook_end),
+                         rook_piece);
+    EvalSums_RemovePiece(&board_state->eval,
+                         BB_SQ_FROM_COMPACT(rook_start),
+                         rook_piece);
+    EvalSums_AddPiece(&board_state->eval,
+                      BB_SQ_FROM_COMPACT(rook_end),
+                      rook_piece);
     
   }
   // Now that captured piece is taken care of, we can update hashmap[move[1]]
   // safely.
   board_state->graph.vertex_hashmap[BOARD_IDX(move[1])] = moving_idx;
-  if (0!=move_data->promotion_flag) {
+  if (0!=move_data->promotion) {
     assert(PAWN_IDX==moving_piece_type);
-    moving_piece = moving_side|move_data->promotion_flag;
+    moving_piece = moving_side|move_data->promotion;
   }
 
   board_state->board[BOARD_IDX(move[1])] = moving_piece;
+  piece_zkey = PIECE_ZKEY(move[1], moving_piece);
+  zobrist_key ^= piece_zkey;
+  pawn_key ^= PAWN_ZKEY(piece_zkey, moving_piece);
+  Bitboard_TogglePiece(&board_state->bb, BB_SQ_FROM_IDX(move[1]), moving_piece);
+  EvalSums_AddPiece(&board_state->eval, BB_SQ_FROM_IDX(move[1]), moving_piece);
   ensure(board_state->graph.vertices[moving_idx].location.raw==start_pos.raw,
     "state graph says location of vertex = "
     "{.raw=\x1b[0x44E4]0x%02hhX\x1b[0x1484]}.\nMove idxs are:\n\t"
@@ -573,14 +1072,91 @@ EWRAM_CODE BoardState_t *BoardState_ApplyMove(BoardState_t *board_state,
   else
     ++board_state->state.halfmove_clock;
   board_state->state.side_to_move ^= SIDE_TO_MOVE_MASK;
+
+  // ep_file is only ever left set when the capture is actually available, so
+  // it can be keyed directly without re-validating it.
+  zobrist_key ^= SIDE_TO_MOVE_ZKEY_ENT(zobrist_table);
+  zobrist_key ^= CASTLE_ZKEY_ENTS(zobrist_table)[PREV_CASTLE_RIGHTS]
+               ^ CASTLE_ZKEY_ENTS(zobrist_table)
+                                         [board_state->state.castle_rights];
+  zobrist_key ^= CASTLE_FORFEITURE_ZKEY_ENTS(zobrist_table)
+                                         [PREV_FORFEITURES]
+               ^ CASTLE_FORFEITURE_ZKEY_ENTS(zobrist_table)
+                                [board_state->state.castle_rights_forfeiture];
+  if (NO_VALID_EN_PASSENT_FILE!=PREV_EP_FILE)
+    zobrist_key ^= EN_PASSENT_ZKEY_ENTS(zobrist_table)[PREV_EP_FILE];
+  if (NO_VALID_EN_PASSENT_FILE!=board_state->state.ep_file)
+    zobrist_key ^= EN_PASSENT_ZKEY_ENTS(zobrist_table)
+                                         [board_state->state.ep_file];
+  board_state->zobrist = zobrist_key;
+  board_state->pawn_zobrist = pawn_key;
+#ifdef _DEBUG_BUILD_
   BoardState_UpdateZobristKey(board_state);
+  ensure(zobrist_key==board_state->zobrist,
+      "Incremental key = \x1b[0x44E4]0x%016llX\x1b[0x1484], "
+      "full recompute = \x1b[0x44E4]0x%016llX\x1b[0x1484]",
+      zobrist_key, board_state->zobrist);
+  ensure(pawn_key==board_state->pawn_zobrist,
+      "Incremental pawn key = \x1b[0x44E4]0x%08lX\x1b[0x1484], "
+      "full recompute = \x1b[0x44E4]0x%08lX\x1b[0x1484]",
+      pawn_key, board_state->pawn_zobrist);
+  {
+    const BoardState_Bitboards_t INCREMENTAL = board_state->bb;
+    BoardState_UpdateBitboards(board_state);
+    ensure(!memcmp(&INCREMENTAL, &board_state->bb, sizeof(INCREMENTAL)),
+        "Incrementally updated bitboards diverged from board after move "
+        "to {.raw=\x1b[0x44E4]0x%016llX\x1b[0x1484]}", move[1].raw);
+  }
+  {
+    const BoardState_EvalSums_t INCREMENTAL = board_state->eval;
+    BoardState_UpdateEvalSums(board_state);
+    ensure(INCREMENTAL.mg==board_state->eval.mg
+            && INCREMENTAL.eg==board_state->eval.eg
+            && INCREMENTAL.phase==board_state->eval.phase,
+        "Incremental eval sums = {\x1b[0x44E4]%hd, %hd, %hu\x1b[0x1484]}, "
+        "full recompute = {\x1b[0x44E4]%hd, %hd, %hu\x1b[0x1484]}",
+        INCREMENTAL.mg, INCREMENTAL.eg, INCREMENTAL.phase,
+        board_state->eval.mg, board_state->eval.eg, board_state->eval.phase);
+  }
+#endif
 
-  return BoardState_UpdateGraphEdges(board_state);
-  
+  return BoardState_UpdateGraphEdgesFromMove(board_state,
+                                             moving_idx,
+                                             touched,
+                                             touched_ct,
+                                             PREV_EP_FILE,
+                                             undo);
+}
+
+EWRAM_CODE void BoardState_UpdateBitboards(BoardState_t *board_state) {
+  BoardState_Bitboards_t *const bbs = &board_state->bb;
+  *bbs = (BoardState_Bitboards_t){0};
+  for (u32 curpiece, file, row=ROW_8; CHESS_BOARD_ROW_COUNT>row; ++row) {
+    for (file=FILE_A; CHESS_BOARD_FILE_COUNT>file; ++file) {
+      curpiece = board_state->board[row][file];
+      if (EMPTY_IDX==curpiece)
+        continue;
+      Bitboard_TogglePiece(bbs, BB_SQ(file, row), curpiece);
+    }
+  }
+}
+
+EWRAM_CODE void BoardState_UpdateEvalSums(BoardState_t *board_state) {
+  BoardState_EvalSums_t *const sums = &board_state->eval;
+  *sums = (BoardState_EvalSums_t){0};
+  for (u32 curpiece, file, row=ROW_8; CHESS_BOARD_ROW_COUNT>row; ++row) {
+    for (file=FILE_A; CHESS_BOARD_FILE_COUNT>file; ++file) {
+      curpiece = board_state->board[row][file];
+      if (EMPTY_IDX==curpiece)
+        continue;
+      EvalSums_AddPiece(sums, BB_SQ(file, row), curpiece);
+    }
+  }
 }
 
 EWRAM_CODE void BoardState_UpdateZobristKey(BoardState_t *board_state) {
   u64 zobrist_key = 0ULL;
+  u32 pawn_key = 0U;
   u32 whose_move =board_state->state.side_to_move,
       castle_rights = board_state->state.castle_rights,
       castle_forfeitures = board_state->state.castle_rights_forfeiture,
@@ -596,6 +1172,10 @@ EWRAM_CODE void BoardState_UpdateZobristKey(BoardState_t *board_state) {
       zobrist_key^=BOARD_ZKEY_ENTS(zobrist_table)[row]
                                     [file]
                                     [ZID_FROM_BOARD_PIECE_DATA(curpiece)];
+      if (PAWN_IDX==(PIECE_IDX_MASK&curpiece))
+        pawn_key^=(u32)BOARD_ZKEY_ENTS(zobrist_table)[row]
+                                    [file]
+                                    [ZID_FROM_BOARD_PIECE_DATA(curpiece)];
     }
   }
   if (BLACK_TO_MOVE_FLAGBIT&whose_move)
@@ -605,74 +1185,177 @@ EWRAM_CODE void BoardState_UpdateZobristKey(BoardState_t *board_state) {
     zobrist_key^=EN_PASSENT_ZKEY_ENTS(zobrist_table)[ep_file];
   zobrist_key ^= CASTLE_FORFEITURE_ZKEY_ENTS(zobrist_table)[castle_forfeitures];
   board_state->zobrist = zobrist_key;
+  board_state->pawn_zobrist = pawn_key;
 }
 
 
-EWRAM_CODE BoardState_t *BoardState_UpdateGraphEdges(
-                                                   BoardState_t *board_state) {
+EWRAM_CODE void BoardState_UpdateVertexEdges(BoardState_t *board_state,
+                                             u32 rid) {
   ChessMoveIteration_t mv_iter;
   ChessBoard_Idx_t cur_loc;
   ChessMoveIterator_t iterator;
-  PieceState_Graph_Vertex_t *vertices = board_state->graph.vertices;
+  PieceState_Graph_Vertex_t *vertex = &board_state->graph.vertices[rid];
   const u8 
     (*const vmap)[CHESS_BOARD_FILE_COUNT] = board_state->graph.vertex_hashmap;
   const ChessBoard_Row_t *board = board_state->board;
   PieceAdjacencyFields_t cur_adjbits;
-  u32 hit_idx;
-  const ChessPiece_Roster_t roster = board_state->graph.roster;
+  u32 hit_idx, white_cardinality, black_cardinality;
   ChessPiece_e curpiece;
   ChessBoard_Idx_Compact_t hit_loc;
-  for (u32 white_cardinality, black_cardinality, total, i = 0;
-       CHESS_TOTAL_PIECE_COUNT>i; 
-       ++i) {
+  assert(CHESS_ROSTER_PIECE_ALIVE(board_state->graph.roster, rid));
+  cur_loc = BOARD_IDX_CONVERT(vertex->location, NORMAL_IDX_TYPE);
+  assert(vmap[BOARD_IDX(cur_loc)]==rid);
+  curpiece = board[BOARD_IDX(cur_loc)];
+  assert(EMPTY_IDX!=curpiece);
+  assert(ChessMoveIterator_Alloc(&iterator,
+                                 cur_loc,
+                                 board_state,
+                                 MV_ITER_MOVESET_COLLISIONS_ONLY_SET));
+  cur_adjbits.all = 0;
+  while (ChessMoveIterator_HasNext(&iterator)) {
+    assert(ChessMoveIterator_Next(&iterator, &mv_iter));
+    if (MOVE_EN_PASSENT&mv_iter.special_flags) {
+      const ChessBoard_Idx_Compact_t EP_LOC = {
+        .coord = {
+          .x=board_state->state.ep_file,
+          .y=cur_loc.coord.y
+        }
+      };
+      ChessPiece_e cappiece = board[BOARD_IDX(EP_LOC)];
+      assert(EMPTY_IDX==board[BOARD_IDX(mv_iter.dst)]);
+      assert((cappiece^PIECE_TEAM_MASK)==curpiece);
+      hit_loc = EP_LOC;
+    } else {
+      assert(EMPTY_IDX!=board[BOARD_IDX(mv_iter.dst)]);
+      hit_loc = BOARD_IDX_CONVERT(mv_iter.dst, COMPACT_IDX_TYPE);
+    }
+    hit_idx = vmap[BOARD_IDX(hit_loc)];
+    assert(PIECE_GRAPH_EMPTY_HASHENT!=hit_idx);
+    assert(hit_loc.raw==board_state->graph.vertices[hit_idx].location.raw);
+    assert(CHESS_ROSTER_PIECE_ALIVE(board_state->graph.roster, hit_idx));
+    cur_adjbits.all|=(1<<hit_idx);
+  }
+  ChessMoveIterator_Dealloc(&iterator);
+  white_cardinality = __builtin_popcount(cur_adjbits.team_invariant.white);
+  black_cardinality = __builtin_popcount(cur_adjbits.team_invariant.black);
+  vertex->total_edge_count = white_cardinality+black_cardinality;
+  vertex->edges = cur_adjbits;
+  if (rid&PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT) {
+    vertex->attacking_count = black_cardinality;
+    vertex->defending_count = white_cardinality;
+  } else {
+    vertex->attacking_count = white_cardinality;
+    vertex->defending_count = black_cardinality;
+  }
+}
+
+EWRAM_CODE BoardState_t *BoardState_UpdateGraphEdges(
+                                                   BoardState_t *board_state) {
+  const ChessPiece_Roster_t roster = board_state->graph.roster;
+  for (u32 i = 0; CHESS_TOTAL_PIECE_COUNT>i; ++i) {
     if (!CHESS_ROSTER_PIECE_ALIVE(roster, i))
       continue;
-    cur_loc = BOARD_IDX_CONVERT(vertices[i].location, NORMAL_IDX_TYPE);
-    assert(vmap[BOARD_IDX(cur_loc)]==i);
-    curpiece = board[BOARD_IDX(cur_loc)];
-    assert(EMPTY_IDX!=curpiece);
-    assert(ChessMoveIterator_Alloc(&iterator,
-                                   cur_loc,
-                                   board_state,
-                                   MV_ITER_MOVESET_COLLISIONS_ONLY_SET));
-    cur_adjbits.all = 0;
-    while (ChessMoveIterator_HasNext(&iterator)) {
-      assert(ChessMoveIterator_Next(&iterator, &mv_iter));
-      if (MOVE_EN_PASSENT&mv_iter.special_flags) {
-        const ChessBoard_Idx_Compact_t EP_LOC = {
-          .coord = {
-            .x=board_state->state.ep_file,
-            .y=cur_loc.coord.y
-          }
-        };
-        ChessPiece_e cappiece = board[BOARD_IDX(EP_LOC)];
-        assert(EMPTY_IDX==board[BOARD_IDX(mv_iter.dst)]);
-        assert((cappiece^PIECE_TEAM_MASK)==curpiece);
-        hit_loc = EP_LOC;
-      } else {
-        assert(EMPTY_IDX!=board[BOARD_IDX(mv_iter.dst)]);
-        hit_loc = BOARD_IDX_CONVERT(mv_iter.dst, COMPACT_IDX_TYPE);
+    BoardState_UpdateVertexEdges(board_state, i);
+  }
+  return board_state;
+}
+
+/* Collision sets only change for pieces that can see a square whose contents
+ * changed. Every square on a piece's rays up to its first blocker is part of
+ * what determines its edges, so if a touched square is in a piece's line of
+ * fire on the post-move board, that piece gets its edges rebuilt. If a touched
+ * square got hidden by the move, whatever hid it is itself touched and closer,
+ * so it still gets caught. The only edges not tied to board contents are
+ * en passent captures, which hinge on ep_file, so pawns flanking either the
+ * old or the new ep target get rebuilt as well. */
+EWRAM_CODE BoardState_t *BoardState_UpdateGraphEdgesFromMove(
+                                  BoardState_t *board_state,
+                                  u32 moving_idx,
+                                  const ChessBoard_Idx_Compact_t *touched,
+                                  u32 touched_ct,
+                                  u8 prev_ep_file,
+                                  BoardState_Undo_t *undo) {
+  const PieceState_Graph_Vertex_t *vertices = board_state->graph.vertices;
+  const ChessBoard_Row_t *board = board_state->board;
+  const u32 ROSTER = board_state->graph.roster.all;
+  const u8 (*const vmap)[CHESS_BOARD_FILE_COUNT]
+                                          = board_state->graph.vertex_hashmap;
+  const struct {
+    u8 file;
+    ChessBoard_Row_e row;
+  } EP_FLANKS[2] = {
+    // Moving side had the move when prev_ep_file was set, so it's the one
+    // whose pawns could have been flanking it.
+    {
+      prev_ep_file,
+      (moving_idx&PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT) ? ROW_5 : ROW_4
+    },
+    {
+      board_state->state.ep_file,
+      (moving_idx&PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT) ? ROW_4 : ROW_5
+    },
+  };
+  ChessBoard_Idx_t vec[2];
+  u32 dirty = 1U<<moving_idx;
+
+  for (u32 i = 0; 2>i; ++i) {
+    if (NO_VALID_EN_PASSENT_FILE==EP_FLANKS[i].file)
+      continue;
+    for (int dx = -1, file, rid; 1>=dx; dx+=2) {
+      file = EP_FLANKS[i].file+dx;
+      if (FILE_A>file || FILE_H<file)
+        continue;
+      rid = vmap[EP_FLANKS[i].row][file];
+      if (PIECE_GRAPH_EMPTY_HASHENT==rid)
+        continue;
+      if (PAWN_IDX==(PIECE_IDX_MASK&board[EP_FLANKS[i].row][file]))
+        dirty |= 1U<<rid;
+    }
+  }
+  for (u32 rid, live = ROSTER&~dirty; live; live&=live-1) {
+    rid = __builtin_ctz(live);
+    vec[0] = BOARD_IDX_CONVERT(vertices[rid].location, NORMAL_IDX_TYPE);
+    for (u32 j = 0; touched_ct>j; ++j) {
+      if (touched[j].raw==vertices[rid].location.raw) {
+        // Castling rook
+        dirty |= 1U<<rid;
+        break;
+      }
+      vec[1] = BOARD_IDX_CONVERT(touched[j], NORMAL_IDX_TYPE);
+      if (BoardState_ValidateAttackVector(board,
+                                          vec,
+                                          board[BOARD_IDX(vec[0])],
+                                          ChessBoard_MoveGetDir(vec))) {
+        dirty |= 1U<<rid;
+        break;
       }
-      hit_idx = vmap[BOARD_IDX(hit_loc)];
-      assert(PIECE_GRAPH_EMPTY_HASHENT!=hit_idx);
-      assert(hit_loc.raw==vertices[hit_idx].location.raw);
-      assert(CHESS_ROSTER_PIECE_ALIVE(roster, hit_idx));
-      cur_adjbits.all|=(1<<hit_idx);
     }
-    ChessMoveIterator_Dealloc(&iterator);
-    white_cardinality = __builtin_popcount(cur_adjbits.team_invariant.white);
-    black_cardinality = __builtin_popcount(cur_adjbits.team_invariant.black);
-    total = white_cardinality+black_cardinality;
-    vertices[i].total_edge_count = total;
-    vertices[i].edges = cur_adjbits;
-    if (i&PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT) {
-      vertices[i].attacking_count = black_cardinality;
-      vertices[i].defending_count = white_cardinality;
-    } else {
-      vertices[i].attacking_count = white_cardinality;
-      vertices[i].defending_count = black_cardinality;
+  }
+  dirty &= ROSTER;
+  if (NULL!=undo) {
+    assert(g_undo_vertex_stack_top+__builtin_popcount(dirty)
+              <= UNDO_VERTEX_STACK_SIZE);
+    undo->saved_vertices = dirty;
+    for (u32 saved = dirty; saved; saved&=saved-1)
+      g_undo_vertex_stack[g_undo_vertex_stack_top++]
+                                    = vertices[__builtin_ctz(saved)];
+  }
+  for (; dirty; dirty&=dirty-1)
+    BoardState_UpdateVertexEdges(board_state, __builtin_ctz(dirty));
+#ifdef _DEBUG_BUILD_
+  {
+    static EWRAM_BSS BoardState_t full;
+    full = *board_state;
+    BoardState_UpdateGraphEdges(&full);
+    for (u32 live = ROSTER, rid; live; live&=live-1) {
+      rid = __builtin_ctz(live);
+      ensure(full.graph.vertices[rid].edges.all==vertices[rid].edges.all,
+          "Incremental edges for rid \x1b[0x44E4]%lu\x1b[0x1484] = "
+          "\x1b[0x44E4]0x%08lX\x1b[0x1484], full rebuild = "
+          "\x1b[0x44E4]0x%08lX\x1b[0x1484]",
+          rid, vertices[rid].edges.all, full.graph.vertices[rid].edges.all);
     }
   }
+#endif
   return board_state;
 }
-
@@ -11,26 +11,58 @@
 #include "debug_io.h"
 #include "chess_board_state_analysis.h"
 
-static EWRAM_CODE BOOL BoardState_ValidateAttackVector(
-                                                const ChessBoard_Row_t *board,
-                                                const ChessBoard_Idx_t *move,
-                                                ChessPiece_e attacker,
-                                                Mvmt_Dir_e attack_dir);
+EWRAM_CODE BOOL BoardState_SquareAttacked(const BoardState_t *board_state,
+                                          u32 sq,
+                                          ChessPiece_e attacking_team) {
+  const BoardState_Bitboards_t *bbs = &board_state->bb;
+  const u32 TEAM_IDX = BB_TEAM_IDX(attacking_team);
+  const Bitboard_t THEM = bbs->teams[TEAM_IDX],
+                   OCC = Bitboard_Occupancy(bbs),
+                   STRAIGHT = (bbs->pieces[ROOK_IDX]|bbs->pieces[QUEEN_IDX])
+                                &THEM,
+                   DIAGONAL = (bbs->pieces[BISHOP_IDX]|bbs->pieces[QUEEN_IDX])
+                                &THEM;
+  // Pawns attacking sq stand where a pawn of the other team on sq would
+  // attack.
+  if (BB_PAWN_ATTACKS[TEAM_IDX^1][sq]&bbs->pieces[PAWN_IDX]&THEM)
+    return TRUE;
+  if (BB_KNIGHT_ATTACKS[sq]&bbs->pieces[KNIGHT_IDX]&THEM)
+    return TRUE;
+  if (BB_KING_ATTACKS[sq]&bbs->pieces[KING_IDX]&THEM)
+    return TRUE;
+  if (DIAGONAL && (Bitboard_BishopAttacks(sq, OCC)&DIAGONAL))
+    return TRUE;
+  if (STRAIGHT && (Bitboard_RookAttacks(sq, OCC)&STRAIGHT))
+    return TRUE;
+  return FALSE;
+}
 
 EWRAM_CODE BOOL BoardState_KingInCheck(const BoardState_t *board_state,
                                        u32 allied_king_id,
                                        u32 opp_ofs) {
+  const BOOL IN_CHECK = BoardState_SquareAttacked(board_state,
+      BB_SQ_FROM_COMPACT(board_state->graph.vertices[allied_king_id].location),
+      opp_ofs ? WHITE_FLAGBIT : BLACK_FLAGBIT);
+#ifdef _DEBUG_BUILD_
+  // Cross-check against the attack graph, which answers the same question
+  // by scanning the opposition's edges for the king.
   const PieceState_Graph_Vertex_t *vertices = board_state->graph.vertices;
   const ChessPiece_Roster_t roster = board_state->graph.roster;
+  BOOL graph_in_check = FALSE;
   for (u32 j,jbase=0; CHESS_TEAM_PIECE_COUNT>jbase; ++jbase) {
     j=jbase|opp_ofs;
     if (!CHESS_ROSTER_PIECE_ALIVE(roster, j))
       continue;
     if (vertices[j].edges.all&(1<<allied_king_id)) {
-      return TRUE;
+      graph_in_check = TRUE;
+      break;
     }
   }
-  return FALSE;
+  ensure(IN_CHECK==graph_in_check,
+      "Bitboards say king %s in check, graph says otherwise.",
+      IN_CHECK ? "is" : "is not");
+#endif
+  return IN_CHECK;
 }
 
 EWRAM_CODE Mvmt_Dir_e BoardState_PiecePinDirection(
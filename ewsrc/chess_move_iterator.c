@@ -59,170 +59,6 @@ extern EWRAM_CODE BOOL InternalMoveIterator_ContinuousForceNextDirection(
 
 static IWRAM_BSS ChessMoveIteration_t _L_move_buffer[MAX_MOVE_CANDIDATES];
 
-
-
-
-
-
-// We can do this thanks to GBA being single-threaded.
-static const EWRAM_BSS BoardState_t *_L_cur_board_state=NULL;
-static ChessBoard_Idx_t _L_cur_piece_location = INVALID_IDX;
-
-
-
-static EWRAM_CODE int Capture_Eval(ChessBoard_Idx_t loc);
-static EWRAM_CODE int Knight_Move_Eval(ChessBoard_Idx_t loc);
-static EWRAM_CODE int Promo_Flag_Eval(int promo_flag);
-static EWRAM_CODE int __MoveIterationCmp(const void *a, const void *b);
-
-EWRAM_CODE int Capture_Eval(ChessBoard_Idx_t loc) {
-  PieceState_Graph_Vertex_t capt_graphnode;
-  capt_graphnode 
-    = _L_cur_board_state
-              ->graph.vertices[_L_cur_board_state->graph.vertex_hashmap[
-                                                              BOARD_IDX(loc)]];
-  return 2*capt_graphnode.attacking_count 
-                - capt_graphnode.defending_count;
-}
-
-EWRAM_CODE int Knight_Move_Eval(ChessBoard_Idx_t loc) {
-  int move_count=0;
-  BOOL can_up_tall, can_up_wide, can_down_tall, can_down_wide;
-  can_up_wide = can_up_tall = ROW_7 < loc.coord.y;
-  // can_up_tall -> can_up_wide, so, unless !(can_up_wide=can_up_tall=...),
-  // can_up_wide is valid, and doesnt need to be set again.
-  if (!can_up_wide)
-    can_up_wide = ROW_8 < loc.coord.y;
-  can_down_wide = can_down_tall = ROW_2 > loc.coord.y;
-  // can_down_tall -> can_down_wide, so same logic here.
-  if (!can_down_wide)
-    can_down_wide = ROW_1 > loc.coord.y;
-  if (FILE_A<loc.coord.x) {
-    if (can_up_tall) {
-      ++move_count;
-      // because if can up wide is necessary for can_up_tall, we can just check
-      // to see if left wide
-      if (FILE_B < loc.coord.x)
-        ++move_count;
-    } else if (FILE_B<loc.coord.x) {
-      if (can_up_wide)
-        ++move_count;
-    }
-    if (can_down_tall) {
-      ++move_count;
-      if (FILE_B < loc.coord.x) {
-        ++move_count;
-      }
-    } else if (can_down_wide) {
-      if (can_down_wide)
-        ++move_count;
-    }
-  }
-  if (FILE_H > loc.coord.x) {
-    if (can_up_tall) {
-      ++move_count;
-      if (FILE_G > loc.coord.x)
-        ++move_count;
-    } else if (can_up_wide) {
-      if (FILE_G > loc.coord.x)
-        ++move_count;
-    }
-    if (can_down_tall) {
-      ++move_count;
-      if (FILE_G > loc.coord.x)
-        ++move_count;
-    } else if (can_down_wide) {
-      if (FILE_G > loc.coord.x)
-        ++move_count;
-    }
-  }
-  return move_count;
-}
-
-EWRAM_CODE int Promo_Flag_Eval(int promo_flag) {
-  if (!promo_flag)
-    return 0;
-  switch ((ChessPiece_e)promo_flag) {
-  case QUEEN_IDX:
-    return 4;
-  case ROOK_IDX:
-    return 3;
-  case BISHOP_IDX:
-    return 2;
-  case KNIGHT_IDX:
-    return 1;
-  default:
-    assert(0);
-    return ~0;
-  }
-}
-
-
-EWRAM_CODE int __MoveIterationCmp(const void *a, const void *b) {
-  const ChessMoveIteration_t *lhs=a, *rhs=b;
-  assert(_L_cur_board_state!=NULL);
-  ChessPiece_e start_piece, lhs_dst_piece, rhs_dst_piece;
-  BOOL lhs_empty;
-  lhs_dst_piece = _L_cur_board_state->board[BOARD_IDX(lhs->dst)];
-  rhs_dst_piece = _L_cur_board_state->board[BOARD_IDX(rhs->dst)];
-
-  assert(INVALID_IDX_RAW_VAL != _L_cur_piece_location.raw);
-  start_piece = PIECE_IDX_MASK
-                  & _L_cur_board_state->board[BOARD_IDX(_L_cur_piece_location)];
-
-  lhs_empty = (EMPTY_IDX==lhs_dst_piece);
-  if (lhs_empty^(EMPTY_IDX==rhs_dst_piece)) {  // 1 operand empty, other not
-    return lhs_empty ? 1 : -1;                 // and if lhs is the empty 1,
-                                               // positive cmp return. This
-                                               // is done because we want
-                                               // better moves at leftmost 
-                                               // side (lowermost addr),
-                                               // as iterator iterates 
-                                               // to right (increment addr)
-                                               // as we go thru move buf
-  }
-  if (lhs_empty) {
-    // if both spots equal, just evaluate based on distance for cmp, OR
-    // (special cases: castle, promo, and knight moving into edge or corner
-    // Special Cases:
-    if (KNIGHT_IDX==start_piece) {
-      return Knight_Move_Eval(rhs->dst) - Knight_Move_Eval(lhs->dst);
-    } else if (KING_IDX==start_piece || PAWN_IDX==start_piece) {
-      if (PAWN_IDX==start_piece) {
-        if (lhs->promotion_flag != rhs->promotion_flag) {
-          // THis works because default value of ZERO means no promo occurred,
-          // and then promotion_flag
-          return Promo_Flag_Eval(rhs->promotion_flag)
-                  - Promo_Flag_Eval(lhs->promotion_flag);
-        }
-      }
-      if (MOVE_SPECIAL_MOVE_FLAGS_MASK&lhs->special_flags) {
-        return MOVE_SPECIAL_MOVE_FLAGS_MASK&rhs->special_flags ? 0 : -1;
-      } else if (MOVE_SPECIAL_MOVE_FLAGS_MASK&rhs->special_flags) {
-        return 1;
-      }
-    }
-    
-    // Distance based scoring
-    int dx,dy, lhs_dist_magnitude, rhs_dist_magnitude;
-    dx = lhs->dst.arithmetic.x - _L_cur_piece_location.arithmetic.x;
-    dy = lhs->dst.arithmetic.y - _L_cur_piece_location.arithmetic.y;
-    lhs_dist_magnitude = dx*dx + dy*dy;
-
-    dx = rhs->dst.arithmetic.x - _L_cur_piece_location.arithmetic.x;
-    dy = rhs->dst.arithmetic.y - _L_cur_piece_location.arithmetic.y;
-    rhs_dist_magnitude = dx*dx + dy*dy;
-    assert(lhs_dist_magnitude>0 && rhs_dist_magnitude>0);
-    return rhs_dist_magnitude - lhs_dist_magnitude;
-
-  }
-  return Capture_Eval(rhs->dst) - Capture_Eval(lhs->dst);
-
-
-  
-  
-  
-}
 EWRAM_CODE BOOL ChessMoveIterator_Alloc(ChessMoveIterator_t *dst_iterator,
                              ChessBoard_Idx_t piece_location,
                              const BoardState_t *state,
@@ -240,7 +76,6 @@ EWRAM_CODE BOOL ChessMoveIterator_Alloc(ChessMoveIterator_t *dst_iterator,
 
   ChessPiece_e mv_piece = BOARD_DATA[BOARD_IDX(piece_location)], curpiece;
   u32 count = 0;
-  BOOL ordered = MV_ITER_MOVESET_SETTING_ENABLED(mode, ORDERED);
   mode = MV_ITER_MOVESET_SET_TYPE(mode);
   Fast_Memset32(&iter, 0, sizeof(InternalMoveIterator_t)/sizeof(WORD));
   *dst_iterator = iterator;
@@ -393,7 +228,12 @@ EWRAM_CODE BOOL ChessMoveIterator_Alloc(ChessMoveIterator_t *dst_iterator,
         if (EMPTY_IDX!=curpiece)
           continue;
       } else if (EMPTY_IDX==curpiece) {
-        if (MV_FILE==state->state.ep_file) {
+        // ep_file only belongs to the side to move. Graph edge rebuilds
+        // iterate both teams' pawns, so the opposing side's pawns must not
+        // read it as their own en passent target.
+        if (MV_FILE==state->state.ep_file
+            && (u32)CONVERT_BOARD_STATE_MOVE_FLAG(state->state.side_to_move)
+                  ==ALLIED_TEAM_FLAGBIT) {
           const ChessBoard_Row_e STARTING_ROW = piece_location.coord.y;
           if (WHITE_FLAGBIT==ALLIED_TEAM_FLAGBIT) {
             if (ROW_6!=MV_ROW)  // can't be empty pawn attack and NOT
@@ -500,15 +340,6 @@ EWRAM_CODE BOOL ChessMoveIterator_Alloc(ChessMoveIterator_t *dst_iterator,
   Fast_Memcpy32(moves,
                 _L_move_buffer,
                 count*sizeof(ChessMoveIteration_t)/sizeof(WORD));
-  if (ordered) {
-    // Need to pass current state to src file local, _L_cur_board_state
-    _L_cur_board_state = state;
-    _L_cur_piece_location = piece_location;
-    qsort(moves,
-          count,
-          sizeof(ChessMoveIteration_t),
-          __MoveIterationCmp);
-  }
   iterator.size = count;
   *dst_iterator = iterator;
   return TRUE;
@@ -545,8 +376,7 @@ EWRAM_CODE BOOL ChessMoveIterator_Dealloc(ChessMoveIterator_t *iterator) {
   assert(0!=iterator->size && NULL!=iterator->priv->moves);
   MoveBufferHeap_Dealloc(iterator->priv->moves);
   assert(MoveIterator_PrivateFields_Deallocate(iterator->priv));
-  static_assert(sizeof(ChessMoveIterator_t)==sizeof(u64));
-  *((u64*)iterator) = 0ULL;
+  *iterator = (ChessMoveIterator_t){0};
   assert(0==iterator->size && NULL==iterator->priv);
   return TRUE;
 }
@@ -0,0 +1,34 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* Host (Linux) stand-in for lib/include/GBAdev_functions.h. Only the
+ * routines the engine sources call are declared here, and they are
+ * implemented in host/src/host_platform.c. */
+#ifndef _GBADEV_FUNCTIONS_
+#define _GBADEV_FUNCTIONS_
+
+#include <GBAdev_types.h>
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+/* BIOS calls are no-ops off-cartridge */
+#define SUPERVISOR_CALL(idx) ((void)0)
+
+void Fast_Memcpy32(void *dst, const void *src, u32 word_ct);
+void Fast_Memset32(void *dst, u32 fill_word, u32 word_ct);
+
+BOOL OAM_Init(Obj_Attr_t *obj_attrs, u32 count);
+
+INLN void OAM_Copy(Obj_Attr_t *dst, const Obj_Attr_t *src, u32 count);
+
+
+INLN void OAM_Copy(Obj_Attr_t *dst, const Obj_Attr_t *src, u32 count) {
+  Fast_Memcpy32(dst, src, count<<1);
+}
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _GBADEV_FUNCTIONS_ */
@@ -0,0 +1,120 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* Host (Linux) stand-in for lib/include/GBAdev_types.h. The GBA header types
+ * u32/i32 as long, which is 64 bits wide on an LP64 host, so every static
+ * size assertion the engine makes w.r.t. WORD would fall over. This shim pins
+ * the integer typedefs to their intended widths and only carries over the
+ * hardware types the engine headers actually reference. */
+#ifndef _GBADEV_TYPES_
+#define _GBADEV_TYPES_
+
+#include <stdint.h>
+#include "GBAdev_util_macros.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+typedef uint8_t                 u8;
+typedef uint16_t                u16;
+typedef uint32_t                u32;
+typedef uint64_t                u64;
+
+typedef int8_t                  i8;
+typedef int16_t                 i16;
+typedef int32_t                 i32;
+typedef int64_t                 i64;
+
+typedef uintptr_t uptr_t;
+
+typedef _Bool                   BOOL;
+
+typedef uint32_t                WORD;
+
+typedef uintptr_t               UIPTR_T;
+
+typedef void (*IRQ_Callback_t)(void);
+
+typedef union u_obj_attr0 {
+  u16 raw;
+  struct {
+    u32 y             : 8;
+    BOOL affine_mode  : 1;
+    BOOL disable      : 1;
+    u32 mode          : 2;
+    BOOL mosaic       : 1;
+    BOOL pal_8bpp     : 1;
+    u32 shape         : 2;
+  } ALIGN(2) PACKED regular;
+  struct {
+    u32 y             : 8;
+    BOOL affine_mode  : 1;
+    BOOL double_size  : 1;
+    u32 mode          : 2;
+    BOOL mosaic       : 1;
+    BOOL pal_8bpp     : 1;
+    u32 shape         : 2;
+  } ALIGN(2) PACKED affine;
+  struct {
+    u32 y             : 8;
+    BOOL affine_mode  : 1;
+    BOOL IGNORE_PAD0  : 1;
+    u32 mode          : 2;
+    BOOL mosaic       : 1;
+    BOOL pal_8bpp     : 1;
+    u32 shape         : 2;
+  } ALIGN(2) PACKED shared;
+} Obj_Attr_Fields0_t;
+
+typedef union u_obj_attr1 {
+  u16 raw;
+  struct {
+    u32 x : 9;
+    u32 IGNORE_PAD0 : 3;
+    BOOL hflip : 1;
+    BOOL vflip : 1;
+    u32 obj_size : 2;
+  } ALIGN(2) PACKED regular;
+  struct {
+    u32 x : 9;
+    u32 affine_idx : 5;
+    u32 obj_size : 2;
+  } ALIGN(2) PACKED affine;
+  struct {
+    u32 x : 9;
+    u32 IGNORE_PAD0 : 5;
+    u32 obj_size : 2;
+  } ALIGN(2) PACKED shared;
+} Obj_Attr_Fields1_t;
+
+typedef struct s_obj_attr2 {
+  u32 sprite_idx : 10;
+  u32 priority : 2;
+  u32 pal16_bank : 4;
+} ALIGN(2) PACKED Obj_Attr_Fields2_t;
+
+
+
+typedef struct s_obj_attr {
+  Obj_Attr_Fields0_t attr0;
+  Obj_Attr_Fields1_t attr1;
+  Obj_Attr_Fields2_t attr2;
+  u16 IGNORE_PAD;
+} ALIGN(4) Obj_Attr_t;
+
+typedef struct s_spr_tile_4bpp {
+  u32 data[8];
+} Tile4_t;
+
+typedef struct s_spr_tile_8bpp {
+  u32 data[16];
+} Tile8_t;
+
+typedef Tile4_t Tile4_Block_t[512];
+typedef Tile8_t Tile8_Block_t[256];
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _GBADEV_TYPES_ */
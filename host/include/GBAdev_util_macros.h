@@ -0,0 +1,56 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* Host (Linux) stand-in for lib/include/GBAdev_util_macros.h. Memory region
+ * placement and ARM long calls mean nothing off-cartridge, so the section
+ * macros expand to nothing. Everything else mirrors the GBA header. */
+#ifndef _GBADEV_UTIL_MACROS_
+#define _GBADEV_UTIL_MACROS_
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+#define IWRAM_CODE
+#define EWRAM_CODE
+
+#define IWRAM_DATA
+#define IWRAM_BSS
+#define EWRAM_DATA
+#define EWRAM_BSS
+
+#define ALIGN(alignment) __attribute__ (( aligned(alignment) ))
+#define PACKED __attribute__ (( packed ))
+#define FORCE_INLINE __attribute__ (( always_inline ))
+
+#define __INTENT__(attr) __INTENT_##attr
+
+#define __INTENT_FALLTHROUGH __attribute__ (( __fallthrough__ ))
+#define __INTENT_UNUSED __attribute__ (( unused ))
+
+
+#define PRINTF_LIKE(fmt_arg_no, first_variadic_arg_no)\
+  __attribute__ (( __format__ (__printf__, fmt_arg_no, first_variadic_arg_no) ))
+
+#define DO_PRAGMA(pg) _Pragma (#pg)
+#define DIAGNOSTICS_SUPPRESS(_diagnostic) \
+  DO_PRAGMA(GCC diagnostic ignored #_diagnostic)
+
+#define BEGIN_DIAGNOSTIC_SUPPRESSION(_diagnostic)  \
+  _Pragma("GCC diagnostic push")  \
+  DO_PRAGMA(GCC diagnostic ignored #_diagnostic)
+
+#define END_DIAGNOSTIC_SUPPRESSION()  \
+  _Pragma("GCC diagnostic pop")
+
+#define TODO(msg) DO_PRAGMA(message("TODO: " #msg))
+
+#define INLN static inline
+
+#define ASM(...)
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _GBADEV_UTIL_MACROS_ */
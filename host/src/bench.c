@@ -0,0 +1,99 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* Host-side bench. Searches the fixed positions in src/chess_bench.c to a
+ * fixed depth and prints the total node count, which only changes when the
+ * search does, along with time, nps and transposition table probes/hits.
+ * The ROM does the same when built with -D_CHESS_BENCH_BUILD_.
+ *
+ * Usage:
+ *   bench [-d depth]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <GBAdev_types.h>
+#include "chess_ai_types.h"
+#include "chess_ai.h"
+#include "chess_bench.h"
+#include "chess_clock.h"
+
+static void Bench_MoveToString(char *dst,
+                               const ChessAI_MoveSearch_Result_t *mv) {
+  static const char PROMO_CHARS[] = {
+    [BISHOP_IDX]='b', [ROOK_IDX]='r', [KNIGHT_IDX]='n', [QUEEN_IDX]='q'
+  };
+  if (INVALID_IDX_COMPACT_RAW==mv->start.raw) {
+    strcpy(dst, "0000");
+    return;
+  }
+  *dst++ = 'a' + mv->start.coord.x;
+  *dst++ = '8' - mv->start.coord.y;
+  *dst++ = 'a' + mv->dst.coord.x;
+  *dst++ = '8' - mv->dst.coord.y;
+  if (mv->promo)
+    *dst++ = PROMO_CHARS[mv->promo&PIECE_IDX_MASK];
+  *dst = '\0';
+}
+
+static void Bench_Report(u32 idx,
+                         const ChessAI_MoveSearch_Result_t *move,
+                         const ChessBench_Result_t *position) {
+  char mvstr[6];
+  Bench_MoveToString(mvstr, move);
+  printf("position %2lu: %-5s %9lu nodes %7llu ms\n",
+         (unsigned long)idx+1,
+         mvstr,
+         (unsigned long)position->nodes,
+         (unsigned long long)CHESS_CLOCK_TICKS_TO_MS(position->ticks));
+}
+
+static void Bench_Usage(const char *argv0) {
+  fprintf(stderr, "Usage: %s [-d depth]\n"
+                  "  Default depth is %d, and at most %d (MAX_DEPTH).\n",
+          argv0, CHESS_BENCH_DEPTH, MAX_DEPTH);
+}
+
+int main(int argc, char *argv[]) {
+  u32 depth = CHESS_BENCH_DEPTH;
+  ChessBench_Result_t total;
+  u32 searched;
+  u64 ms;
+  for (int i = 1; argc>i; ++i) {
+    if (!strcmp(argv[i], "-d") && argc>i+1) {
+      depth = strtoul(argv[++i], NULL, 10);
+    } else {
+      Bench_Usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (0==depth || MAX_DEPTH<depth) {
+    Bench_Usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  ChessClock_Start();
+  searched = ChessBench_Run(depth, Bench_Report, &total);
+  if (CHESS_BENCH_POSITION_COUNT!=searched) {
+    fprintf(stderr, "bench: could not set up position %lu, \"%s\"\n",
+            (unsigned long)searched+1, CHESS_BENCH_FENS[searched]);
+    return EXIT_FAILURE;
+  }
+  ms = CHESS_CLOCK_TICKS_TO_MS(total.ticks);
+  printf("\ndepth %lu, %lu positions\n"
+         "nodes %lu\n"
+         "time %llu ms\n"
+         "nps %llu\n"
+         "tt probes %lu, hits %lu (%lu%%)\n",
+         (unsigned long)depth,
+         (unsigned long)CHESS_BENCH_POSITION_COUNT,
+         (unsigned long)total.nodes,
+         (unsigned long long)ms,
+         (unsigned long long)(ms ? (u64)total.nodes*1000UL/ms
+                                 : (u64)total.nodes*1000UL),
+         (unsigned long)total.tt_probes,
+         (unsigned long)total.tt_hits,
+         (unsigned long)(total.tt_probes
+                           ? (u64)total.tt_hits*100UL/total.tt_probes
+                           : 0));
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,392 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* Host-side generator for the KPK, KRK and KQK bitbases (chess_bitbase.h).
+ *
+ * Each ending is solved by iterating to a fixed point over every index of
+ * its bitbase. The first pass marks the weak side's checkmates. Then, each
+ * pass marks a strong-to-move position won if any move reaches a won
+ * position, and a weak-to-move position won if it has moves and every one
+ * of them reaches a won position. Once a pass marks nothing new, whatever
+ * isn't won is a draw. Passes are split across worker threads. Every thread
+ * reads the last pass's results and writes its own slice of the next pass,
+ * so the result doesn't depend on the thread count.
+ *
+ * KPK is solved last, since a promotion turns it into KQK or KRK.
+ *
+ * Usage:
+ *   bitbase_gen [-j threads] [-o out.c]
+ */
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <GBAdev_types.h>
+#include "chess_bitbase.h"
+#include "chess_bitboard.h"
+
+#define BITBASE_GEN_MAX_THREADS 64
+
+/* One position in the strong-side-is-white orientation. */
+typedef struct s_bitbase_pos {
+  u32 strong_king, piece, weak_king;
+  BOOL strong_to_move;
+} Bitbase_Pos_t;
+
+typedef struct s_bitbase_table {
+  ChessBitbase_e id;
+  const char *name;
+  u32 size;
+  /* One byte per index: won, and whether the index is a legal position at
+   * all. Illegal ones are don't-cares when the table gets compressed. */
+  u8 *won, *legal;
+} Bitbase_Table_t;
+
+typedef struct s_bitbase_worker {
+  pthread_t thread;
+  Bitbase_Table_t *table;
+  const u8 *cur;
+  u8 *next;
+  u32 lo, hi, changed;
+} Bitbase_Worker_t;
+
+static Bitbase_Table_t g_tables[CHESS_BITBASE_COUNT] = {
+  [CHESS_BITBASE_KPK] = {CHESS_BITBASE_KPK, "KPK", CHESS_BITBASE_KPK_SIZE},
+  [CHESS_BITBASE_KRK] = {CHESS_BITBASE_KRK, "KRK", CHESS_BITBASE_KXK_SIZE},
+  [CHESS_BITBASE_KQK] = {CHESS_BITBASE_KQK, "KQK", CHESS_BITBASE_KXK_SIZE},
+};
+
+/* Inverse of ChessBitbase_Index, giving the position each index stands
+ * for. */
+static Bitbase_Pos_t Bitbase_Decode(ChessBitbase_e id, u32 idx) {
+  Bitbase_Pos_t pos = {
+    .weak_king = idx&63,
+  };
+  u32 slot, row, file;
+  if (CHESS_BITBASE_KPK==id) {
+    pos.strong_king = (idx>>6)&63;
+    slot = (idx>>12)%CHESS_BITBASE_PAWN_SQUARES;
+    pos.strong_to_move = CHESS_BITBASE_PAWN_SQUARES<=(idx>>12);
+    pos.piece = BB_SQ(slot&3, (slot>>2)+1);
+    return pos;
+  }
+  pos.piece = (idx>>6)&63;
+  slot = (idx>>12)%CHESS_BITBASE_TRIANGLE_SQUARES;
+  pos.strong_to_move = CHESS_BITBASE_TRIANGLE_SQUARES<=(idx>>12);
+  for (file = 0; slot>file; slot -= ++file)
+    continue;
+  row = slot;
+  pos.strong_king = BB_SQ(file, row);
+  return pos;
+}
+
+static Bitboard_t Bitbase_PieceAttacks(ChessBitbase_e id,
+                                       u32 sq,
+                                       Bitboard_t occ) {
+  switch (id) {
+  case CHESS_BITBASE_KPK:
+    return Bitboard_WhitePawnAttacks(BB_SQ_BIT(sq));
+  case CHESS_BITBASE_KRK:
+    return Bitboard_RookAttacks(sq, occ);
+  default:
+    return Bitboard_QueenAttacks(sq, occ);
+  }
+}
+
+static BOOL Bitbase_Legal(ChessBitbase_e id, const Bitbase_Pos_t *pos) {
+  const Bitboard_t OCC = BB_SQ_BIT(pos->strong_king)
+                        |BB_SQ_BIT(pos->piece)
+                        |BB_SQ_BIT(pos->weak_king);
+  if (3!=__builtin_popcountll(OCC)
+      || BB_KING_ATTACKS[pos->strong_king]&BB_SQ_BIT(pos->weak_king))
+    return FALSE;
+  // The weak king can't be left in check with the strong side to move.
+  return !pos->strong_to_move
+    || !(Bitbase_PieceAttacks(id, pos->piece, OCC)&BB_SQ_BIT(pos->weak_king));
+}
+
+#define BITBASE_WON(tbl, cur, pos)\
+  (0!=(cur)[ChessBitbase_Index((tbl)->id, (pos).strong_king, (pos).piece,\
+                               (pos).weak_king, (pos).strong_to_move)])
+
+static BOOL Bitbase_StrongWins(const Bitbase_Table_t *tbl,
+                               const u8 *cur,
+                               const Bitbase_Pos_t *pos) {
+  const Bitboard_t SK = BB_SQ_BIT(pos->strong_king),
+                   PC = BB_SQ_BIT(pos->piece),
+                   WK = BB_SQ_BIT(pos->weak_king);
+  Bitbase_Pos_t child = *pos;
+  Bitboard_t to;
+  child.strong_to_move = FALSE;
+  for (to = BB_KING_ATTACKS[pos->strong_king]
+              &~BB_KING_ATTACKS[pos->weak_king]&~PC&~WK;
+       to;
+       to &= to-1) {
+    child.strong_king = __builtin_ctzll(to);
+    if (BITBASE_WON(tbl, cur, child))
+      return TRUE;
+  }
+  child.strong_king = pos->strong_king;
+  if (CHESS_BITBASE_KPK!=tbl->id) {
+    for (to = Bitbase_PieceAttacks(tbl->id, pos->piece, SK|PC|WK)&~SK&~WK;
+         to;
+         to &= to-1) {
+      child.piece = __builtin_ctzll(to);
+      if (BITBASE_WON(tbl, cur, child))
+        return TRUE;
+    }
+    return FALSE;
+  }
+  // Pawn pushes. Reaching ROW_8 hands the position over to the (already
+  // solved) KQK and KRK bitbases, underpromoting when a queen would
+  // stalemate.
+  child.piece = pos->piece-8;
+  if ((SK|WK)&BB_SQ_BIT(child.piece))
+    return FALSE;
+  if (0==BB_SQ_ROW(child.piece)) {
+    return g_tables[CHESS_BITBASE_KQK].won[
+                  ChessBitbase_Index(CHESS_BITBASE_KQK, child.strong_king,
+                                     child.piece, child.weak_king, FALSE)]
+        || g_tables[CHESS_BITBASE_KRK].won[
+                  ChessBitbase_Index(CHESS_BITBASE_KRK, child.strong_king,
+                                     child.piece, child.weak_king, FALSE)];
+  }
+  if (BITBASE_WON(tbl, cur, child))
+    return TRUE;
+  if (6!=BB_SQ_ROW(pos->piece) || (SK|WK)&BB_SQ_BIT(pos->piece-16))
+    return FALSE;
+  child.piece = pos->piece-16;
+  return BITBASE_WON(tbl, cur, child);
+}
+
+static BOOL Bitbase_WeakLoses(const Bitbase_Table_t *tbl,
+                              const u8 *cur,
+                              const Bitbase_Pos_t *pos) {
+  const Bitboard_t SK = BB_SQ_BIT(pos->strong_king),
+                   PC = BB_SQ_BIT(pos->piece),
+                   WK = BB_SQ_BIT(pos->weak_king);
+  // The weak king doesn't block attacks on the squares behind it.
+  const Bitboard_t PIECE_ATTACKS = Bitbase_PieceAttacks(tbl->id,
+                                                        pos->piece,
+                                                        SK|PC),
+                   ATTACKED = BB_KING_ATTACKS[pos->strong_king]
+                             |PIECE_ATTACKS;
+  Bitbase_Pos_t child = *pos;
+  Bitboard_t to = BB_KING_ATTACKS[pos->weak_king]&~ATTACKED;
+  if (0==to)
+    return 0!=(PIECE_ATTACKS&WK);  // Mate, or stalemate.
+  // Taking the piece leaves two bare kings.
+  if (to&PC)
+    return FALSE;
+  child.strong_to_move = TRUE;
+  for (; to; to &= to-1) {
+    child.weak_king = __builtin_ctzll(to);
+    if (!BITBASE_WON(tbl, cur, child))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+static void *Bitbase_Work(void *arg) {
+  Bitbase_Worker_t *const w = arg;
+  const Bitbase_Table_t *const TBL = w->table;
+  w->changed = 0;
+  for (u32 idx = w->lo; w->hi>idx; ++idx) {
+    Bitbase_Pos_t pos;
+    BOOL won;
+    w->next[idx] = w->cur[idx];
+    if (w->cur[idx] || !TBL->legal[idx])
+      continue;
+    pos = Bitbase_Decode(TBL->id, idx);
+    won = pos.strong_to_move ? Bitbase_StrongWins(TBL, w->cur, &pos)
+                             : Bitbase_WeakLoses(TBL, w->cur, &pos);
+    if (won) {
+      w->next[idx] = 1;
+      ++w->changed;
+    }
+  }
+  return NULL;
+}
+
+static void Bitbase_Solve(Bitbase_Table_t *tbl, u32 threads) {
+  Bitbase_Worker_t workers[BITBASE_GEN_MAX_THREADS];
+  u8 *cur, *next, *swap;
+  u32 changed, passes = 0, legal = 0, won = 0;
+  tbl->won = cur = calloc(tbl->size, 1);
+  next = calloc(tbl->size, 1);
+  tbl->legal = calloc(tbl->size, 1);
+  if (NULL==cur || NULL==next || NULL==tbl->legal) {
+    fprintf(stderr, "bitbase_gen: out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (u32 idx = 0; tbl->size>idx; ++idx) {
+    const Bitbase_Pos_t POS = Bitbase_Decode(tbl->id, idx);
+    // Only the canonical index of each position counts as legal, so mirror
+    // images aren't solved twice, and are free to compress however suits.
+    tbl->legal[idx] = Bitbase_Legal(tbl->id, &POS)
+        && idx==ChessBitbase_Index(tbl->id, POS.strong_king, POS.piece,
+                                   POS.weak_king, POS.strong_to_move);
+    legal += tbl->legal[idx];
+  }
+  do {
+    changed = 0;
+    for (u32 t = 0; threads>t; ++t) {
+      workers[t] = (Bitbase_Worker_t) {
+        .table = tbl,
+        .cur = cur,
+        .next = next,
+        .lo = (u32)((u64)tbl->size*t/threads),
+        .hi = (u32)((u64)tbl->size*(t+1)/threads),
+      };
+      if (pthread_create(&workers[t].thread, NULL, Bitbase_Work,
+                         &workers[t])) {
+        perror("bitbase_gen: pthread_create");
+        exit(EXIT_FAILURE);
+      }
+    }
+    for (u32 t = 0; threads>t; ++t) {
+      pthread_join(workers[t].thread, NULL);
+      changed += workers[t].changed;
+    }
+    swap = cur;
+    cur = next;
+    next = swap;
+    ++passes;
+  } while (changed);
+  free(next);
+  tbl->won = cur;
+  for (u32 idx = 0; tbl->size>idx; ++idx)
+    won += tbl->legal[idx]&tbl->won[idx];
+  fprintf(stderr, "bitbase_gen: %s: %lu legal positions, %lu won, %lu "
+                  "drawn, %lu passes\n",
+          tbl->name, (unsigned long)legal, (unsigned long)won,
+          (unsigned long)(legal-won), (unsigned long)passes);
+}
+
+/* Compress and print one table. Returns its size in bytes. */
+static size_t Bitbase_Write(const Bitbase_Table_t *tbl, FILE *out) {
+  const u32 BLOCK_SIZE = 1<<CHESS_BITBASE_BLOCK_LOG2,
+            BLOCK_CT = tbl->size>>CHESS_BITBASE_BLOCK_LOG2;
+  u16 *blocks = malloc(BLOCK_CT*sizeof(*blocks));
+  u32 *words = malloc((size_t)BLOCK_CT*CHESS_BITBASE_BLOCK_WORDS
+                      *sizeof(*words));
+  u32 mixed = 0;
+  if (NULL==blocks || NULL==words) {
+    fprintf(stderr, "bitbase_gen: out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+  for (u32 b = 0; BLOCK_CT>b; ++b) {
+    const u32 BASE = b*BLOCK_SIZE;
+    u32 wins = 0, draws = 0, found;
+    u32 *bits = &words[mixed*CHESS_BITBASE_BLOCK_WORDS];
+    for (u32 i = 0; BLOCK_SIZE>i; ++i) {
+      if (!tbl->legal[BASE+i])
+        continue;
+      if (tbl->won[BASE+i])
+        ++wins;
+      else
+        ++draws;
+    }
+    if (0==wins || 0==draws) {
+      blocks[b] = wins ? CHESS_BITBASE_BLOCK_WIN : CHESS_BITBASE_BLOCK_DRAW;
+      continue;
+    }
+    // Don't-cares go whichever way the block leans.
+    memset(bits, 0, CHESS_BITBASE_BLOCK_WORDS*sizeof(*bits));
+    for (u32 i = 0; BLOCK_SIZE>i; ++i)
+      if (tbl->legal[BASE+i] ? tbl->won[BASE+i] : wins>draws)
+        bits[i>>5] |= 1U<<(i&31);
+    for (found = 0; mixed>found; ++found)
+      if (!memcmp(&words[found*CHESS_BITBASE_BLOCK_WORDS], bits,
+                  CHESS_BITBASE_BLOCK_WORDS*sizeof(*bits)))
+        break;
+    if (mixed==found)
+      ++mixed;
+    if (CHESS_BITBASE_BLOCK_DRAW<=found) {
+      fprintf(stderr, "bitbase_gen: %s has too many mixed blocks\n",
+              tbl->name);
+      exit(EXIT_FAILURE);
+    }
+    blocks[b] = (u16)found;
+  }
+
+  fprintf(out, "static const u16 %s_BLOCKS[%lu] = {", tbl->name,
+          (unsigned long)BLOCK_CT);
+  for (u32 b = 0; BLOCK_CT>b; ++b)
+    fprintf(out, "%s0x%04X,", b%10 ? " " : "\n  ", blocks[b]);
+  // An empty initializer isn't valid C, so a table with no mixed blocks
+  // still gets one (unused) word.
+  fprintf(out, "\n};\n\nstatic const u32 %s_WORDS[%lu] = {", tbl->name,
+          (unsigned long)(mixed ? mixed*CHESS_BITBASE_BLOCK_WORDS : 1));
+  for (u32 i = 0; mixed*CHESS_BITBASE_BLOCK_WORDS>i; ++i)
+    fprintf(out, "%s0x%08lX,", i%6 ? " " : "\n  ",
+            (unsigned long)words[i]);
+  if (0==mixed)
+    fprintf(out, "\n  0,");
+  fprintf(out, "\n};\n\n");
+  free(blocks);
+  free(words);
+  fprintf(stderr, "bitbase_gen: %s: %lu of %lu blocks mixed, %lu bytes\n",
+          tbl->name, (unsigned long)mixed, (unsigned long)BLOCK_CT,
+          (unsigned long)(BLOCK_CT*sizeof(u16)
+                          + mixed*CHESS_BITBASE_BLOCK_WORDS*sizeof(u32)));
+  return BLOCK_CT*sizeof(u16)+mixed*CHESS_BITBASE_BLOCK_WORDS*sizeof(u32);
+}
+
+static void Bitbase_Usage(const char *argv0) {
+  fprintf(stderr, "usage: %s [-j threads] [-o out.c]\n", argv0);
+}
+
+int main(int argc, char *argv[]) {
+  static const ChessBitbase_e SOLVE_ORDER[CHESS_BITBASE_COUNT] = {
+    CHESS_BITBASE_KQK, CHESS_BITBASE_KRK, CHESS_BITBASE_KPK
+  };
+  long threads = sysconf(_SC_NPROCESSORS_ONLN);
+  const char *out_path = NULL;
+  FILE *out = stdout;
+  size_t total = 0;
+  for (int i = 1; argc>i; ++i) {
+    if (!strcmp(argv[i], "-j") && argc>i+1) {
+      threads = strtol(argv[++i], NULL, 10);
+    } else if (!strcmp(argv[i], "-o") && argc>i+1) {
+      out_path = argv[++i];
+    } else {
+      Bitbase_Usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (1>threads)
+    threads = 1;
+  if (BITBASE_GEN_MAX_THREADS<threads)
+    threads = BITBASE_GEN_MAX_THREADS;
+  for (u32 i = 0; CHESS_BITBASE_COUNT>i; ++i)
+    Bitbase_Solve(&g_tables[SOLVE_ORDER[i]], (u32)threads);
+
+  if (NULL!=out_path && NULL==(out = fopen(out_path, "w"))) {
+    perror(out_path);
+    return EXIT_FAILURE;
+  }
+  fprintf(out,
+      "//---------------------------------------------------------------\n"
+      "// Auto-gen'd endgame bitbases by bin/host/bitbase_gen. Regenerate\n"
+      "// with make bitbases instead of editing by hand.\n"
+      "//---------------------------------------------------------------\n"
+      "#include \"chess_bitbase.h\"\n\n");
+  for (u32 i = 0; CHESS_BITBASE_COUNT>i; ++i)
+    total += Bitbase_Write(&g_tables[i], out);
+  fprintf(out, "const ChessBitbase_t CHESS_BITBASES[CHESS_BITBASE_COUNT] = "
+               "{\n");
+  for (u32 i = 0; CHESS_BITBASE_COUNT>i; ++i)
+    fprintf(out, "  [CHESS_BITBASE_%s] = {%s_BLOCKS, %s_WORDS},\n",
+            g_tables[i].name, g_tables[i].name, g_tables[i].name);
+  fprintf(out, "};\n");
+  if (stdout!=out)
+    fclose(out);
+  fprintf(stderr, "bitbase_gen: %lu bytes in all\n", (unsigned long)total);
+  for (u32 i = 0; CHESS_BITBASE_COUNT>i; ++i) {
+    free(g_tables[i].won);
+    free(g_tables[i].legal);
+  }
+  return EXIT_SUCCESS;
+}
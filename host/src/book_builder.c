@@ -0,0 +1,405 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* Host-side opening book builder. Replays every game of a PGN corpus through
+ * BoardState_ApplyMove, the same as the engine's own board state, so the
+ * keys it records are exactly the ones ChessBook_Probe will look up. Each
+ * (position, move) pair seen in the first few plies of a game becomes one
+ * book entry, weighted by how many games played it, and the lot is written
+ * out as a C source of sorted ChessBook_Entry_t records for the ROM.
+ *
+ * Usage:
+ *   book_builder [-p max_plies] [-m min_games] [-o out.c] <pgn>...
+ */
+#define __TRANSPARENT_BOARD_STATE__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <GBAdev_types.h>
+#include "chess_ai_types.h"
+#include "chess_bitboard.h"
+#include "chess_board.h"
+#include "chess_board_state.h"
+#include "chess_board_state_analysis.h"
+#include "chess_move_gen.h"
+#include "chess_opening_book.h"
+
+#define STARTPOS_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+#define BOOK_DEFAULT_MAX_PLIES 20
+#define BOOK_DEFAULT_MIN_GAMES 1
+#define BOOK_SAN_MAX 16
+
+typedef struct s_book_record {
+  u64 key;
+  TTable_Move_t move;
+} Book_Record_t;
+
+typedef struct s_book_builder {
+  BoardState_t state;
+  ChessMoveList_t moves;
+  Book_Record_t *records;
+  size_t record_ct, record_cap;
+  u32 max_plies, min_games;
+  /* Per game: plies replayed so far, and whether the rest of its moves are
+   * being skipped (past max_plies, a FEN start, or a move that didn't
+   * parse). */
+  u32 ply;
+  BOOL skipping;
+  u32 games, bad_games;
+} Book_Builder_t;
+
+static void Book_NewGame(Book_Builder_t *bb) {
+  if (NULL==BoardState_FromFEN(&bb->state, STARTPOS_FEN)) {
+    fprintf(stderr, "book_builder: start position FEN rejected\n");
+    exit(EXIT_FAILURE);
+  }
+  bb->ply = 0;
+  bb->skipping = FALSE;
+}
+
+static void Book_AddRecord(Book_Builder_t *bb, u64 key, TTable_Move_t move) {
+  if (bb->record_ct==bb->record_cap) {
+    bb->record_cap = bb->record_cap ? 2*bb->record_cap : 4096;
+    bb->records = realloc(bb->records, bb->record_cap*sizeof(*bb->records));
+    if (NULL==bb->records) {
+      fprintf(stderr, "book_builder: out of memory\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  bb->records[bb->record_ct++] = (Book_Record_t){.key = key, .move = move};
+}
+
+/* Strip a generated move list down to the legal moves, the same check
+ * ChessBook_Probe makes. */
+static void Book_LegalMoves(Book_Builder_t *bb) {
+  BoardState_t *const state = &bb->state;
+  const u32 ALLIED_KING
+                = (state->state.side_to_move&WHITE_TO_MOVE_FLAGBIT
+                              ?PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT
+                              :0)|KING,
+            OPP_IDX_OFS = PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT&~ALLIED_KING;
+  BoardState_Undo_t undo;
+  u32 legal = 0;
+  ChessMoveGen_Generate(state, &bb->moves);
+  for (u32 i = 0; bb->moves.count>i; ++i) {
+    BoardState_MakeMove(state, &bb->moves.moves[i], &undo);
+    if (!BoardState_KingInCheck(state, ALLIED_KING, OPP_IDX_OFS))
+      bb->moves.moves[legal++] = bb->moves.moves[i];
+    BoardState_UnmakeMove(state, &undo);
+  }
+  bb->moves.count = legal;
+}
+
+static ChessPiece_e Book_PieceFromChar(char c) {
+  switch (c) {
+  case 'N':
+    return KNIGHT_IDX;
+  case 'B':
+    return BISHOP_IDX;
+  case 'R':
+    return ROOK_IDX;
+  case 'Q':
+    return QUEEN_IDX;
+  case 'K':
+    return KING_IDX;
+  default:
+    return EMPTY_IDX;
+  }
+}
+
+/* Find the one legal move SAN describes.
+ * @return The move, or NULL if none or more than one fits. */
+static const ChessMove_t *Book_MatchSAN(Book_Builder_t *bb, const char *san) {
+  char buf[BOOK_SAN_MAX], body[BOOK_SAN_MAX];
+  const ChessMove_t *found = NULL;
+  Move_Validation_Flag_e castle = 0;
+  ChessPiece_e piece = PAWN_IDX, promo = 0;
+  int len, body_len = 0, dst_x = -1, dst_y = -1, from_x = -1, from_y = -1;
+  len = snprintf(buf, sizeof(buf), "%s", san);
+  if ((int)sizeof(buf)<=len)
+    return NULL;
+  while (len && strchr("+#!?", buf[len-1]))
+    buf[--len] = '\0';
+  if (!strcmp(buf, "O-O-O") || !strcmp(buf, "0-0-0")) {
+    castle = MOVE_CASTLE_QUEENSIDE;
+  } else if (!strcmp(buf, "O-O") || !strcmp(buf, "0-0")) {
+    castle = MOVE_CASTLE_KINGSIDE;
+  } else {
+    const char *c = buf;
+    if (EMPTY_IDX!=Book_PieceFromChar(*c))
+      piece = Book_PieceFromChar(*c++);
+    for (; *c; ++c) {
+      if ('='==*c || (PAWN_IDX==piece && EMPTY_IDX!=Book_PieceFromChar(*c))) {
+        promo = Book_PieceFromChar(c['='==*c]);
+        if (EMPTY_IDX==promo || KING_IDX==promo)
+          return NULL;
+        break;
+      }
+      if ('x'!=*c && '-'!=*c && ':'!=*c)
+        body[body_len++] = *c;
+    }
+    // The destination is the last square named, anything before it narrows
+    // down which piece moves there.
+    if (2>body_len || 4<body_len)
+      return NULL;
+    dst_x = body[body_len-2]-'a';
+    dst_y = '8'-body[body_len-1];
+    if (0>dst_x || 7<dst_x || 0>dst_y || 7<dst_y)
+      return NULL;
+    for (int i = 0; body_len-2>i; ++i) {
+      if ('a'<=body[i] && 'h'>=body[i])
+        from_x = body[i]-'a';
+      else if ('1'<=body[i] && '8'>=body[i])
+        from_y = '8'-body[i];
+      else
+        return NULL;
+    }
+  }
+
+  Book_LegalMoves(bb);
+  for (u32 i = 0; bb->moves.count>i; ++i) {
+    const ChessMove_t *MV = &bb->moves.moves[i];
+    if (castle) {
+      if (!(castle&MV->flags))
+        continue;
+    } else if (MOVE_CASTLE_MOVE_FLAGS_MASK&MV->flags
+               || piece!=(PIECE_IDX_MASK
+                           &bb->state.board[BOARD_IDX(MV->start)])
+               || dst_x!=MV->dst.coord.x || dst_y!=MV->dst.coord.y
+               || (0<=from_x && from_x!=MV->start.coord.x)
+               || (0<=from_y && from_y!=MV->start.coord.y)
+               || promo!=MV->promotion) {
+      continue;
+    }
+    if (NULL!=found)
+      return NULL;
+    found = MV;
+  }
+  return found;
+}
+
+static void Book_PlaySAN(Book_Builder_t *bb, const char *san) {
+  const ChessMove_t *mv;
+  ChessMoveIteration_t move_data;
+  if (bb->skipping)
+    return;
+  if (bb->max_plies<=bb->ply) {
+    bb->skipping = TRUE;
+    return;
+  }
+  if (NULL==(mv = Book_MatchSAN(bb, san))) {
+    fprintf(stderr, "book_builder: game %lu, ply %lu: can't play \"%s\", "
+                    "skipping the rest of the game\n",
+            (unsigned long)bb->games+1, (unsigned long)bb->ply+1, san);
+    ++bb->bad_games;
+    bb->skipping = TRUE;
+    return;
+  }
+  Book_AddRecord(bb,
+                 bb->state.zobrist,
+                 TTABLE_MOVE_PACK(BB_SQ_FROM_COMPACT(mv->start),
+                                  BB_SQ_FROM_COMPACT(mv->dst),
+                                  mv->promotion));
+  move_data = (ChessMoveIteration_t) {
+    .dst = BOARD_IDX_CONVERT(mv->dst, NORMAL_IDX_TYPE),
+    .promotion_flag = mv->promotion,
+    .special_flags = mv->flags,
+  };
+  BoardState_ApplyMove(&bb->state, &move_data, mv->start);
+  ++bb->ply;
+}
+
+static void Book_EndGame(Book_Builder_t *bb, BOOL played) {
+  if (played)
+    ++bb->games;
+  Book_NewGame(bb);
+}
+
+/* Walk one PGN file's tags, comments, variations, move numbers and results,
+ * handing every SAN move of the main line to Book_PlaySAN. */
+static BOOL Book_ReadPGN(Book_Builder_t *bb, const char *path) {
+  FILE *fp = fopen(path, "r");
+  char tok[64];
+  int c, depth;
+  size_t len;
+  BOOL in_moves = FALSE;
+  if (NULL==fp) {
+    perror(path);
+    return FALSE;
+  }
+  while (EOF!=(c = fgetc(fp))) {
+    switch (c) {
+    case '[':
+      // A tag after movetext means the last game had no result token.
+      if (in_moves) {
+        Book_EndGame(bb, TRUE);
+        in_moves = FALSE;
+      }
+      for (len = 0; EOF!=(c = fgetc(fp)) && ']'!=c; )
+        if (sizeof(tok)-1>len)
+          tok[len++] = (char)c;
+      tok[len] = '\0';
+      // Games from a set up position don't start where the book does.
+      if (!strncmp(tok, "FEN ", 4))
+        bb->skipping = TRUE;
+      continue;
+    case '{':
+      while (EOF!=(c = fgetc(fp)) && '}'!=c)
+        continue;
+      continue;
+    case ';':
+    case '%':
+      while (EOF!=(c = fgetc(fp)) && '\n'!=c)
+        continue;
+      continue;
+    case '(':
+      for (depth = 1; depth && EOF!=(c = fgetc(fp)); )
+        depth += '('==c ? 1 : ')'==c ? -1 : 0;
+      continue;
+    default:
+      break;
+    }
+    if (' '==c || '\t'==c || '\n'==c || '\r'==c || ')'==c)
+      continue;
+    tok[0] = (char)c;
+    for (len = 1; EOF!=(c = fgetc(fp)) && !strchr(" \t\r\n{}()[];", c); )
+      if (sizeof(tok)-1>len)
+        tok[len++] = (char)c;
+    tok[len] = '\0';
+    if (EOF!=c)
+      ungetc(c, fp);
+    if ('$'==tok[0])
+      continue;
+    if (!strcmp(tok, "1-0") || !strcmp(tok, "0-1")
+        || !strcmp(tok, "1/2-1/2") || !strcmp(tok, "*")) {
+      Book_EndGame(bb, TRUE);
+      in_moves = FALSE;
+      continue;
+    }
+    in_moves = TRUE;
+    // Move numbers ("12." or "12..."), possibly run into the move itself.
+    {
+      const char *san = tok;
+      while ('0'<=*san && '9'>=*san)
+        ++san;
+      while ('.'==*san)
+        ++san;
+      if (*san)
+        Book_PlaySAN(bb, san);
+    }
+  }
+  if (in_moves)
+    Book_EndGame(bb, TRUE);
+  fclose(fp);
+  return TRUE;
+}
+
+static int Book_CompareRecords(const void *a, const void *b) {
+  const Book_Record_t *ra = a, *rb = b;
+  if (ra->key!=rb->key)
+    return ra->key<rb->key ? -1 : 1;
+  return (int)ra->move-(int)rb->move;
+}
+
+/* Sort, merge duplicates into weights and print the book as C source. The
+ * sort order on the u64 key is the same as ChessBook_LowerBound's (hi, lo)
+ * order. */
+static void Book_Write(Book_Builder_t *bb, FILE *out, int argc, char *argv[],
+                       int first_pgn) {
+  size_t entries = 0, positions = 0;
+  qsort(bb->records, bb->record_ct, sizeof(*bb->records),
+        Book_CompareRecords);
+  fprintf(out,
+      "//---------------------------------------------------------------\n"
+      "// Auto-gen'd opening book by bin/host/book_builder. Regenerate with\n"
+      "// make book instead of editing by hand.\n"
+      "// ==============================================================\n"
+      "// Built from:");
+  for (int i = first_pgn; argc>i; ++i)
+    fprintf(out, " %s", argv[i]);
+  fprintf(out,
+      "\n// \tGames: %lu, Max plies: %lu, Min games per move: %lu\n"
+      "//---------------------------------------------------------------\n"
+      "#include \"chess_opening_book.h\"\n\n"
+      "/* {key_lo, key_hi, move, weight} */\n"
+      "const ChessBook_Entry_t CHESS_OPENING_BOOK[] = {\n",
+      (unsigned long)bb->games,
+      (unsigned long)bb->max_plies,
+      (unsigned long)bb->min_games);
+  for (size_t i = 0, run; bb->record_ct>i; i += run) {
+    for (run = 1;
+         bb->record_ct>i+run
+           && 0==Book_CompareRecords(&bb->records[i], &bb->records[i+run]);
+         ++run)
+      continue;
+    if (bb->min_games>run)
+      continue;
+    if (0==entries || bb->records[i].key!=bb->records[i-1].key)
+      ++positions;
+    fprintf(out, "  {0x%08lXUL, 0x%08lXUL, 0x%04X, %5lu},\n",
+            (unsigned long)(u32)bb->records[i].key,
+            (unsigned long)(u32)(bb->records[i].key>>32),
+            bb->records[i].move,
+            (unsigned long)(0xFFFF<run ? 0xFFFF : run));
+    ++entries;
+  }
+  // An empty initializer isn't valid C, and a zero weight entry never gets
+  // picked.
+  if (0==entries)
+    fprintf(out, "  {0, 0, TTABLE_MOVE_NONE, 0},\n");
+  fprintf(out,
+      "};\n"
+      "const u32 CHESS_OPENING_BOOK_SIZE\n"
+      "  = sizeof(CHESS_OPENING_BOOK)/sizeof(CHESS_OPENING_BOOK[0]);\n");
+  fprintf(stderr, "book_builder: %lu games (%lu cut short), %lu positions, "
+                  "%lu entries (%lu bytes)\n",
+          (unsigned long)bb->games, (unsigned long)bb->bad_games,
+          (unsigned long)positions, (unsigned long)entries,
+          (unsigned long)(entries*sizeof(ChessBook_Entry_t)));
+}
+
+static void Book_Usage(const char *argv0) {
+  fprintf(stderr,
+      "usage: %s [-p max_plies] [-m min_games] [-o out.c] <pgn>...\n",
+      argv0);
+}
+
+int main(int argc, char *argv[]) {
+  static Book_Builder_t bb = {
+    .max_plies = BOOK_DEFAULT_MAX_PLIES,
+    .min_games = BOOK_DEFAULT_MIN_GAMES,
+  };
+  const char *out_path = NULL;
+  FILE *out = stdout;
+  int i;
+  for (i = 1; argc>i && '-'==argv[i][0]; ++i) {
+    if (!strcmp(argv[i], "-p") && argc>i+1) {
+      bb.max_plies = strtoul(argv[++i], NULL, 10);
+    } else if (!strcmp(argv[i], "-m") && argc>i+1) {
+      bb.min_games = strtoul(argv[++i], NULL, 10);
+    } else if (!strcmp(argv[i], "-o") && argc>i+1) {
+      out_path = argv[++i];
+    } else {
+      Book_Usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (argc==i || 0==bb.min_games) {
+    Book_Usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  Book_NewGame(&bb);
+  for (int f = i; argc>f; ++f)
+    if (!Book_ReadPGN(&bb, argv[f]))
+      return EXIT_FAILURE;
+  if (NULL!=out_path && NULL==(out = fopen(out_path, "w"))) {
+    perror(out_path);
+    return EXIT_FAILURE;
+  }
+  Book_Write(&bb, out, argc, argv, i);
+  if (stdout!=out)
+    fclose(out);
+  free(bb.records);
+  return EXIT_SUCCESS;
+}
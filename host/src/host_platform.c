@@ -0,0 +1,124 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* Host (Linux) implementations of the libGBA_Dev and debug_io routines the
+ * engine sources link against. */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <GBAdev_types.h>
+#include <GBAdev_functions.h>
+#include "chess_board.h"
+#include "chess_clock.h"
+#include "debug_io.h"
+
+/* Monotonic time, in ChessClock ticks, at the last ChessClock_Start. */
+static u64 _L_clock_base;
+
+static u64 Host_MonotonicTicks(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (u64)ts.tv_sec*CHESS_CLOCK_TICKS_PER_SEC
+       + ((u64)ts.tv_nsec*CHESS_CLOCK_TICKS_PER_SEC)/1000000000UL;
+}
+
+void ChessClock_Start(void) {
+  _L_clock_base = Host_MonotonicTicks();
+}
+
+u32 ChessClock_Ticks(void) {
+  return (u32)(Host_MonotonicTicks()-_L_clock_base);
+}
+
+void Fast_Memcpy32(void *dst, const void *src, u32 word_ct) {
+  memcpy(dst, src, word_ct*sizeof(WORD));
+}
+
+void Fast_Memset32(void *dst, u32 fill_word, u32 word_ct) {
+  WORD *d = dst;
+  while (word_ct--)
+    *d++ = fill_word;
+}
+
+BOOL OAM_Init(__INTENT__(UNUSED) Obj_Attr_t *obj_attrs,
+              __INTENT__(UNUSED) u32 count) {
+  return TRUE;
+}
+
+const char *DebugIO_ChessPiece_ToString(ChessPiece_e piece) {
+  switch (piece) {
+  case WHITE_PAWN:
+    return "WHITE_PAWN";
+  case BLACK_PAWN:
+    return "BLACK_PAWN";
+  case BLACK_BISHOP:
+    return "BLACK_BISHOP";
+  case BLACK_ROOK:
+    return "BLACK_ROOK";
+  case BLACK_KNIGHT:
+    return "BLACK_KNIGHT";
+  case BLACK_QUEEN:
+    return "BLACK_QUEEN";
+  case BLACK_KING:
+    return "BLACK_KING";
+  case WHITE_BISHOP:
+    return "WHITE_BISHOP";
+  case WHITE_ROOK:
+    return "WHITE_ROOK";
+  case WHITE_KNIGHT:
+    return "WHITE_KNIGHT";
+  case WHITE_QUEEN:
+    return "WHITE_QUEEN";
+  case WHITE_KING:
+    return "WHITE_KING";
+  default:
+    return "INVALID_VALUE";
+  }
+}
+
+/* Mode 3 color escapes (\x1b[0xRRRR]) mean nothing to a terminal, so strip
+ * them before writing to stderr. */
+static void Host_PrintStripped(const char *s) {
+  for (; *s; ++s) {
+    if ('\x1b'==s[0] && '['==s[1]) {
+      const char *end = strchr(s, ']');
+      if (NULL!=end) {
+        s = end;
+        continue;
+      }
+    }
+    fputc(*s, stderr);
+  }
+}
+
+static void Host_VDebugPrintf(const char *func, u32 line,
+                              const char *fmt, va_list args) {
+  char buf[1024];
+  vsnprintf(buf, sizeof(buf), fmt, args);
+  fprintf(stderr, "[Error @ %s:%lu]: ", func, (unsigned long)line);
+  Host_PrintStripped(buf);
+  fputc('\n', stderr);
+}
+
+__attribute__ (( __format__ ( __printf__, 3, 4 ), __noreturn__ ))
+void Debug_PrintfAndExitInternal(const char *__restrict func, u32 line,
+                                 const char *__restrict fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  Host_VDebugPrintf(func, line, fmt, args);
+  va_end(args);
+  exit(EXIT_FAILURE);
+}
+
+PRINTF_LIKE(3, 4) void Debug_PrintfInternal(const char *__restrict func,
+                                                               u32 line,
+                                             const char *__restrict fmt,
+                                                                    ...) {
+  va_list args;
+  va_start(args, fmt);
+  Host_VDebugPrintf(func, line, fmt, args);
+  va_end(args);
+}
@@ -0,0 +1,238 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* Host-side perft harness. Walks the move tree with the exact same pipeline
+ * ChessAI_ABSearch uses (side-wide move generation -> MakeMove -> KingInCheck
+ * rejection), so any node count mismatch against the reference numbers is a
+ * move generation bug the search would be running into as well.
+ *
+ * Usage:
+ *   perft [-d depth] [--divide] [--fen "<fen>"]
+ *   perft --suite [-d max_depth]
+ */
+#define __TRANSPARENT_BOARD_STATE__
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <GBAdev_types.h>
+#include "chess_ai_types.h"
+#include "chess_board.h"
+#include "chess_board_state.h"
+#include "chess_board_state_analysis.h"
+#include "chess_move_gen.h"
+
+#define STARTPOS_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+#define PERFT_MAX_REF_DEPTH 6
+
+typedef struct s_perft_ref_pos {
+  const char *name;
+  const char *fen;
+  u64 nodes[PERFT_MAX_REF_DEPTH];  /* nodes[d-1] = perft(d), 0 = unlisted */
+} Perft_RefPos_t;
+
+static const Perft_RefPos_t PERFT_REF_POSITIONS[] = {
+  {
+    "startpos",
+    STARTPOS_FEN,
+    {20ULL, 400ULL, 8902ULL, 197281ULL, 4865609ULL, 119060324ULL}
+  },
+  {
+    "kiwipete",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    {48ULL, 2039ULL, 97862ULL, 4085603ULL, 193690690ULL, 0ULL}
+  },
+  {
+    "position3",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+    {14ULL, 191ULL, 2812ULL, 43238ULL, 674624ULL, 11030083ULL}
+  },
+  {
+    "position4",
+    "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+    {6ULL, 264ULL, 9467ULL, 422333ULL, 15833292ULL, 0ULL}
+  },
+  {
+    "position5",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    {44ULL, 1486ULL, 62379ULL, 2103487ULL, 89941194ULL, 0ULL}
+  },
+  {
+    "position6",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+    {46ULL, 2079ULL, 89890ULL, 3894594ULL, 164075551ULL, 0ULL}
+  },
+};
+#define PERFT_REF_POSITION_COUNT\
+  (sizeof(PERFT_REF_POSITIONS)/sizeof(PERFT_REF_POSITIONS[0]))
+
+/* The undo stack behind BoardState_MakeMove is sized for MAX_SEARCH_PLY, so
+ * that is the bound here too. */
+#define PERFT_MAX_DEPTH MAX_SEARCH_PLY
+
+static double Perft_Now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+static void Perft_MoveToString(char *dst, const ChessMove_t *mv) {
+  static const char PROMO_CHARS[] = {
+    [BISHOP_IDX]='b', [ROOK_IDX]='r', [KNIGHT_IDX]='n', [QUEEN_IDX]='q'
+  };
+  *dst++ = 'a' + mv->start.coord.x;
+  *dst++ = '8' - mv->start.coord.y;
+  *dst++ = 'a' + mv->dst.coord.x;
+  *dst++ = '8' - mv->dst.coord.y;
+  if (mv->promotion)
+    *dst++ = PROMO_CHARS[mv->promotion&PIECE_IDX_MASK];
+  *dst = '\0';
+}
+
+static ChessMoveList_t g_perft_move_lists[PERFT_MAX_DEPTH];
+
+/* Mirrors the move loop of ChessAI_ABSearch, making and unmaking moves on root
+ * in place. If divide is set, prints the subtree size of each legal root move.
+ */
+static u64 Perft(BoardState_t *root, u32 depth, u32 ply, BOOL divide) {
+  BoardState_Undo_t undo;
+#ifdef _DEBUG_BUILD_
+  const BoardState_t BEFORE = *root;
+#endif
+  ChessMoveList_t *const moves = &g_perft_move_lists[ply];
+  const u32 ALLIED_KING
+                = (root->state.side_to_move&WHITE_TO_MOVE_FLAGBIT
+                              ?PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT
+                              :0)|KING,
+            OPP_IDX_OFS = PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT&~ALLIED_KING;
+  u64 nodes = 0, subtree;
+  char mvstr[6];
+
+  ChessMoveGen_Generate(root, moves);
+  for (u32 i = 0; moves->count>i; ++i) {
+    const ChessMove_t *mv = &moves->moves[i];
+    BoardState_MakeMove(root, mv, &undo);
+    if (BoardState_KingInCheck(root, ALLIED_KING, OPP_IDX_OFS)) {
+      BoardState_UnmakeMove(root, &undo);
+      continue;
+    }
+    subtree = (1<depth) ? Perft(root, depth-1, ply+1, FALSE) : 1ULL;
+    BoardState_UnmakeMove(root, &undo);
+#ifdef _DEBUG_BUILD_
+    if (memcmp(&BEFORE, root, sizeof(BEFORE))) {
+      Perft_MoveToString(mvstr, mv);
+      fprintf(stderr, "perft: unmaking %s did not restore the board state.\n",
+              mvstr);
+      exit(EXIT_FAILURE);
+    }
+#endif
+    if (divide) {
+      Perft_MoveToString(mvstr, mv);
+      printf("%s: %llu\n", mvstr, (unsigned long long)subtree);
+    }
+    nodes += subtree;
+  }
+  return nodes;
+}
+
+static u64 Perft_Run(BoardState_t *root, u32 depth, BOOL divide,
+                     double *elapsed) {
+  double start = Perft_Now();
+  u64 nodes = Perft(root, depth, 0, divide);
+  *elapsed = Perft_Now() - start;
+  return nodes;
+}
+
+static void Perft_PrintStats(u32 depth, u64 nodes, double elapsed) {
+  printf("depth %lu: %llu nodes, %.3fs, %.0f nps\n",
+         (unsigned long)depth,
+         (unsigned long long)nodes,
+         elapsed,
+         elapsed>0.0 ? (double)nodes/elapsed : 0.0);
+}
+
+static int Perft_Suite(u32 max_depth) {
+  BoardState_t root;
+  u64 nodes, total = 0;
+  double elapsed, total_elapsed = 0.0;
+  int failures = 0;
+  for (u32 p = 0; PERFT_REF_POSITION_COUNT>p; ++p) {
+    const Perft_RefPos_t *ref = &PERFT_REF_POSITIONS[p];
+    if (NULL==BoardState_FromFEN(&root, ref->fen)) {
+      printf("%-10s FEN rejected\n", ref->name);
+      ++failures;
+      continue;
+    }
+    for (u32 d = 1; max_depth>=d && PERFT_MAX_REF_DEPTH>=d; ++d) {
+      if (0ULL==ref->nodes[d-1])
+        break;
+      nodes = Perft_Run(&root, d, FALSE, &elapsed);
+      total += nodes;
+      total_elapsed += elapsed;
+      printf("%-10s d=%lu %12llu %s", ref->name, (unsigned long)d,
+             (unsigned long long)nodes,
+             nodes==ref->nodes[d-1] ? "ok" : "MISMATCH");
+      if (nodes!=ref->nodes[d-1]) {
+        printf(" (expected %llu)", (unsigned long long)ref->nodes[d-1]);
+        ++failures;
+      }
+      printf("  %.3fs\n", elapsed);
+    }
+  }
+  printf("total: %llu nodes, %.3fs, %.0f nps, %d failure(s)\n",
+         (unsigned long long)total,
+         total_elapsed,
+         total_elapsed>0.0 ? (double)total/total_elapsed : 0.0,
+         failures);
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static void Perft_Usage(const char *argv0) {
+  fprintf(stderr,
+      "usage: %s [-d depth] [--divide] [--fen \"<fen>\"]\n"
+      "       %s --suite [-d max_depth]\n",
+      argv0, argv0);
+}
+
+int main(int argc, char *argv[]) {
+  BoardState_t root;
+  const char *fen = STARTPOS_FEN;
+  u32 depth = 0;
+  BOOL divide = FALSE, suite = FALSE;
+  u64 nodes;
+  double elapsed;
+  for (int i = 1; argc>i; ++i) {
+    if (!strcmp(argv[i], "-d") && argc>i+1) {
+      depth = strtoul(argv[++i], NULL, 10);
+    } else if (!strcmp(argv[i], "--fen") && argc>i+1) {
+      fen = argv[++i];
+    } else if (!strcmp(argv[i], "--divide")) {
+      divide = TRUE;
+    } else if (!strcmp(argv[i], "--suite")) {
+      suite = TRUE;
+    } else {
+      Perft_Usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (0==depth)
+    depth = suite ? 3 : 5;
+  if (PERFT_MAX_DEPTH<depth) {
+    fprintf(stderr, "perft: depth %lu exceeds MAX_SEARCH_PLY (%d). Rebuild "
+                    "with MACROS=-DMAX_DEPTH=<n> for deeper runs.\n",
+            (unsigned long)depth, PERFT_MAX_DEPTH);
+    return EXIT_FAILURE;
+  }
+  if (suite)
+    return Perft_Suite(depth);
+  if (NULL==BoardState_FromFEN(&root, fen)) {
+    fprintf(stderr, "perft: could not parse FEN \"%s\"\n", fen);
+    return EXIT_FAILURE;
+  }
+  nodes = Perft_Run(&root, depth, divide, &elapsed);
+  if (divide)
+    putchar('\n');
+  Perft_PrintStats(depth, nodes, elapsed);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,398 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* Host-side UCI front-end, so the engine can be run under chess GUIs and
+ * match runners. The search runs on a worker thread through
+ * ChessAI_MoveBegin/Step/End, a few milliseconds per step, and in between
+ * steps the worker reports each finished iteration and acts on whatever the
+ * main thread has asked for (stop, ponderhit) or the node limit.
+ *
+ * Supported: uci, isready, setoption (OwnBook), ucinewgame,
+ *   position [startpos | fen <fen>] [moves <move>...],
+ *   go [depth <n>] [nodes <n>] [movetime <ms>] [wtime <ms>] [btime <ms>]
+ *      [winc <ms>] [binc <ms>] [infinite] [ponder],
+ *   stop, ponderhit, quit.
+ */
+#define __TRANSPARENT_BOARD_STATE__
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <GBAdev_types.h>
+#include "chess_ai_types.h"
+#include "chess_ai.h"
+#include "chess_board.h"
+#include "chess_board_state.h"
+#include "chess_board_state_analysis.h"
+#include "chess_clock.h"
+#include "chess_move_gen.h"
+#include "chess_transposition_table.h"
+
+#define STARTPOS_FEN "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+#define UCI_ENGINE_NAME "GBA_Chess_Engine"
+#define UCI_ENGINE_AUTHOR "Burt Sumner"
+/* Long enough for a position command replaying a whole long game. */
+#define UCI_LINE_MAX 16384
+#define UCI_FEN_MAX 128
+#define UCI_MOVE_STR_MAX 6
+#define UCI_SLICE_TICKS CHESS_CLOCK_MS_TO_TICKS(5)
+/* Keeps deadlines well inside the range CHESS_CLOCK_EXPIRED can compare. */
+#define UCI_MAX_BUDGET_TICKS (CHESS_CLOCK_TICKS_PER_SEC*3600UL)
+
+typedef struct s_uci_limits {
+  /* Plies, clamped to MAX_DEPTH. */
+  u32 depth;
+  /* Nodes (quiescence ones included), 0 = no limit. */
+  u64 nodes;
+  /* Ticks to spend once the search is on its own time, 0 = no limit. */
+  u32 budget;
+  /* Both hold bestmove back until stop (or ponderhit, when pondering). */
+  BOOL infinite, ponder;
+} Uci_Limits_t;
+
+typedef struct s_uci_engine {
+  /* Owned by the worker while searching is set. The main thread joins it
+   * before touching either. */
+  BoardState_t root;
+  ChessAI_Params_t ai;
+  Uci_Limits_t limits;
+  pthread_t worker;
+  BOOL searching;
+  BOOL own_book;
+  atomic_bool stop, ponderhit;
+} Uci_Engine_t;
+
+static Uci_Engine_t g_uci;
+
+static void Uci_MoveToString(char *dst, const ChessMove_t *mv) {
+  static const char PROMO_CHARS[] = {
+    [BISHOP_IDX]='b', [ROOK_IDX]='r', [KNIGHT_IDX]='n', [QUEEN_IDX]='q'
+  };
+  *dst++ = 'a' + mv->start.coord.x;
+  *dst++ = '8' - mv->start.coord.y;
+  *dst++ = 'a' + mv->dst.coord.x;
+  *dst++ = '8' - mv->dst.coord.y;
+  if (mv->promotion)
+    *dst++ = PROMO_CHARS[mv->promotion&PIECE_IDX_MASK];
+  *dst = '\0';
+}
+
+static u32 Uci_MsToTicks(u64 ms) {
+  const u64 TICKS = ms*CHESS_CLOCK_TICKS_PER_SEC/1000UL;
+  return TICKS>UCI_MAX_BUDGET_TICKS ? UCI_MAX_BUDGET_TICKS : (u32)TICKS;
+}
+
+/* Strip a generated move list down to the legal moves. */
+static void Uci_LegalMoves(BoardState_t *state, ChessMoveList_t *moves) {
+  const u32 ALLIED_KING
+                = (state->state.side_to_move&WHITE_TO_MOVE_FLAGBIT
+                              ?PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT
+                              :0)|KING,
+            OPP_IDX_OFS = PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT&~ALLIED_KING;
+  BoardState_Undo_t undo;
+  u32 legal = 0;
+  ChessMoveGen_Generate(state, moves);
+  for (u32 i = 0; moves->count>i; ++i) {
+    BoardState_MakeMove(state, &moves->moves[i], &undo);
+    if (!BoardState_KingInCheck(state, ALLIED_KING, OPP_IDX_OFS))
+      moves->moves[legal++] = moves->moves[i];
+    BoardState_UnmakeMove(state, &undo);
+  }
+  moves->count = legal;
+}
+
+/* Play a move given in UCI's long algebraic notation (e.g.: e2e4, e7e8q) on
+ * the game. FALSE if it isn't legal there. */
+static BOOL Uci_PlayMove(Uci_Engine_t *e, const char *str) {
+  static ChessMoveList_t moves;
+  char mvstr[UCI_MOVE_STR_MAX];
+  Uci_LegalMoves(&e->root, &moves);
+  for (u32 i = 0; moves.count>i; ++i) {
+    const ChessMove_t *const MV = &moves.moves[i];
+    Uci_MoveToString(mvstr, MV);
+    if (strcmp(mvstr, str))
+      continue;
+    BoardState_ApplyMove(&e->root,
+                         &(ChessMoveIteration_t) {
+                           .dst = BOARD_IDX_CONVERT(MV->dst, NORMAL_IDX_TYPE),
+                           .promotion_flag = MV->promotion,
+                           .special_flags = MV->flags,
+                         },
+                         MV->start);
+    ChessAI_RecordGamePosition(&e->ai);
+    return TRUE;
+  }
+  return FALSE;
+}
+
+/* Scores come out of the search from white's point of view, but UCI wants
+ * them from the side to move's, and mates in moves rather than plies. */
+static void Uci_ScoreToString(char *dst, size_t size, i16 score,
+                              BOOL white_to_move) {
+  const int SCORE = white_to_move ? score : -score;
+  if (CHESS_AI_IS_MATE_SCORE(SCORE)) {
+    const int PLIES = CHESS_AI_MATE_SCORE-(0>SCORE ? -SCORE : SCORE);
+    snprintf(dst, size, "mate %d",
+             0<SCORE ? (PLIES+1)/2 : -(PLIES+1)/2);
+  } else {
+    snprintf(dst, size, "cp %d", SCORE);
+  }
+}
+
+static void Uci_ReportIteration(Uci_Engine_t *e, u32 start) {
+  const ChessAI_Params_t *const AI = &e->ai;
+  const u64 NODES = (u64)AI->nodes+AI->qnodes,
+            MS = CHESS_CLOCK_TICKS_TO_MS(ChessClock_Ticks()-start);
+  char score[16], mvstr[UCI_MOVE_STR_MAX];
+  Uci_ScoreToString(score, sizeof(score), AI->completed_score,
+                    0!=(e->root.state.side_to_move&WHITE_TO_MOVE_FLAGBIT));
+  printf("info depth %lu score %s nodes %llu nps %llu hashfull %lu time %llu "
+         "pv",
+         (unsigned long)AI->completed_depth,
+         score,
+         (unsigned long long)NODES,
+         (unsigned long long)(MS ? NODES*1000UL/MS : NODES*1000UL),
+         (unsigned long)TTable_Usage(AI->ttable),
+         (unsigned long long)MS);
+  for (u32 i = 0; AI->pv_length>i; ++i) {
+    Uci_MoveToString(mvstr, &AI->pv[i]);
+    printf(" %s", mvstr);
+  }
+  putchar('\n');
+  fflush(stdout);
+}
+
+static void *Uci_Search(void *arg) {
+  Uci_Engine_t *const e = arg;
+  ChessAI_Params_t *const ai = &e->ai;
+  const u32 START = ChessClock_Ticks();
+  const struct timespec NAP = {.tv_sec = 0, .tv_nsec = 1000000L};
+  ChessAI_MoveSearch_Result_t best;
+  BOOL pondering = e->limits.ponder, done;
+  u16 reported = 0;
+  char mvstr[UCI_MOVE_STR_MAX];
+  ChessAI_MoveBegin(ai);
+  do {
+    done = ChessAI_MoveStep(ai, UCI_SLICE_TICKS);
+    if (ai->completed_depth>reported) {
+      reported = ai->completed_depth;
+      Uci_ReportIteration(e, START);
+    }
+    // The opponent played the move pondered on, so from here on the search
+    // runs on this move's own time.
+    if (pondering && atomic_load(&e->ponderhit)) {
+      pondering = FALSE;
+      if (e->limits.budget)
+        ChessAI_MoveRestartClock(ai, e->limits.budget);
+    }
+    if (atomic_load(&e->stop)
+        || (e->limits.nodes && ai->nodes+ai->qnodes>=e->limits.nodes))
+      ChessAI_MoveAbort(ai);
+  } while (!done);
+  ChessAI_MoveEnd(ai, &best);
+  if (0==reported && ai->pv_length)
+    printf("info string book move\n");
+  while ((e->limits.infinite || pondering) && !atomic_load(&e->stop)) {
+    if (pondering && atomic_load(&e->ponderhit))
+      pondering = FALSE;
+    else
+      nanosleep(&NAP, NULL);
+  }
+  if (INVALID_IDX_COMPACT_RAW==best.start.raw) {
+    printf("bestmove 0000\n");
+  } else {
+    Uci_MoveToString(mvstr, &(ChessMove_t) {
+                              .start = best.start,
+                              .dst = best.dst,
+                              .flags = best.mv_flags,
+                              .promotion = best.promo,
+                            });
+    printf("bestmove %s", mvstr);
+    if (INVALID_IDX_COMPACT_RAW!=ai->ponder_move.start.raw) {
+      Uci_MoveToString(mvstr, &ai->ponder_move);
+      printf(" ponder %s", mvstr);
+    }
+    putchar('\n');
+  }
+  fflush(stdout);
+  return NULL;
+}
+
+/* Wind down the search in progress, if any, once it has had its bestmove
+ * out. */
+static void Uci_StopSearch(Uci_Engine_t *e) {
+  if (!e->searching)
+    return;
+  atomic_store(&e->stop, TRUE);
+  pthread_join(e->worker, NULL);
+  e->searching = FALSE;
+}
+
+static void Uci_NewGame(Uci_Engine_t *e) {
+  if (NULL==BoardState_FromFEN(&e->root, STARTPOS_FEN)) {
+    fprintf(stderr, "uci: start position FEN rejected\n");
+    exit(EXIT_FAILURE);
+  }
+  ChessAI_Params_Init(&e->ai, &e->root, MAX_DEPTH, WHITE_FLAGBIT);
+}
+
+static void Uci_Position(Uci_Engine_t *e, char *args) {
+  char fen[UCI_FEN_MAX] = STARTPOS_FEN, *save, *tok;
+  tok = strtok_r(args, " \t", &save);
+  if (NULL!=tok && !strcmp(tok, "fen")) {
+    size_t len = 0;
+    fen[0] = '\0';
+    while (NULL!=(tok = strtok_r(NULL, " \t", &save))
+           && strcmp(tok, "moves"))
+      len += snprintf(fen+len, len<sizeof(fen) ? sizeof(fen)-len : 0,
+                      "%s%s", len ? " " : "", tok);
+  } else if (NULL!=tok) {
+    // startpos, which may be followed by moves.
+    tok = strtok_r(NULL, " \t", &save);
+  }
+  if (NULL==BoardState_FromFEN(&e->root, fen)) {
+    printf("info string bad FEN \"%s\", using the start position\n", fen);
+    BoardState_FromFEN(&e->root, STARTPOS_FEN);
+    tok = NULL;
+  }
+  // Nothing from before this position can repeat, as far as the search
+  // knows.
+  e->ai.key_count = 0;
+  ChessAI_RecordGamePosition(&e->ai);
+  if (NULL==tok || strcmp(tok, "moves"))
+    return;
+  while (NULL!=(tok = strtok_r(NULL, " \t", &save))) {
+    if (!Uci_PlayMove(e, tok)) {
+      printf("info string illegal move %s, ignoring the rest\n", tok);
+      return;
+    }
+  }
+}
+
+static void Uci_Go(Uci_Engine_t *e, char *args) {
+  const BOOL WHITE = 0!=(e->root.state.side_to_move&WHITE_TO_MOVE_FLAGBIT);
+  Uci_Limits_t limits = {.depth = MAX_DEPTH};
+  u64 movetime = 0, time[2] = {0, 0}, inc[2] = {0, 0};
+  char *save, *tok, *val;
+  for (tok = strtok_r(args, " \t", &save); NULL!=tok;
+       tok = strtok_r(NULL, " \t", &save)) {
+    if (!strcmp(tok, "infinite")) {
+      limits.infinite = TRUE;
+      continue;
+    }
+    if (!strcmp(tok, "ponder")) {
+      limits.ponder = TRUE;
+      continue;
+    }
+    if (NULL==(val = strtok_r(NULL, " \t", &save)))
+      break;
+    if (!strcmp(tok, "depth"))
+      limits.depth = strtoul(val, NULL, 10);
+    else if (!strcmp(tok, "nodes"))
+      limits.nodes = strtoull(val, NULL, 10);
+    else if (!strcmp(tok, "movetime"))
+      movetime = strtoull(val, NULL, 10);
+    else if (!strcmp(tok, "wtime"))
+      time[BB_WHITE_TEAM_IDX] = strtoull(val, NULL, 10);
+    else if (!strcmp(tok, "btime"))
+      time[BB_BLACK_TEAM_IDX] = strtoull(val, NULL, 10);
+    else if (!strcmp(tok, "winc"))
+      inc[BB_WHITE_TEAM_IDX] = strtoull(val, NULL, 10);
+    else if (!strcmp(tok, "binc"))
+      inc[BB_BLACK_TEAM_IDX] = strtoull(val, NULL, 10);
+    // movestogo and searchmoves aren't supported, and take their argument
+    // with them.
+  }
+  if (0==limits.depth || MAX_DEPTH<limits.depth)
+    limits.depth = MAX_DEPTH;
+  if (movetime) {
+    limits.budget = Uci_MsToTicks(movetime);
+  } else {
+    const u32 TEAM = WHITE ? BB_WHITE_TEAM_IDX : BB_BLACK_TEAM_IDX;
+    if (time[TEAM]) {
+      // Budgeted the same way as the ROM's game clock.
+      ChessGameClock_t clock = {.increment = Uci_MsToTicks(inc[TEAM])};
+      clock.remaining[TEAM] = Uci_MsToTicks(time[TEAM]);
+      limits.budget = ChessGameClock_MoveBudget(&clock, TEAM);
+    }
+  }
+  e->limits = limits;
+  e->ai.depth = limits.depth;
+  e->ai.time_budget = limits.infinite || limits.ponder ? 0 : limits.budget;
+  e->ai.book = e->own_book;
+  e->ai.team = CONVERT_CTX_MOVE_FLAG(WHITE ? WHITE_FLAGBIT : BLACK_FLAGBIT);
+  atomic_store(&e->stop, FALSE);
+  atomic_store(&e->ponderhit, FALSE);
+  if (pthread_create(&e->worker, NULL, Uci_Search, e)) {
+    fprintf(stderr, "uci: could not start the search thread\n");
+    exit(EXIT_FAILURE);
+  }
+  e->searching = TRUE;
+}
+
+static void Uci_SetOption(Uci_Engine_t *e, char *args) {
+  char *save, *tok, *name = NULL, *value = NULL;
+  for (tok = strtok_r(args, " \t", &save); NULL!=tok;
+       tok = strtok_r(NULL, " \t", &save)) {
+    if (!strcmp(tok, "name"))
+      name = strtok_r(NULL, " \t", &save);
+    else if (!strcmp(tok, "value"))
+      value = strtok_r(NULL, " \t", &save);
+  }
+  if (NULL==name || NULL==value)
+    return;
+  if (!strcasecmp(name, "OwnBook"))
+    e->own_book = !strcmp(value, "true");
+}
+
+int main(void) {
+  static char line[UCI_LINE_MAX], no_args[1];
+  Uci_Engine_t *const e = &g_uci;
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  ChessClock_Start();
+  e->own_book = TRUE;
+  Uci_NewGame(e);
+  while (NULL!=fgets(line, sizeof(line), stdin)) {
+    char *save, *cmd, *args;
+    line[strcspn(line, "\r\n")] = '\0';
+    if (NULL==(cmd = strtok_r(line, " \t", &save)))
+      continue;
+    args = strtok_r(NULL, "", &save);
+    if (NULL==args)
+      args = no_args;
+    if (!strcmp(cmd, "uci")) {
+      printf("id name " UCI_ENGINE_NAME "\n"
+             "id author " UCI_ENGINE_AUTHOR "\n"
+             "option name OwnBook type check default true\n"
+             "uciok\n");
+    } else if (!strcmp(cmd, "isready")) {
+      printf("readyok\n");
+    } else if (!strcmp(cmd, "setoption")) {
+      Uci_StopSearch(e);
+      Uci_SetOption(e, args);
+    } else if (!strcmp(cmd, "ucinewgame")) {
+      Uci_StopSearch(e);
+      Uci_NewGame(e);
+    } else if (!strcmp(cmd, "position")) {
+      Uci_StopSearch(e);
+      Uci_Position(e, args);
+    } else if (!strcmp(cmd, "go")) {
+      Uci_StopSearch(e);
+      Uci_Go(e, args);
+    } else if (!strcmp(cmd, "stop")) {
+      Uci_StopSearch(e);
+    } else if (!strcmp(cmd, "ponderhit")) {
+      atomic_store(&e->ponderhit, TRUE);
+    } else if (!strcmp(cmd, "quit")) {
+      break;
+    }
+    // Anything else is ignored, as UCI asks.
+    fflush(stdout);
+  }
+  Uci_StopSearch(e);
+  return EXIT_SUCCESS;
+}
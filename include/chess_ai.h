@@ -17,16 +17,116 @@ typedef struct s_board_state BoardState_t;
 typedef struct s_move_score ChessAI_MoveSearch_Result_t;
 
 
+/* Selective search features. All of them are on after ChessAI_Params_Init.
+ * Clear bits in ChessAI_Params_t.prune to compare node counts without them. */
+typedef enum e_chess_ai_prune_flag {
+  CHESS_AI_PRUNE_NONE=0,
+  CHESS_AI_PRUNE_NULL_MOVE=1,
+  CHESS_AI_PRUNE_LMR=2,
+  CHESS_AI_PRUNE_ALL=CHESS_AI_PRUNE_NULL_MOVE|CHESS_AI_PRUNE_LMR,
+} PACKED ChessAI_PruneFlag_e;
+
 typedef struct s_chess_ai_params {
   TranspositionTable_t *ttable;
   BoardState_t *root_state;
+  /* Nodes visited so far by the current ChessAI_Move call, with quiescence
+   * nodes counted separately. */
+  u32 nodes, qnodes;
+  /* Per-move search budget in ChessClock ticks (0 = search to full depth),
+   * and the tick ChessAI_Move turns it into for the current search. */
+  u32 time_budget, deadline;
+  /* Principal variation of the last finished iteration, root move first.
+   * The next iteration searches it first, ply by ply. */
+  ChessMove_t pv[MAX_DEPTH];
+  u8 pv_length;
+  /* Depth and score (white's point of view) of that iteration, so a caller
+   * stepping the search can report on it as it goes. completed_depth is 0
+   * until depth 1 is done. */
+  u16 completed_depth;
+  i16 completed_score;
+  /* Set while the node being searched lies on pv. */
+  BOOL follow_pv;
+  ChessAI_PruneFlag_e prune;
+  /* Play straight from the opening book (chess_opening_book.h) while it
+   * knows the position. */
+  BOOL book;
+  /* Set while searching the reply to a null move, so two never run back to
+   * back. */
+  BOOL after_null;
   Move_Validation_Flag_e last_move;
-  u16 depth;
-  u8 gen, team;
+  /* How many zobrist keys are on the key history, which runs from the
+   * oldest game position that can still repeat up to the node being
+   * searched. */
+  u16 key_count;
+  /* Pondering. ponder_move is the reply the last search expects from the
+   * opponent (start is INVALID_IDX_COMPACT if it had none), ponder_key the
+   * position that reply leads to, and ponder_best the answer ChessAI_Ponder
+   * has found to it, searched to ponder_depth. ponder_target is how deep
+   * the last search got, i.e.: how deep pondering has to get for its answer
+   * to stand in for a search of its own. */
+  ChessMove_t ponder_move;
+  ChessAI_MoveSearch_Result_t ponder_best;
+  u64 ponder_key;
+  u16 ponder_depth, ponder_target;
+  /* Set from the first ChessAI_Ponder call until ChessAI_PonderEnd, with the
+   * ponder search left suspended in between and ponder_move made on
+   * root_state. ponder_done once it has searched to full depth, leaving
+   * nothing more to do before the opponent moves. */
+  BOOL pondering, ponder_done;
+  u16 depth, ply;
+  u8 team;
+  /* stop ends the search as soon as it's seen. abort asks for that too, but
+   * only once depth 1 is done, so there's a move to play. */
+  BOOL stop, abort;
 } ChessAI_Params_t;
 
 #define CONVERT_CHESS_AI_TEAM_FLAG(team) ((team)<<8)
 
+/* The clock is only read every CHESS_AI_TIME_CHECK_INTERVAL nodes. */
+#define CHESS_AI_TIME_CHECK_INTERVAL 64
+#define CHESS_AI_TIME_CHECK_MASK (CHESS_AI_TIME_CHECK_INTERVAL-1)
+
+/* From this depth on, each iteration searches the root in a window of
+ * +/-CHESS_AI_ASPIRATION_WINDOW around the last iteration's score, and only
+ * widens it if the score falls outside. */
+#define CHESS_AI_ASPIRATION_MIN_DEPTH 3
+#define CHESS_AI_ASPIRATION_WINDOW 50
+
+/* Null-move pruning: let the side to move pass, and if a search reduced by
+ * CHESS_AI_NULL_MOVE_REDUCTION plies still can't get the opponent back
+ * inside the window, the real moves won't either. */
+#define CHESS_AI_NULL_MOVE_MIN_DEPTH 3
+#define CHESS_AI_NULL_MOVE_REDUCTION 2
+
+/* Late move reductions: quiet moves ordered after the first
+ * CHESS_AI_LMR_MIN_MOVES are searched a ply shallower (two, past
+ * CHESS_AI_LMR_DEEP_MOVES), and again at full depth if they turn out good. */
+#define CHESS_AI_LMR_MIN_DEPTH 3
+#define CHESS_AI_LMR_MIN_MOVES 3
+#define CHESS_AI_LMR_DEEP_MOVES 8
+
+/* Draws. A game is drawn once CHESS_AI_FIFTY_MOVE_PLIES plies go by without
+ * a capture or pawn move, so no position from before that many plies back
+ * can ever come up again. The key history holds at most that much of the
+ * game, plus the search path on top of it. */
+#define CHESS_AI_DRAW_SCORE 0
+#define CHESS_AI_FIFTY_MOVE_PLIES 100
+#define CHESS_AI_KEY_HISTORY_SIZE (CHESS_AI_FIFTY_MOVE_PLIES+1+MAX_SEARCH_PLY)
+
+/* Mate scores count down with distance from the root: being mated at ply p
+ * scores CHESS_AI_MATE_SCORE-p against the mated side, so shorter mates
+ * always score better for the winner. Anything at least CHESS_AI_MATE_BOUND
+ * away from 0 is a mate. */
+#define CHESS_AI_MATE_SCORE 30000
+#define CHESS_AI_MATE_BOUND (CHESS_AI_MATE_SCORE-MAX_SEARCH_PLY)
+#define CHESS_AI_IS_MATE_SCORE(score)\
+  (CHESS_AI_MATE_BOUND<=(score) || -CHESS_AI_MATE_BOUND>=(score))
+/* Score for the side to move being mated at ply, from white's point of
+ * view. */
+#define CHESS_AI_MATED_SCORE(maximizing, ply)\
+  ((i16)((maximizing) ? -(CHESS_AI_MATE_SCORE-(int)(ply))\
+                      : (CHESS_AI_MATE_SCORE-(int)(ply))))
+
 IWRAM_CODE void ChessAI_Params_Init(ChessAI_Params_t *obj,
                                     BoardState_t *root_state, 
                                     int depth,
@@ -34,9 +134,101 @@ IWRAM_CODE void ChessAI_Params_Init(ChessAI_Params_t *obj,
 #define ChessAI_Params_Uninit(obj)\
   Fast_Memset32(obj, 0, sizeof(ChessAI_Params_t)/sizeof(WORD))
 
+/**
+ * @brief Add ai_params->root_state to the game's key history, so the search
+ * can tell when a line repeats it. Call after every move played, once
+ * root_state has caught up with it. ChessAI_Params_Init takes care of the
+ * starting position.
+ */
+IWRAM_CODE void ChessAI_RecordGamePosition(ChessAI_Params_t *ai_params);
+
+/**
+ * @brief Pick a move for the side to move in ai_params->root_state by
+ * iterative deepening, from depth 1 up to ai_params->depth. Stops early once
+ * ai_params->time_budget ticks have passed, keeping the best move found so
+ * far. Depth 1 always runs to completion, so there is always a move.
+ *
+ * Positions in the opening book are answered from it without searching.
+ *
+ * Runs the whole search in one go, with the VBlank and keypad IRQs masked.
+ * ChessAI_MoveBegin, ChessAI_MoveStep and ChessAI_MoveEnd do the same
+ * search a slice at a time instead. When
+ * the opponent has just played ponder_move, pondering's answer may be
+ * played straight away (see ChessAI_Ponder). Afterwards, ponder_move is set
+ * to the reply the new PV expects.
+ */
 IWRAM_CODE void ChessAI_Move(ChessAI_Params_t *ai_params,
                              ChessAI_MoveSearch_Result_t *return_move);
 
+/**
+ * @brief Set up the search ChessAI_Move would run, without running any of
+ * it. Until ChessAI_MoveEnd, ai_params and its root_state belong to the
+ * search, and must be left alone between steps.
+ */
+IWRAM_CODE void ChessAI_MoveBegin(ChessAI_Params_t *ai_params);
+
+/**
+ * @brief Run the search for about slice_ticks ChessClock ticks (0 = until
+ * it's done), then leave off where it is. The search's stack lives in EWRAM,
+ * so the next call picks up right there. Given a slice, it also leaves off
+ * early once an iteration finishes, so completed_depth goes up by at most
+ * one per call.
+ *
+ * @return TRUE once the search is finished and ChessAI_MoveEnd can be called.
+ */
+IWRAM_CODE BOOL ChessAI_MoveStep(ChessAI_Params_t *ai_params,
+                                 u32 slice_ticks);
+
+/**
+ * @brief Have the search wind down and settle for the best move found so
+ * far. Takes effect within the next few steps, but not before depth 1 is
+ * done.
+ */
+INLN void ChessAI_MoveAbort(ChessAI_Params_t *ai_params) {
+  ai_params->abort = TRUE;
+}
+
+/**
+ * @brief Give the search in progress a time budget of budget_ticks (0 = no
+ * limit), counted from now rather than from ChessAI_MoveBegin, e.g.: once a
+ * search started while pondering becomes the real one.
+ */
+IWRAM_CODE void ChessAI_MoveRestartClock(ChessAI_Params_t *ai_params,
+                                         u32 budget_ticks);
+
+/** @brief Hand over the finished search's move. */
+IWRAM_CODE void ChessAI_MoveEnd(ChessAI_Params_t *ai_params,
+                                ChessAI_MoveSearch_Result_t *return_move);
+
+/**
+ * @brief Think on the opponent's time. Searches ai_params->root_state, with
+ * the opponent to move, as if they had already played ponder_move, or just
+ * the position as it stands if there is no ponder_move. The search runs
+ * with the keypad IRQ enabled and leaves off as soon as it fires. If the
+ * opponent then plays ponder_move, ChessAI_Move answers with ponder_best
+ * right away once pondering got to ponder_target, and searches as usual
+ * otherwise. Either way, the transposition table keeps what pondering
+ * found.
+ *
+ * The first call sets the search up and each later one carries it on from
+ * where the last one left off, the same way ChessAI_MoveStep does. Until
+ * ChessAI_PonderEnd, root_state belongs to the search, with ponder_move
+ * made on it.
+ *
+ * @return TRUE if a keypad IRQ is waiting to be handled (its flag in
+ * REG_IFBIOS has been cleared), FALSE if pondering is finished and the
+ * caller should wait on the keypad itself.
+ */
+IWRAM_CODE BOOL ChessAI_Ponder(ChessAI_Params_t *ai_params);
+
+/**
+ * @brief Wind down a suspended ponder search and take ponder_move back off
+ * root_state, keeping ponder_best. Call it once the opponent has moved,
+ * before root_state gets rebuilt. Does nothing if there's nothing to wind
+ * down.
+ */
+IWRAM_CODE void ChessAI_PonderEnd(ChessAI_Params_t *ai_params);
+
 
 
 
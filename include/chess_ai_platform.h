@@ -0,0 +1,79 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#ifndef _CHESS_AI_PLATFORM_
+#define _CHESS_AI_PLATFORM_
+
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#include <GBAdev_memdef.h>
+#ifndef _HOST_BUILD_
+#include <GBAdev_memmap.h>
+#endif  /* _HOST_BUILD_ */
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+/* Everything the search needs from the hardware besides the clock (see
+ * chess_clock.h), so the engine can run off-cartridge too. On the GBA, a
+ * search run in one go holds off the VBlank and keypad IRQs, and the keypad
+ * IRQ's BIOS flag is how the player cuts pondering short. A host build
+ * (_HOST_BUILD_) has no IRQs, and its front-end stops the search through
+ * ChessAI_MoveAbort instead, so there all of it does nothing. */
+
+/** @brief Hold off the IRQs the game loop runs on, for a search run in one
+ * go. */
+INLN void ChessAI_Platform_SearchIRQs_Disable(void);
+/** @brief Let the game loop's IRQs back in, along with any that came in
+ * while they were held off. */
+INLN void ChessAI_Platform_SearchIRQs_Enable(void);
+/** @brief TRUE if the player has pressed a key since the last
+ * ChessAI_Platform_Input_Clear. */
+INLN BOOL ChessAI_Platform_Input_Pending(void);
+INLN void ChessAI_Platform_Input_Clear(void);
+
+#ifdef _HOST_BUILD_
+
+void ChessAI_Platform_SearchIRQs_Disable(void) {
+}
+
+void ChessAI_Platform_SearchIRQs_Enable(void) {
+}
+
+BOOL ChessAI_Platform_Input_Pending(void) {
+  return FALSE;
+}
+
+void ChessAI_Platform_Input_Clear(void) {
+}
+
+#else
+
+void ChessAI_Platform_SearchIRQs_Disable(void) {
+  REG_IME = 0;
+  REG_IE &= ~IRQ_FLAGS(VBLANK, KEYPAD);
+  REG_IME = 1;
+}
+
+void ChessAI_Platform_SearchIRQs_Enable(void) {
+  REG_IME = 0;
+  REG_IF |= IRQ_FLAGS(VBLANK, KEYPAD);
+  REG_IE |= IRQ_FLAGS(VBLANK, KEYPAD);
+  REG_IME = 1;
+}
+
+BOOL ChessAI_Platform_Input_Pending(void) {
+  return 0!=(REG_IFBIOS&IRQ_FLAG(KEYPAD));
+}
+
+void ChessAI_Platform_Input_Clear(void) {
+  REG_IFBIOS &= ~IRQ_FLAG(KEYPAD);
+}
+
+#endif  /* _HOST_BUILD_ */
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _CHESS_AI_PLATFORM_ */
@@ -7,16 +7,31 @@
 #include "GBAdev_types.h"
 #include "GBAdev_util_macros.h"
 #include "chess_board.h"
+#include "chess_bitboard.h"
+#include "chess_eval.h"
 #ifdef __cplusplus
 extern "C" {
 #endif  /* C++ Name mangler guard */
 
-#define DEFAULT_MAX_DEPTH 2
+#define DEFAULT_MAX_DEPTH 6
 
 #ifndef MAX_DEPTH
 #define MAX_DEPTH DEFAULT_MAX_DEPTH
 #endif
 
+/* Extra plies the quiescence search may run past the nominal depth, and how
+ * many of those answer a check with every evasion instead of standing pat. */
+#define QSEARCH_MAX_PLY 8
+#ifndef QSEARCH_EVASION_PLY
+#define QSEARCH_EVASION_PLY 2
+#endif
+/* Slack given to a capture's material gain before delta pruning drops it. */
+#define QSEARCH_DELTA_MARGIN 200
+
+/* Deepest ply a search can make moves at, which bounds how many undo records
+ * can be outstanding at once. */
+#define MAX_SEARCH_PLY (MAX_DEPTH+QSEARCH_MAX_PLY)
+
 #define CASTLE_FLAG_COUNT 4
 
 #define NO_VALID_EN_PASSENT_FILE ((u8)0xFFU)
@@ -109,6 +124,14 @@ typedef struct s_chess_move_iteration {
   Move_Validation_Flag_e special_flags;
 } ChessMoveIteration_t;
 
+/* Self-contained move, as written out by ChessMoveGen_Generate. promotion is
+ * a bare piece type (no team bits), 0 if not a promotion. */
+typedef struct s_chess_move {
+  ChessBoard_Idx_Compact_t start, dst;
+  Move_Validation_Flag_e flags;
+  ChessPiece_e promotion;
+} ChessMove_t;
+
 #define NORMAL_IDX_TYPE ChessBoard_Idx_t
 #define COMPACT_IDX_TYPE ChessBoard_Idx_Compact_t
 #define BOARD_IDX_CONVERT(normal_idx, _convert_to)\
@@ -125,6 +148,23 @@ typedef struct s_chess_move_iteration {
    |PIECE_GRAPH_EMPTY_HASHENT<<16\
    |PIECE_GRAPH_EMPTY_HASHENT<<24)
 
+/* Everything BoardState_UnmakeMove needs to put a board state back the way it
+ * was before the BoardState_MakeMove that filled it. Vertices whose edges got
+ * rebuilt are saved off to an undo stack internal to chess_board_state.c, with
+ * saved_vertices and vertex_stack_base recording which ones and where. */
+typedef struct s_board_state_undo {
+  u64 zobrist;
+  u32 pawn_zobrist;
+  GameState_t state;
+  BoardState_EvalSums_t eval;
+  u32 saved_vertices;
+  u16 vertex_stack_base;
+  Move_Validation_Flag_e flags;
+  ChessPiece_e moving_piece, captured_piece;
+  ChessBoard_Idx_Compact_t start, dst;
+  u8 captured_idx;
+} BoardState_Undo_t;
+
 // I dont know what the hell the opposite of opaque would be in the context of
 // type opacity in CS, so I'm just gonna go with the literal opposite:
 // transparent
@@ -133,8 +173,12 @@ struct s_board_state {
   ChessBoard_t board;
   GameState_t state;
   u64 zobrist;
+  // Pawns' share of zobrist, folded down to 32 bits. Keys the pawn hash.
+  u32 pawn_zobrist;
+  BoardState_EvalSums_t eval;
   u32 i;
   PieceState_Graph_t graph;
+  BoardState_Bitboards_t bb;
 };
 #endif
 
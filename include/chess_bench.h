@@ -0,0 +1,57 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#ifndef _CHESS_BENCH_
+#define _CHESS_BENCH_
+
+#include <GBAdev_types.h>
+#include "chess_ai.h"
+#include "chess_ai_types.h"
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+/* Fixed-depth search over a fixed set of positions, for comparing builds.
+ * Every position gets a fresh ChessAI_Params_Init, which empties every table
+ * the search keeps, and no opening book or clock, so each position's node
+ * count only changes when the search does, whatever order they run in. The
+ * host (bin/host/bench) and the ROM (-D_CHESS_BENCH_BUILD_) run the same
+ * code, so builds with the same MAX_DEPTH and TTABLE_SIZE_LOG2 should agree
+ * on it too. */
+#ifndef CHESS_BENCH_DEPTH
+#define CHESS_BENCH_DEPTH 5
+#endif
+static_assert(CHESS_BENCH_DEPTH<=MAX_DEPTH);
+
+extern const char *const CHESS_BENCH_FENS[];
+extern const u32 CHESS_BENCH_POSITION_COUNT;
+
+typedef struct s_chess_bench_result {
+  /* Search and quiescence nodes together. */
+  u32 nodes;
+  /* ChessClock ticks spent searching, setup excluded. */
+  u32 ticks;
+  u32 tt_probes, tt_hits;
+} ChessBench_Result_t;
+
+/* Called after each position's search. */
+typedef void (*ChessBench_Report_cb)(u32 idx,
+                                     const ChessAI_MoveSearch_Result_t *move,
+                                     const ChessBench_Result_t *position);
+
+/**
+ * @brief Search every bench position to depth, calling report (if not
+ * NULL) after each one, and add them all up in total.
+ * @return How many positions were searched. Anything short of
+ * CHESS_BENCH_POSITION_COUNT is the index of the position that couldn't be
+ * set up.
+ */
+u32 ChessBench_Run(u32 depth,
+                   ChessBench_Report_cb report,
+                   ChessBench_Result_t *total);
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _CHESS_BENCH_ */
@@ -0,0 +1,134 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#ifndef _CHESS_BITBASE_
+#define _CHESS_BITBASE_
+#include "chess_board.h"
+#include "chess_bitboard.h"
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+typedef struct s_board_state BoardState_t;
+
+/* Win/draw bitbases for a king and one pawn, rook or queen against a lone
+ * king, one bit per position: set if the side with the extra piece (the
+ * strong side) wins with best play, clear if it's a draw. Positions are
+ * always looked up as if the strong side were white, moving toward ROW_8,
+ * so a black strong side gets its board flipped top to bottom first.
+ *
+ * Index layout, from the top bits down:
+ *   KPK: strong side to move, pawn (ROW_7..ROW_2 x FILE_A..FILE_D), strong
+ *        king, weak king. Pawns on FILE_E..FILE_H are mirrored onto the
+ *        queenside first.
+ *   KRK, KQK: strong side to move, strong king (one of the 10 squares of the
+ *        a8-d8-d5 triangle), piece, weak king. The board is mirrored and
+ *        transposed until the strong king lands in the triangle. */
+typedef enum e_chess_bitbase_id {
+  CHESS_BITBASE_KPK=0,
+  CHESS_BITBASE_KRK,
+  CHESS_BITBASE_KQK,
+  CHESS_BITBASE_COUNT,
+} PACKED ChessBitbase_e;
+
+#define CHESS_BITBASE_PAWN_SQUARES 24
+#define CHESS_BITBASE_TRIANGLE_SQUARES 10
+#define CHESS_BITBASE_KPK_SIZE\
+  (2*CHESS_BITBASE_PAWN_SQUARES*BB_SQUARE_COUNT*BB_SQUARE_COUNT)
+#define CHESS_BITBASE_KXK_SIZE\
+  (2*CHESS_BITBASE_TRIANGLE_SQUARES*BB_SQUARE_COUNT*BB_SQUARE_COUNT)
+
+/* Positions are stored in blocks of 256. A block whose positions are all
+ * wins or all draws (illegal positions count as whichever fits) is stored
+ * as just its blocks[] flag. Any other block's entry is the index of its
+ * 8 words in words[], and blocks with the same bits share them. */
+#define CHESS_BITBASE_BLOCK_LOG2 8
+#define CHESS_BITBASE_BLOCK_WORDS ((1<<CHESS_BITBASE_BLOCK_LOG2)>>5)
+#define CHESS_BITBASE_BLOCK_DRAW 0xFFFE
+#define CHESS_BITBASE_BLOCK_WIN 0xFFFF
+
+typedef struct s_chess_bitbase {
+  const u16 *blocks;
+  const u32 *words;
+} ChessBitbase_t;
+
+/* Generated by bin/host/bitbase_gen (see make bitbases), into ROM. */
+extern const ChessBitbase_t CHESS_BITBASES[CHESS_BITBASE_COUNT];
+
+/* Won bitbase positions score CHESS_BITBASE_WIN_SCORE for the strong side,
+ * well clear of any eval but short of a mate, plus a little for progress
+ * (see ChessBitbase_Probe). */
+#define CHESS_BITBASE_WIN_SCORE 20000
+
+/* Slot of a square in the triangle, counting down each file from a8, then
+ * b8, b7, c8 and so on. Only meaningful for row<=file<=3. */
+#define CHESS_BITBASE_TRIANGLE_SLOT(sq)\
+  ((BB_SQ_FILE(sq)*(BB_SQ_FILE(sq)+1)>>1)+BB_SQ_ROW(sq))
+
+/**
+ * @brief Bitbase index of a position, given in the strong-side-is-white
+ * orientation. Applies the symmetries described above, so any of the
+ * position's mirror images gives back the same index.
+ */
+INLN u32 ChessBitbase_Index(ChessBitbase_e id,
+                            u32 strong_king,
+                            u32 piece,
+                            u32 weak_king,
+                            BOOL strong_to_move) {
+  if (CHESS_BITBASE_KPK==id) {
+    if (3<BB_SQ_FILE(piece)) {
+      strong_king ^= 7;
+      piece ^= 7;
+      weak_king ^= 7;
+    }
+    return (((((u32)strong_to_move*CHESS_BITBASE_PAWN_SQUARES
+             + (BB_SQ_ROW(piece)-1)*4+BB_SQ_FILE(piece))
+             <<6)|strong_king)<<6)|weak_king;
+  }
+  if (3<BB_SQ_FILE(strong_king)) {
+    strong_king ^= 7;
+    piece ^= 7;
+    weak_king ^= 7;
+  }
+  if (3<BB_SQ_ROW(strong_king)) {
+    strong_king ^= 56;
+    piece ^= 56;
+    weak_king ^= 56;
+  }
+  if (BB_SQ_ROW(strong_king)>BB_SQ_FILE(strong_king)) {
+#define CHESS_BITBASE_TRANSPOSE(sq) ((((sq)&7)<<3)|((sq)>>3))
+    strong_king = CHESS_BITBASE_TRANSPOSE(strong_king);
+    piece = CHESS_BITBASE_TRANSPOSE(piece);
+    weak_king = CHESS_BITBASE_TRANSPOSE(weak_king);
+#undef CHESS_BITBASE_TRANSPOSE
+  }
+  return (((((u32)strong_to_move*CHESS_BITBASE_TRIANGLE_SQUARES
+           + CHESS_BITBASE_TRIANGLE_SLOT(strong_king))
+           <<6)|piece)<<6)|weak_king;
+}
+
+INLN BOOL ChessBitbase_Lookup(ChessBitbase_e id, u32 idx) {
+  const ChessBitbase_t *const BB = &CHESS_BITBASES[id];
+  const u32 BLOCK = BB->blocks[idx>>CHESS_BITBASE_BLOCK_LOG2],
+            BIT = idx&((1<<CHESS_BITBASE_BLOCK_LOG2)-1);
+  if (CHESS_BITBASE_BLOCK_DRAW<=BLOCK)
+    return CHESS_BITBASE_BLOCK_WIN==BLOCK;
+  return 1&(BB->words[BLOCK*CHESS_BITBASE_BLOCK_WORDS+(BIT>>5)]>>(BIT&31));
+}
+
+/**
+ * @brief Look up state, if it's one of the bitbases' endings and the side to
+ * move isn't in check (checks are left to the search, so mates still get
+ * found as mates).
+ * @return TRUE with the white-positive score in score if the bitbases settle
+ * state, else FALSE.
+ */
+IWRAM_CODE BOOL ChessBitbase_Probe(const BoardState_t *state, i16 *score);
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _CHESS_BITBASE_ */
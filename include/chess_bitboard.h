@@ -0,0 +1,164 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#ifndef _CHESS_BITBOARD_
+#define _CHESS_BITBOARD_
+
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#include "chess_board.h"
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+/* Squares are numbered the same way ChessBoard_t is laid out in memory:
+ *   sq = (row<<3)|file, where ROW_8 = 0 and FILE_A = 0,
+ * so bit 0 is a8 and bit 63 is h1. Moving toward ROW_8 (white's forward
+ * direction) is a right shift by 8, moving toward FILE_H a left shift by 1. */
+typedef u64 Bitboard_t;
+
+#define BB_SQUARE_COUNT 64
+#define BB_SQ(file, row) ((u32)(((row)<<3)|(file)))
+#define BB_SQ_FILE(sq) ((sq)&7)
+#define BB_SQ_ROW(sq) ((sq)>>3)
+#define BB_SQ_FROM_COMPACT(compact_idx)\
+  BB_SQ((compact_idx).coord.x&7, (compact_idx).coord.y&7)
+#define BB_SQ_FROM_IDX(normal_idx)\
+  BB_SQ((normal_idx).coord.x&7, (normal_idx).coord.y&7)
+#define BB_SQ_BIT(sq) (1ULL<<(sq))
+#define BB_SQ_TO_COMPACT(sq)\
+  ((ChessBoard_Idx_Compact_t){.raw=(u8)(((sq)&7)|(((sq)&0x38)<<1))})
+
+#define BB_FILE_A 0x0101010101010101ULL
+#define BB_FILE_B (BB_FILE_A<<1)
+#define BB_FILE_G (BB_FILE_A<<6)
+#define BB_FILE_H (BB_FILE_A<<7)
+#define BB_NOT_FILE_A (~BB_FILE_A)
+#define BB_NOT_FILE_H (~BB_FILE_H)
+#define BB_NOT_FILE_AB (~(BB_FILE_A|BB_FILE_B))
+#define BB_NOT_FILE_GH (~(BB_FILE_G|BB_FILE_H))
+#define BB_ROW(row) (0xFFULL<<((row)<<3))
+
+/* Index into BoardState_Bitboards_t.teams from a piece's team flagbit. */
+#define BB_TEAM_IDX(team_flagbit) (((team_flagbit)&PIECE_TEAM_MASK)>>13)
+#define BB_WHITE_TEAM_IDX BB_TEAM_IDX(WHITE_FLAGBIT)
+#define BB_BLACK_TEAM_IDX BB_TEAM_IDX(BLACK_FLAGBIT)
+#define BB_TEAM_COUNT 2
+
+/* Piece type sets are indexed by PIECE_IDX_MASK&piece, so slot EMPTY_IDX is
+ * left unused. */
+#define BB_PIECE_TYPE_COUNT 6
+
+typedef struct s_board_state_bitboards {
+  Bitboard_t pieces[BB_PIECE_TYPE_COUNT];
+  Bitboard_t teams[BB_TEAM_COUNT];
+} BoardState_Bitboards_t;
+
+/* Knight, king and pawn attack sets are plain lookups. Pawn attacks are
+ * indexed by the attacking pawn's team (BB_TEAM_IDX). */
+extern const Bitboard_t BB_KNIGHT_ATTACKS[BB_SQUARE_COUNT];
+extern const Bitboard_t BB_KING_ATTACKS[BB_SQUARE_COUNT];
+extern const Bitboard_t BB_PAWN_ATTACKS[BB_TEAM_COUNT][BB_SQUARE_COUNT];
+
+/* Sliding attacks use kindergarten bitboards, which only need a handful of
+ * ROM tables (~5KB all told) and no incrementally rotated copies of the
+ * occupancy. The inner six squares of a line are collapsed into a 6-bit index
+ * with a mask and a multiply, and that index selects the attack set for the
+ * line from the tables below.
+ *  - BB_FIRST_ROW_ATTACKS[file][occ6] is the attack set along a single row.
+ *  - BB_FILE_A_ATTACKS[row][occ6] is the same thing transposed onto FILE_A.
+ *  - BB_DIAG_MASKS/BB_ANTIDIAG_MASKS are the lines through each square,
+ *    running a8-h1 and h8-a1 respectively. */
+extern const u8 BB_FIRST_ROW_ATTACKS[CHESS_BOARD_FILE_COUNT][64];
+extern const Bitboard_t BB_FILE_A_ATTACKS[CHESS_BOARD_ROW_COUNT][64];
+extern const Bitboard_t BB_DIAG_MASKS[BB_SQUARE_COUNT];
+extern const Bitboard_t BB_ANTIDIAG_MASKS[BB_SQUARE_COUNT];
+
+#define BB_COLLAPSE_TO_TOP_ROW 0x0202020202020202ULL
+#define BB_COLLAPSE_FILE_A 0x0004081020408000ULL
+#define BB_FILL_ROWS 0x0101010101010101ULL
+
+INLN Bitboard_t Bitboard_LineAttacks(u32 sq,
+                                     Bitboard_t occ,
+                                     Bitboard_t line) {
+  const u32 OCC6 = (u32)(((line&occ)*BB_COLLAPSE_TO_TOP_ROW)>>58);
+  return line&(BB_FILL_ROWS*BB_FIRST_ROW_ATTACKS[BB_SQ_FILE(sq)][OCC6]);
+}
+
+INLN Bitboard_t Bitboard_RowAttacks(u32 sq, Bitboard_t occ) {
+  const u32 SHAMT = sq&~7U, OCC6 = (u32)(occ>>(SHAMT+1))&63;
+  return ((Bitboard_t)BB_FIRST_ROW_ATTACKS[BB_SQ_FILE(sq)][OCC6])<<SHAMT;
+}
+
+INLN Bitboard_t Bitboard_FileAttacks(u32 sq, Bitboard_t occ) {
+  const u32 FILE = BB_SQ_FILE(sq),
+            OCC6 = (u32)((((occ>>FILE)&BB_FILE_A)*BB_COLLAPSE_FILE_A)>>58);
+  return BB_FILE_A_ATTACKS[BB_SQ_ROW(sq)][OCC6]<<FILE;
+}
+
+INLN Bitboard_t Bitboard_BishopAttacks(u32 sq, Bitboard_t occ) {
+  return Bitboard_LineAttacks(sq, occ, BB_DIAG_MASKS[sq])
+        |Bitboard_LineAttacks(sq, occ, BB_ANTIDIAG_MASKS[sq]);
+}
+
+INLN Bitboard_t Bitboard_RookAttacks(u32 sq, Bitboard_t occ) {
+  return Bitboard_RowAttacks(sq, occ)|Bitboard_FileAttacks(sq, occ);
+}
+
+INLN Bitboard_t Bitboard_QueenAttacks(u32 sq, Bitboard_t occ) {
+  return Bitboard_BishopAttacks(sq, occ)|Bitboard_RookAttacks(sq, occ);
+}
+
+/* Adds piece to, or removes it from, its type and team sets at sq. */
+INLN void Bitboard_TogglePiece(BoardState_Bitboards_t *bbs,
+                               u32 sq,
+                               ChessPiece_e piece) {
+  const Bitboard_t BIT = BB_SQ_BIT(sq);
+  bbs->pieces[PIECE_IDX_MASK&piece] ^= BIT;
+  bbs->teams[BB_TEAM_IDX(piece)] ^= BIT;
+}
+
+/* Every square attacked by a set of white or black pawns. */
+INLN Bitboard_t Bitboard_WhitePawnAttacks(Bitboard_t pawns) {
+  return ((pawns>>7)&BB_NOT_FILE_A)|((pawns>>9)&BB_NOT_FILE_H);
+}
+
+INLN Bitboard_t Bitboard_BlackPawnAttacks(Bitboard_t pawns) {
+  return ((pawns<<9)&BB_NOT_FILE_A)|((pawns<<7)&BB_NOT_FILE_H);
+}
+
+/* Smears every set square all the way toward ROW_8 or ROW_1. */
+INLN Bitboard_t Bitboard_FillNorth(Bitboard_t bb) {
+  bb |= bb>>8;
+  bb |= bb>>16;
+  return bb|(bb>>32);
+}
+
+INLN Bitboard_t Bitboard_FillSouth(Bitboard_t bb) {
+  bb |= bb<<8;
+  bb |= bb<<16;
+  return bb|(bb<<32);
+}
+
+#define Bitboard_Occupancy(bbs)\
+  ((bbs)->teams[BB_WHITE_TEAM_IDX]|(bbs)->teams[BB_BLACK_TEAM_IDX])
+
+/* Pops and returns the lowest set square of *bb. bb must be nonzero. */
+INLN u32 Bitboard_PopLSB(Bitboard_t *bb) {
+  const u32 LO = (u32)*bb;
+  const u32 SQ = LO ? (u32)__builtin_ctz(LO)
+                    : 32+(u32)__builtin_ctz((u32)(*bb>>32));
+  *bb &= *bb-1;
+  return SQ;
+}
+
+INLN u32 Bitboard_PopCount(Bitboard_t bb) {
+  return (u32)__builtin_popcount((u32)bb)
+        +(u32)__builtin_popcount((u32)(bb>>32));
+}
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _CHESS_BITBOARD_ */
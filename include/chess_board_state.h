@@ -17,9 +17,40 @@ EWRAM_CODE BoardState_t *BoardState_Alloc(void);
 EWRAM_CODE void BoardState_Dealloc(BoardState_t *board_state);
 EWRAM_CODE BoardState_t *BoardState_FromCtx(BoardState_t *board_state,
                                             const ChessGameCtx_t *ctx);
+/**
+ * @brief Builds a board state from a FEN string. Pieces get roster IDs the
+ * same way a real game would have assigned them, with promoted pieces
+ * occupying pawn slots.
+ * @return board_state, or NULL if fen is malformed or describes a position
+ * the roster can't represent (e.g.: 3 knights and 8 pawns).
+ */
+EWRAM_CODE BoardState_t *BoardState_FromFEN(BoardState_t *board_state,
+                                            const char *fen);
 EWRAM_CODE BoardState_t *BoardState_ApplyMove(BoardState_t *board_state,
                                        const ChessMoveIteration_t *move_data,
                                        ChessBoard_Idx_Compact_t start_pos);
+/**
+ * @brief Same as BoardState_ApplyMove, but takes a generated ChessMove_t and
+ * also fills undo so the move can be taken back with BoardState_UnmakeMove.
+ * Moves must be unmade in the reverse order they were made.
+ */
+EWRAM_CODE BoardState_t *BoardState_MakeMove(BoardState_t *board_state,
+                                             const ChessMove_t *move,
+                                             BoardState_Undo_t *undo);
+EWRAM_CODE BoardState_t *BoardState_UnmakeMove(BoardState_t *board_state,
+                                               const BoardState_Undo_t *undo);
+/**
+ * @brief Pass the turn without moving anything: flips the side to move and
+ * its Zobrist key, drops any en passent file and resets the halfmove clock
+ * (as far as repetitions go, a pass is irreversible). Only state and zobrist
+ * are touched (the attack graph doesn't depend on whose turn it is), so the
+ * matching BoardState_UnmakeNullMove is just as cheap.
+ */
+EWRAM_CODE BoardState_t *BoardState_MakeNullMove(BoardState_t *board_state,
+                                                 BoardState_Undo_t *undo);
+EWRAM_CODE BoardState_t *BoardState_UnmakeNullMove(
+                                              BoardState_t *board_state,
+                                              const BoardState_Undo_t *undo);
 
 EWRAM_CODE BoardState_t *BoardState_Alloc(void);
 EWRAM_CODE void BoardState_Dealloc(BoardState_t *board_state);
@@ -12,6 +12,15 @@
 extern "C" {
 #endif  /* C++ Name mangler guard */
 
+/**
+ * @brief Check if any piece of attacking_team (WHITE_FLAGBIT or BLACK_FLAGBIT)
+ * attacks bitboard square sq, using the board state's bitboards.
+ * @return TRUE if sq is attacked. ELSE FALSE
+ */
+EWRAM_CODE BOOL BoardState_SquareAttacked(const BoardState_t *board_state,
+                                          u32 sq,
+                                          ChessPiece_e attacking_team);
+
 /**
  * @brief Given board state, the ID of king we are detecting check for, and
  *  opposition index offset.
@@ -31,6 +40,16 @@ EWRAM_CODE Mvmt_Dir_e BoardState_PiecePinDirection(
                                                const BoardState_t *board_state,
                                                ChessPiece_e piece_id);
 
+/**
+ * @brief Check if attacker, standing at move[0], hits move[1] along attack_dir
+ * with nothing in between. Doesn't validate En Passent.
+ * @return TRUE if move[1] is in attacker's line of fire. ELSE FALSE
+ */
+EWRAM_CODE BOOL BoardState_ValidateAttackVector(const ChessBoard_Row_t *board,
+                                                const ChessBoard_Idx_t *move,
+                                                ChessPiece_e attacker,
+                                                Mvmt_Dir_e attack_dir);
+
 typedef enum e_board_state_castle_legality_status {
   BOARD_STATE_CASTLE_BLOCKED_BY_CHECK = -3,
   BOARD_STATE_CASTLE_BLOCKED_BY_PATH_ATTACK_PT,
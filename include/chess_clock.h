@@ -0,0 +1,109 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#ifndef _CHESS_CLOCK_
+#define _CHESS_CLOCK_
+
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#include <GBAdev_memdef.h>
+#ifndef _HOST_BUILD_
+#include <GBAdev_memmap.h>
+#endif  /* _HOST_BUILD_ */
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+/* Free-running 32-bit tick counter built from a timer cascade: TM2 counts
+ * 1024-cycle periods (16384 of them a second) and TM3 counts TM2 overflows.
+ * TM0 is left alone for ChessGame_NotifyInvalidMove's blink timer. Wraps
+ * after ~72 hours, so differences between two reads are always safe. */
+#define CHESS_CLOCK_LO_TIMER 2
+#define CHESS_CLOCK_HI_TIMER 3
+#define CHESS_CLOCK_TICKS_PER_SEC 16384UL
+/* 16384/1000 reduces to 2048/125. Good for budgets up to ~35 minutes. */
+#define CHESS_CLOCK_MS_TO_TICKS(ms) ((u32)(((u32)(ms)*2048UL)/125UL))
+#define CHESS_CLOCK_TICKS_TO_MS(ticks) ((u32)(((u64)(ticks)*125UL)/2048UL))
+#define CHESS_CLOCK_SEC_TO_TICKS(sec)\
+  ((u32)((u32)(sec)*CHESS_CLOCK_TICKS_PER_SEC))
+
+/* Fixed per-move search budget, used when the game clock is compiled out. */
+#ifndef CHESS_AI_MOVE_TIME_MS
+#define CHESS_AI_MOVE_TIME_MS 3000
+#endif
+
+/* Optional game clock for Person x CPU games (-D_CHESS_GAME_CLOCK_). Each
+ * side starts with CHESS_GAME_CLOCK_BASE_SECONDS and gains the increment
+ * after every move it makes. The CPU's per-move budget is carved out of its
+ * remaining time, assuming CHESS_GAME_CLOCK_MOVES_TO_GO moves are left. */
+#ifndef CHESS_GAME_CLOCK_BASE_SECONDS
+#define CHESS_GAME_CLOCK_BASE_SECONDS 300
+#endif
+#ifndef CHESS_GAME_CLOCK_INCREMENT_SECONDS
+#define CHESS_GAME_CLOCK_INCREMENT_SECONDS 2
+#endif
+#define CHESS_GAME_CLOCK_MOVES_TO_GO 30
+
+typedef struct s_chess_game_clock {
+  /* Ticks left per side, indexed by BB_TEAM_IDX (white 0, black 1). */
+  u32 remaining[2];
+  u32 increment;
+  u32 turn_start;
+} ChessGameClock_t;
+
+/**
+ * @brief Start (or restart) the TM2/TM3 cascade from zero. Called once at
+ * boot. Calling it again resets the tick count out from under anything
+ * timing itself with it (i.e.: the search and ChessGameClock).
+ */
+void ChessClock_Start(void);
+
+#ifdef _HOST_BUILD_
+/* Host builds have no timers to cascade, so the same ticks are counted off
+ * the system's monotonic clock instead (see host/src/host_platform.c). */
+u32 ChessClock_Ticks(void);
+#else
+/**
+ * @brief Current tick count. The high half is read on either side of the low
+ * half, so a TM2 overflow between the reads can't tear the result.
+ */
+INLN u32 ChessClock_Ticks(void) {
+  u16 hi, lo;
+  do {
+    hi = REG_TM[CHESS_CLOCK_HI_TIMER].data;
+    lo = REG_TM[CHESS_CLOCK_LO_TIMER].data;
+  } while (hi!=REG_TM[CHESS_CLOCK_HI_TIMER].data);
+  return ((u32)hi<<16)|lo;
+}
+#endif  /* _HOST_BUILD_ */
+
+/* TRUE once the tick count has reached deadline. */
+#define CHESS_CLOCK_EXPIRED(deadline)\
+  (0<=(i32)(ChessClock_Ticks()-(u32)(deadline)))
+
+void ChessGameClock_Init(ChessGameClock_t *clock,
+                         u32 base_seconds,
+                         u32 increment_seconds);
+
+/** @brief Mark the start of the side to move's turn. */
+void ChessGameClock_StartTurn(ChessGameClock_t *clock);
+
+/**
+ * @brief Charge the time since ChessGameClock_StartTurn to team_idx's clock
+ * and then credit the increment.
+ * @return FALSE if team_idx ran out of time (flagged) during the turn.
+ */
+BOOL ChessGameClock_EndTurn(ChessGameClock_t *clock, u32 team_idx);
+
+/**
+ * @brief Search budget, in ticks, for team_idx's upcoming move: an even
+ * share of its remaining time plus most of the increment, and never more
+ * than half of what is left on its clock.
+ */
+u32 ChessGameClock_MoveBudget(const ChessGameClock_t *clock, u32 team_idx);
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _CHESS_CLOCK_ */
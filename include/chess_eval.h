@@ -0,0 +1,87 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#ifndef _CHESS_EVAL_
+#define _CHESS_EVAL_
+
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#include "chess_board.h"
+#include "chess_bitboard.h"
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+#define EVAL_MG 0
+#define EVAL_EG 1
+#define EVAL_STAGE_COUNT 2
+/* Per type tables are indexed by PIECE_IDX_MASK&piece. The ones that can be
+ * handed an empty square have a slot for EMPTY_IDX too. */
+#define EVAL_PIECE_TYPE_COUNT 8
+/* Game phase runs from EVAL_PHASE_MAX with every piece on the board down to 0
+ * with only kings and pawns left. Promotions can push the raw count past
+ * EVAL_PHASE_MAX, so it gets clamped before tapering. */
+#define EVAL_PHASE_MAX 24
+/* Knight outposts only count on a side's fourth through sixth ranks. */
+#define EVAL_WHITE_OUTPOST_ROWS (BB_ROW(ROW_6)|BB_ROW(ROW_5)|BB_ROW(ROW_4))
+#define EVAL_BLACK_OUTPOST_ROWS (BB_ROW(ROW_5)|BB_ROW(ROW_4)|BB_ROW(ROW_3))
+#define EVAL_KNIGHT_OUTPOST_MG 20
+#define EVAL_KNIGHT_OUTPOST_EG 10
+/* Per castle right still held or already used (i.e.: not forfeited). Only a
+ * middlegame concern; by the endgame the king wants to be out anyway. */
+#define EVAL_CASTLE_RIGHT_MG 15
+/* Black reads white's piece-square tables upside down. */
+#define EVAL_MIRROR_SQ(sq, team_idx) ((sq)^(56*(team_idx)))
+
+/* The static part of the evaluation: what every piece on the board is worth
+ * just for being where it is, as middlegame and endgame totals, along with
+ * how far into the endgame the material says the game is. The totals are
+ * white-positive and kept up to date by BoardState_ApplyMove, so
+ * BoardState_Eval only has to taper them and add the terms that depend on
+ * how the pieces interact. */
+typedef struct s_board_state_eval_sums {
+  i16 mg;
+  i16 eg;
+  u16 phase;
+} BoardState_EvalSums_t;
+
+extern const i16 EVAL_PIECE_VALUES[EVAL_STAGE_COUNT][EVAL_PIECE_TYPE_COUNT];
+extern const u8 EVAL_PHASE_WEIGHTS[EVAL_PIECE_TYPE_COUNT];
+extern const i16 EVAL_PST[EVAL_STAGE_COUNT]
+                         [BB_PIECE_TYPE_COUNT]
+                         [BB_SQUARE_COUNT];
+
+/* Middlegame material value of a piece type, as the search uses it to size
+ * up captures. */
+#define Piece_Eval(piece_type)  EVAL_PIECE_VALUES[EVAL_MG][PIECE_IDX_MASK&(piece_type)]
+
+/* Adds piece at sq into the sums when dir is 1, or takes it back out when dir
+ * is -1. Black's values go in negated, so neither team takes a branch. */
+INLN void EvalSums_Update(BoardState_EvalSums_t *sums,
+                          u32 sq,
+                          ChessPiece_e piece,
+                          i32 dir) {
+  const u32 TYPE = PIECE_IDX_MASK&piece, TEAM = BB_TEAM_IDX(piece),
+            REL_SQ = EVAL_MIRROR_SQ(sq, TEAM);
+  const i32 SIGN = dir*(1-2*(i32)TEAM);
+  sums->mg += SIGN*(EVAL_PIECE_VALUES[EVAL_MG][TYPE]
+                    +EVAL_PST[EVAL_MG][TYPE][REL_SQ]);
+  sums->eg += SIGN*(EVAL_PIECE_VALUES[EVAL_EG][TYPE]
+                    +EVAL_PST[EVAL_EG][TYPE][REL_SQ]);
+  sums->phase += dir*EVAL_PHASE_WEIGHTS[TYPE];
+}
+
+#define EvalSums_AddPiece(sums, sq, piece) EvalSums_Update(sums, sq, piece, 1)
+#define EvalSums_RemovePiece(sums, sq, piece)  EvalSums_Update(sums, sq, piece, -1)
+
+/* Blends the middlegame and endgame totals by game phase. */
+INLN i32 EvalSums_Taper(const BoardState_EvalSums_t *sums) {
+  const i32 PHASE = EVAL_PHASE_MAX<sums->phase ? EVAL_PHASE_MAX : sums->phase;
+  return (sums->mg*PHASE + sums->eg*(EVAL_PHASE_MAX-PHASE))/EVAL_PHASE_MAX;
+}
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _CHESS_EVAL_ */
@@ -0,0 +1,50 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#ifndef _CHESS_EVAL_CACHE_
+#define _CHESS_EVAL_CACHE_
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+/* 2048 one-word entries (8KB). Each holds the top 16 bits of a zobrist key,
+ * to tell it apart from the other keys sharing its slot, over the 16 bit
+ * score BoardState_Eval gave it. A leaf's score only depends on its key, so
+ * entries never go stale.
+ *
+ * An empty slot reads as a score of 0 for any key whose top bits are all
+ * zero. That's no likelier than two keys sharing a slot and their top bits,
+ * so it doesn't get a valid flag of its own. */
+#define EVAL_CACHE_SIZE (1<<11)
+#define EVAL_CACHE_IDX_MASK (EVAL_CACHE_SIZE-1)
+#define EVAL_CACHE_CHECK(key) ((u32)((key)>>48))
+
+typedef struct s_eval_cache {
+  u32 entries[EVAL_CACHE_SIZE];
+  u32 hits, misses;
+} EvalCache_t;
+
+/* On a hit, writes the cached score to *score. */
+INLN BOOL EvalCache_Probe(EvalCache_t *ec, u64 key, i16 *score) {
+  const u32 ENT = ec->entries[(u32)key&EVAL_CACHE_IDX_MASK];
+  if (EVAL_CACHE_CHECK(key)!=(ENT>>16)) {
+    ++ec->misses;
+    return FALSE;
+  }
+  ++ec->hits;
+  *score = (i16)(ENT&0xFFFFU);
+  return TRUE;
+}
+
+INLN void EvalCache_Store(EvalCache_t *ec, u64 key, i16 score) {
+  ec->entries[(u32)key&EVAL_CACHE_IDX_MASK]
+    = (EVAL_CACHE_CHECK(key)<<16)|(u16)score;
+}
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _CHESS_EVAL_CACHE_ */
@@ -0,0 +1,41 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#ifndef _CHESS_MOVE_GEN_
+#define _CHESS_MOVE_GEN_
+
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#include "chess_board.h"
+#include "chess_ai_types.h"
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+/* No legal position has more than 218 moves. Pseudo-legal generation can
+ * overshoot that slightly, so round up to leave headroom. */
+#define CHESS_MOVE_LIST_CAPACITY 256
+
+typedef struct s_chess_move_list {
+  u32 count;
+  ChessMove_t moves[CHESS_MOVE_LIST_CAPACITY];
+  /* Ordering score for moves[i], filled in by the search. The generator
+   * leaves these alone. */
+  i16 scores[CHESS_MOVE_LIST_CAPACITY];
+} ChessMoveList_t;
+
+/**
+ * @brief Generate every pseudo-legal move for the side to move straight off
+ * the board state's bitboards, into a list the caller owns (e.g.: one per
+ * search ply). Castles are only generated when fully legal. Every other move
+ * still has to be checked for leaving the mover's own king in check.
+ * @return Number of moves written to list->moves (also left in list->count).
+ */
+IWRAM_CODE u32 ChessMoveGen_Generate(const BoardState_t *board_state,
+                                     ChessMoveList_t *list);
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _CHESS_MOVE_GEN_ */
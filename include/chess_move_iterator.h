@@ -19,10 +19,6 @@ typedef struct s_chess_move_iterator {
 
 #define MV_ITER_MOVESET_SET_TYPE(mode)\
   (mode&MV_ITER_MOVESET_SET_TYPE_MASK)
-#define MV_ITER_MOVESET_ORDERED(mode)\
-  (0!=(mode&MV_ITER_MOVESET_ORDERED_FLAGBIT))
-#define MV_ITER_MOVESET_UNORDERED(mode)\
-  (0==(mode&MV_ITER_MOVESET_ORDERED_FLAGBIT))
 #define MV_ITER_MOVESET_SETTING_ENABLED(mode, setting)\
   (0!=(mode&MV_ITER_MOVESET_##setting##_FLAGBIT))
 #define MV_ITER_MOVESET_SETTING_DISABLED(mode, setting)\
@@ -34,7 +30,6 @@ typedef enum e_chess_move_iterator_moveset_mode {
   MV_ITER_MOVESET_COLLISIONS_ONLY_SET=1,
   MV_ITER_MOVESET_ALL_SET=2,
   MV_ITER_MOVESET_SET_TYPE_MASK=3,
-  MV_ITER_MOVESET_ORDERED_FLAGBIT=4,
 } ChessMoveIterator_MoveSetMode_e;
 
 
@@ -42,7 +37,7 @@ typedef enum e_chess_move_iterator_moveset_mode {
 EWRAM_CODE BOOL ChessMoveIterator_Alloc(ChessMoveIterator_t *dst_iterator,
                              ChessBoard_Idx_t piece_location,
                              const BoardState_t *state,
-                             ChessMoveIterator_MoveSetMode_e ordering);
+                             ChessMoveIterator_MoveSetMode_e mode);
 
 EWRAM_CODE BOOL ChessMoveIterator_HasNext(const ChessMoveIterator_t *iterator);
 EWRAM_CODE BOOL ChessMoveIterator_Next(ChessMoveIterator_t *iterator,
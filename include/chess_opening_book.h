@@ -0,0 +1,46 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#ifndef _CHESS_OPENING_BOOK_
+#define _CHESS_OPENING_BOOK_
+#include "chess_board.h"
+#include "chess_ai_types.h"
+#include "chess_transposition_table.h"
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+typedef struct s_board_state BoardState_t;
+
+/* One book move: the zobrist key of the position it's played from, split in
+ * two words so the entry packs into 12 bytes instead of being padded out to
+ * the u64's alignment, the move in TTable_Move_t packing, and how many of the
+ * book's games played it. Entries are sorted by key (key_hi first), so all of
+ * a position's moves sit together. */
+typedef struct s_chess_book_ent {
+  u32 key_lo, key_hi;
+  TTable_Move_t move;
+  u16 weight;
+} ChessBook_Entry_t;
+
+/* Generated by bin/host/book_builder (see make book), into ROM. */
+extern const ChessBook_Entry_t CHESS_OPENING_BOOK[];
+extern const u32 CHESS_OPENING_BOOK_SIZE;
+
+/**
+ * @brief Find state in the book, and pick one of its moves, each with odds in
+ * proportion to its weight. seed decides which, so different seeds vary the
+ * opening from game to game. The move is checked for legality before it's
+ * handed back, so a key collision can't make the engine play nonsense.
+ * @return TRUE and the move in move if the book knows the position, else
+ * FALSE.
+ */
+BOOL ChessBook_Probe(BoardState_t *state, u32 seed, ChessMove_t *move);
+
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _CHESS_OPENING_BOOK_ */
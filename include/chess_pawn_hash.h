@@ -0,0 +1,59 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#ifndef _CHESS_PAWN_HASH_
+#define _CHESS_PAWN_HASH_
+#include "chess_board.h"
+#include "chess_bitboard.h"
+#include "chess_board_state.h"
+#include "chess_ai_types.h"
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#ifdef __cplusplus
+extern "C" {
+#endif  /* C++ Name mangler guard */
+
+/* 512 entries (12KB) sit next to the transposition table in EWRAM. Pawn
+ * structure hardly ever changes between neighbouring nodes, so even a table
+ * this small hits almost every probe. */
+#define PAWN_HASH_SIZE (1<<9)
+#define PAWN_HASH_IDX_MASK (PAWN_HASH_SIZE-1)
+
+/* Pawn structure weights, per pawn. Passed pawns are worth more the further
+ * up the board they've made it. */
+#define PAWN_DOUBLED_MG (-10)
+#define PAWN_DOUBLED_EG (-20)
+#define PAWN_ISOLATED_MG (-10)
+#define PAWN_ISOLATED_EG (-15)
+
+/* Everything about a pawn structure that doesn't depend on the rest of the
+ * pieces. mg and eg are white-positive, like BoardState_EvalSums_t, and
+ * attack_spans[team] is every square that team's pawns attack now or could
+ * attack after pushing, indexed by BB_TEAM_IDX. A square outside the
+ * opponent's span can never be chased off by a pawn.
+ *
+ * A zeroed entry is already correct for the (key 0) position with no pawns
+ * at all, so a freshly cleared table needs no valid flag. */
+typedef struct s_pawn_hash_ent {
+  Bitboard_t attack_spans[BB_TEAM_COUNT];
+  u32 key;
+  i16 mg, eg;
+} PawnHash_Entry_t;
+
+typedef struct s_pawn_hash {
+  PawnHash_Entry_t entries[PAWN_HASH_SIZE];
+  u32 probes, hits;
+} PawnHash_t;
+
+/**
+ * @brief Look up the pawn structure of state, scoring it and replacing
+ * whatever shared its slot on a miss. The returned entry stays valid until
+ * the next probe.
+ */
+IWRAM_CODE const PawnHash_Entry_t *PawnHash_Probe(PawnHash_t *ph,
+                                                  const BoardState_t *state);
+#ifdef __cplusplus
+}
+#endif  /* C++ Name mangler guard */
+
+#endif  /* _CHESS_PAWN_HASH_ */
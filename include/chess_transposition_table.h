@@ -12,11 +12,34 @@
 extern "C" {
 #endif  /* C++ Name mangler guard */
 
+/* Entries more than this many searches old are treated as empty. */
 #define TTENT_TIME_TO_LIVE (MAX_DEPTH/2 + 2)
 
-#define TTABLE_CLUSTER_SIZE 2
-#define TTABLE_SIZE (1<<12)
+/* Generations are kept in 6 bits, so ages are taken mod 64. */
+#define TTABLE_GEN_BITS 6
+#define TTABLE_GEN_MASK ((1<<TTABLE_GEN_BITS)-1)
+#define TTABLE_BOUND_MASK 3
+static_assert(TTENT_TIME_TO_LIVE<TTABLE_GEN_MASK);
+
+/* Each search a cluster's entry has outlived costs it this much depth when
+ * deciding which entry a new one replaces. */
+#define TTABLE_AGE_WEIGHT 2
+
+#define TTABLE_CLUSTER_SIZE 4
+/* Size is set at build time, e.g. MACROS=-DTTABLE_SIZE_LOG2=12. The default
+ * 2048 clusters (64KB, 8192 entries) leaves EWRAM room for the search's
+ * per-ply move lists, history table, pawn hash and eval cache, plus the
+ * heap. */
+#ifndef TTABLE_SIZE_LOG2
+#define TTABLE_SIZE_LOG2 11
+#endif
+#define TTABLE_SIZE (1<<TTABLE_SIZE_LOG2)
 #define TTABLE_IDX_MASK (TTABLE_SIZE-1)
+
+/* Only the top 16 bits of the key are stored. The low TTABLE_SIZE_LOG2 bits
+ * already picked the cluster. */
+#define TTABLE_KEY_CHECK(key) ((u16)((key)>>48))
+
 typedef struct s_move_score {
     i16 score;
     ChessBoard_Idx_Compact_t start,dst;
@@ -24,28 +47,96 @@ typedef struct s_move_score {
     ChessPiece_e promo;
 } TTable_BestMove_Score_t;
 
+/* What best_move.score says about the node's true score. A search that
+ * failed high only proves a lower bound, one that failed low only proves an
+ * upper bound, and EXACT is both at once. */
+typedef enum e_ttable_bound {
+  TTABLE_BOUND_NONE=0,
+  TTABLE_BOUND_UPPER=1,
+  TTABLE_BOUND_LOWER=2,
+  TTABLE_BOUND_EXACT=TTABLE_BOUND_UPPER|TTABLE_BOUND_LOWER,
+} PACKED TTable_Bound_e;
+
+/* Best move packed into 16 bits: start square in bits 0-5, destination in
+ * bits 6-11 and promotion piece index in bits 12-14. Zero is no move, since
+ * a move can't start and end on a8. Move flags aren't kept, so a table move
+ * is only good for matching against generated moves. */
+typedef u16 TTable_Move_t;
+#define TTABLE_MOVE_NONE 0
+#define TTABLE_MOVE_PACK(start_sq, dst_sq, promo)\
+  ((TTable_Move_t)((start_sq)|((dst_sq)<<6)|(((promo)&PIECE_IDX_MASK)<<12)))
+#define TTABLE_MOVE_START(mv) ((mv)&63)
+#define TTABLE_MOVE_DST(mv) (((mv)>>6)&63)
+#define TTABLE_MOVE_PROMO(mv) ((ChessPiece_e)(((mv)>>12)&PIECE_IDX_MASK))
+
+/* Bound in the low 2 bits of gen_bound, generation in the upper 6. An entry
+ * with no bound is empty, which is what zeroed memory reads as. */
 typedef struct s_transposition_table_ent {
-  u64 key;
-  TTable_BestMove_Score_t best_move;
-  u8 depth, gen;
+  u16 check;
+  TTable_Move_t move;
+  i16 score;
+  u8 depth, gen_bound;
 } ALIGN(8) TTableEnt_t, TranspositionTable_Entry_t;
+static_assert(sizeof(TTableEnt_t)==8);
 
-
+/* One cluster per index, aligned to its own size so a probe only ever
+ * touches one 32-byte block. */
 typedef struct s_transposition_table_slot {
   TranspositionTable_Entry_t buckets[TTABLE_CLUSTER_SIZE];
-} TTableSlot_t, TranspositionTable_Slot_t;
+} ALIGN(32) TTableSlot_t, TranspositionTable_Slot_t;
+static_assert(sizeof(TTableSlot_t)==32);
 
 typedef struct s_transposition_table {
   TTableSlot_t slots[TTABLE_SIZE];
+  /* Probes and hits since TTable_Init. */
+  u32 probes, hits;
   u8 generation;
 } TTable_t, TranspositionTable_t;
 
+/* Unpacked view of an entry that the search reads and fills in. */
+typedef struct s_transposition_table_query {
+  u64 key;
+  TTable_BestMove_Score_t best_move;
+  u8 depth;
+  TTable_Bound_e bound;
+} TTable_Query_t;
+
+
+/**
+ * @brief Start a new game's worth of searches. Nothing is cleared. The
+ * generation jumps far enough that every entry already in the table reads
+ * as stale, and stale entries are dropped or overwritten as they're met.
+ */
+IWRAM_CODE void TTable_Init(TTable_t *tt);
+
+/**
+ * @brief Start a new search. Entries from earlier searches stay usable but
+ * get replaced sooner the older they are.
+ */
+INLN void TTable_NewSearch(TTable_t *tt) {
+  tt->generation = (tt->generation+1)&TTABLE_GEN_MASK;
+}
+
+/**
+ * @brief Look up query->key. On a hit, the stored entry is unpacked into
+ * query whatever its depth, since even a shallow entry's move is worth
+ * searching first. Whether its score can be trusted at the caller's depth and
+ * window is up to the caller (see depth and bound). The move comes back
+ * without flags.
+ */
+IWRAM_CODE BOOL TTable_Probe(TTable_t *tt, TTable_Query_t *query);
 
+IWRAM_CODE void TTable_Insert(TTable_t *tt, const TTable_Query_t *entry);
 
-IWRAM_CODE BOOL TTable_Probe(TTable_t *tt, 
-                             TTableEnt_t *query_entry) ;
+/* Entries TTable_Usage samples, from the front of the table. */
+#define TTABLE_USAGE_SAMPLE 1000
 
-IWRAM_CODE void TTable_Insert(TTable_t *tt, const TTableEnt_t *entry);
+/**
+ * @brief How full the table is with the current search's entries, in parts
+ * per TTABLE_USAGE_SAMPLE, judging by the first TTABLE_USAGE_SAMPLE entries
+ * (or all of them, in a smaller table).
+ */
+IWRAM_CODE u32 TTable_Usage(const TTable_t *tt);
 #ifdef __cplusplus
 }
 #endif  /* C++ Name mangler guard */
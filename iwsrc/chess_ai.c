@@ -3,18 +3,26 @@
 #define __TRANSPARENT_BOARD_STATE__
 
 #include <GBAdev_functions.h>
-#include <GBAdev_memmap.h>
 #include "GBAdev_memdef.h"
 #include "GBAdev_types.h"
 #include "GBAdev_util_macros.h"
 #include "chess_ai_types.h"
 #include "chess_board_state_analysis.h"
+#if defined(_AI_VISUALIZE_MOVE_SEARCH_TRAVERSAL_)\
+    || defined(_AI_VISUALIZE_MOVE_CANDIDATES_) || defined(_DEBUG_BUILD_)
 #include "chess_gameloop.h"
-#include "chess_move_iterator.h"
+#endif
+#include "chess_move_gen.h"
 #include "chess_ai.h"
 #include "chess_board.h"
 #include "chess_transposition_table.h"
+#include "chess_pawn_hash.h"
+#include "chess_eval_cache.h"
+#include "chess_opening_book.h"
+#include "chess_bitbase.h"
 #include "chess_board_state.h"
+#include "chess_clock.h"
+#include "chess_ai_platform.h"
 #include "debug_io.h"
 
 #ifdef _DEBUG_BUILD_
@@ -29,6 +37,11 @@
 #endif  /* Debug mode DFS traversal stepping control macros */
 IWRAM_CODE i16 BoardState_Eval(const BoardState_t *state,
                                Move_Validation_Flag_e last_move);
+static IWRAM_CODE i16 ChessAI_Eval(const BoardState_t *state,
+                                   Move_Validation_Flag_e last_move);
+static IWRAM_CODE BOOL ChessAI_IsDraw(const ChessAI_Params_t *params);
+static IWRAM_CODE BOOL ChessAI_IsCheckmate(const ChessAI_Params_t *params);
+static IWRAM_CODE void ChessAI_ResetPonder(ChessAI_Params_t *params);
 
 typedef union u_chess_ai_piece_tracker {
   struct s_chess_ai_piece_tracker {
@@ -43,6 +56,97 @@ typedef union u_chess_ai_piece_tracker {
 
 
 static EWRAM_BSS TranspositionTable_t g_ttable;
+// A pawn hash entry depends on nothing but its key, so unlike the
+// transposition table it's kept from one search to the next (though not
+// from one ChessAI_Params_Init to the next).
+static EWRAM_BSS PawnHash_t g_pawn_hash;
+// Same goes for leaf evals, which are most of what a search computes.
+static EWRAM_BSS EvalCache_t g_eval_cache;
+// One move list per ply, so generating moves at a node doesn't clobber the
+// list its parent is still walking.
+static EWRAM_BSS ChessMoveList_t g_ply_move_lists[MAX_SEARCH_PLY];
+// Quiet moves that caused a cutoff: the last two per ply (killers), and a
+// running tally per side, start and destination square (butterfly history).
+static EWRAM_BSS ChessMove_t g_killers[MAX_SEARCH_PLY][2];
+static EWRAM_BSS u16 g_history[BB_TEAM_COUNT][BB_SQUARE_COUNT][BB_SQUARE_COUNT];
+// Triangular PV table: g_pv[ply] holds the best line found from ply on, and
+// g_pv_length[ply] how many moves long it is.
+static EWRAM_BSS ChessMove_t g_pv[MAX_SEARCH_PLY][MAX_DEPTH];
+static EWRAM_BSS u8 g_pv_length[MAX_SEARCH_PLY];
+// Zobrist keys of the game so far and then the line being searched, the
+// current node's on top. See ChessAI_Params_t::key_count.
+static EWRAM_BSS u64 g_key_history[CHESS_AI_KEY_HISTORY_SIZE];
+
+/* The search runs as a state machine over an explicit stack of nodes rather
+ * than by recursion, so it can stop after any step and carry on later right
+ * where it was. Each frame is one node. resume says what it does next, which
+ * for a node waiting on a child is what to do with the child's result. */
+#define CHESS_AI_SEARCH_STACK_SIZE (MAX_SEARCH_PLY+1)
+typedef enum e_chess_ai_search_resume {
+  CHESS_AI_AB_ENTER=0,
+  CHESS_AI_AB_AFTER_QSEARCH,
+  CHESS_AI_AB_AFTER_NULL_MOVE,
+  CHESS_AI_AB_GENERATE,
+  CHESS_AI_AB_NEXT_MOVE,
+  CHESS_AI_AB_AFTER_NULL_WINDOW,
+  CHESS_AI_AB_AFTER_UNREDUCED,
+  CHESS_AI_AB_AFTER_SEARCH,
+  CHESS_AI_AB_FINISH,
+  CHESS_AI_Q_ENTER,
+  CHESS_AI_Q_NEXT_MOVE,
+  CHESS_AI_Q_AFTER_CHILD,
+  CHESS_AI_Q_FINISH,
+} PACKED ChessAI_SearchResume_e;
+
+/* Where iterative deepening is at, between root searches. */
+typedef enum e_chess_ai_search_drive {
+  CHESS_AI_DRIVE_ITERATE=0,
+  CHESS_AI_DRIVE_ASPIRATE,
+  CHESS_AI_DRIVE_AFTER_ASPIRATE,
+  CHESS_AI_DRIVE_AFTER_ITERATION,
+  CHESS_AI_DRIVE_DONE,
+} PACKED ChessAI_SearchDrive_e;
+
+typedef struct s_chess_ai_search_frame {
+  BoardState_Undo_t undo;
+  TTable_Query_t tt_entry;
+  // Result of the child just searched, until the node is done with it.
+  ChessAI_MoveSearch_Result_t child;
+  ChessMove_t tt_move;
+  const ChessMove_t *mv;
+  ChessMoveList_t *moves;
+  u32 mv_idx, legal_moves, reduction, qply;
+  i16 alpha, beta, alpha_orig, beta_orig, best, stand_pat;
+  Move_Validation_Flag_e last_move;
+  ChessAI_SearchResume_e resume;
+  BOOL maximizing, on_pv, in_check, after_null, child_on_pv;
+} ChessAI_SearchFrame_t;
+
+static EWRAM_BSS struct s_chess_ai_search {
+  ChessAI_SearchFrame_t frames[CHESS_AI_SEARCH_STACK_SIZE];
+  // What the last node to finish returned to its parent.
+  ChessAI_MoveSearch_Result_t ret;
+  // Best root move so far.
+  ChessAI_MoveSearch_Result_t best;
+  // Tick the search started, and the time budget to restore when it's done.
+  u32 start, budget;
+  u32 max_depth, iter_depth;
+  int asp_alpha, asp_beta, asp_delta;
+  // Index of the top frame, or -1 between root searches.
+  int sp;
+  ChessAI_SearchDrive_e drive;
+  // Takes back ponder_move once pondering is over.
+  BoardState_Undo_t ponder_undo;
+} g_search;
+
+/* How long ChessAI_Ponder searches between looks at the keypad. */
+#define CHESS_AI_PONDER_SLICE CHESS_CLOCK_MS_TO_TICKS(1)
+
+#define CHESS_AI_SCORE_ONLY(score_) ((ChessAI_MoveSearch_Result_t) {\
+    .score = (score_),\
+    .start = INVALID_IDX_COMPACT,\
+    .dst = INVALID_IDX_COMPACT,\
+  })
 #ifdef _AI_VISUALIZE_MOVE_SEARCH_TRAVERSAL_
 #include "chess_obj_sprites_data.h"
 #define SPRITE_VRAM_TILE_IDX(sprite_type) (2*TILES_PER_CSPR*sprite_type)
@@ -89,15 +193,49 @@ INLN IWRAM_CODE void UPDATE_MOVE_TRAVERSAL_SEL_SPRITE(int sel_idx,
 #define UPDATE_MOVE_TRAVERSAL_SEL_SPRITE(dummy_field0, dummy_field1)
 #endif  /* _AI_VISUALIZE_MOVE_SEARCH_TRAVERSAL_ */
 
-INLN IWRAM_CODE i16 Piece_Eval(ChessPiece_e piece);
-INLN IWRAM_CODE i16 Positional_Eval(ChessPiece_e piece,
-                                    ChessBoard_Idx_Compact_t loc);
-
 
-static IWRAM_CODE ChessAI_MoveSearch_Result_t ChessAI_ABSearch(
-                                                      ChessAI_Params_t *params,
-                                                      i16 alpha,
-                                                      i16 beta);
+static IWRAM_CODE void ChessAI_SearchBegin(ChessAI_Params_t *params);
+static IWRAM_CODE BOOL ChessAI_SearchStep(ChessAI_Params_t *params,
+                                          u32 slice_ticks);
+static IWRAM_CODE BOOL ChessAI_SearchDrive(ChessAI_Params_t *params);
+static IWRAM_CODE void ChessAI_ABNode(ChessAI_Params_t *params,
+                                      ChessAI_SearchFrame_t *frame);
+static IWRAM_CODE void ChessAI_ABResearch(ChessAI_Params_t *params,
+                                          ChessAI_SearchFrame_t *frame);
+static IWRAM_CODE void ChessAI_ABAfterChild(ChessAI_Params_t *params,
+                                            ChessAI_SearchFrame_t *frame);
+static IWRAM_CODE void ChessAI_QNode(ChessAI_Params_t *params,
+                                     ChessAI_SearchFrame_t *frame);
+static IWRAM_CODE u32 ChessAI_GenerateCaptures(const BoardState_t *state,
+                                               ChessMoveList_t *list);
+static IWRAM_CODE void ChessAI_ScoreMoves(const BoardState_t *state,
+                                         ChessMoveList_t *list,
+                                         const ChessMove_t *hash_move,
+                                         u32 ply);
+static IWRAM_CODE const ChessMove_t *ChessAI_PickNextMove(
+                                                         ChessMoveList_t *list,
+                                                         u32 idx);
+static IWRAM_CODE void ChessAI_QuietCutoff(const ChessMove_t *mv,
+                                           u32 team_idx,
+                                           u32 ply,
+                                           u32 depth);
+static IWRAM_CODE void ChessAI_AgeHistory(void);
+INLN IWRAM_CODE BOOL ChessAI_SameMove(const ChessMove_t *a,
+                                      const ChessMove_t *b);
+INLN IWRAM_CODE void ChessAI_UpdatePV(u32 ply, const ChessMove_t *mv);
+INLN IWRAM_CODE i16 ChessAI_ScoreToTT(i16 score, u32 ply);
+INLN IWRAM_CODE i16 ChessAI_ScoreFromTT(i16 score, u32 ply);
+INLN IWRAM_CODE void ChessAI_SearchCall(ChessAI_SearchFrame_t *caller,
+                                        ChessAI_SearchResume_e resume,
+                                        ChessAI_SearchResume_e entry,
+                                        i16 alpha,
+                                        i16 beta,
+                                        u32 qply);
+INLN IWRAM_CODE void ChessAI_SearchCallNullWindow(
+                                                ChessAI_SearchFrame_t *caller,
+                                                ChessAI_SearchResume_e resume);
+INLN IWRAM_CODE void ChessAI_SearchReturn(ChessAI_MoveSearch_Result_t result);
+INLN IWRAM_CODE BOOL ChessAI_OutOfTime(const ChessAI_Params_t *params);
 #ifdef _AI_VISUALIZE_MOVE_SEARCH_TRAVERSAL_
 
 
@@ -255,301 +393,1181 @@ IWRAM_CODE void ChessAI_Params_Init(ChessAI_Params_t *obj,
                                     BoardState_t *root_state,
                                     int depth,
                                     u32 team) {
-  static_assert(0==(sizeof(g_ttable)%sizeof(WORD)));
-  Fast_Memset32((obj->ttable = &g_ttable), 
-                0UL,
-                sizeof(g_ttable)/sizeof(WORD));
+  static_assert(0==(sizeof(g_history)%sizeof(WORD)));
+  static_assert(0==(sizeof(g_pawn_hash)%sizeof(WORD)));
+  static_assert(0==(sizeof(g_eval_cache)%sizeof(WORD)));
+  TTable_Init((obj->ttable = &g_ttable));
+  Fast_Memset32(g_history, 0UL, sizeof(g_history)/sizeof(WORD));
+  // A new game starts from scratch, so the same position always searches
+  // the same way.
+  Fast_Memset32(&g_pawn_hash, 0UL, sizeof(g_pawn_hash)/sizeof(WORD));
+  Fast_Memset32(&g_eval_cache, 0UL, sizeof(g_eval_cache)/sizeof(WORD));
   obj->root_state = root_state;
   obj->depth = depth;
-  obj->gen = 0;
+  obj->ply = 0;
   obj->team = CONVERT_CTX_MOVE_FLAG(team);
+  obj->nodes = 0;
+  obj->stop = FALSE;
+  obj->pv_length = 0;
+  obj->completed_depth = 0;
+  obj->follow_pv = FALSE;
+  obj->prune = CHESS_AI_PRUNE_ALL;
+  obj->book = TRUE;
+  obj->after_null = FALSE;
+  obj->key_count = 0;
+  ChessAI_ResetPonder(obj);
+  ChessAI_RecordGamePosition(obj);
+#ifdef _AI_VISUALIZE_MOVE_SEARCH_TRAVERSAL_
+  // Stepping through the traversal by hand would blow any budget.
+  obj->time_budget = 0;
+#else
+  obj->time_budget = CHESS_CLOCK_MS_TO_TICKS(CHESS_AI_MOVE_TIME_MS);
+#endif
 #ifdef _AI_VISUALIZE_MOVE_CANDIDATES_
   Fast_Memcpy32(&_L_sels[0], &SEL_INITIALIZER, sizeof(Obj_Attr_t)/sizeof(WORD));
   Fast_Memcpy32(&_L_sels[1], &_L_sels[0], sizeof(Obj_Attr_t)/sizeof(WORD));
 #endif  /* _AI_VISUALIZE_MOVE_CANDIDATES_ */
 }
 
+IWRAM_CODE void ChessAI_RecordGamePosition(ChessAI_Params_t *ai_params) {
+  const BoardState_t *const STATE = ai_params->root_state;
+  // Nothing from before a capture or pawn move can ever come up again.
+  if (0==STATE->state.halfmove_clock)
+    ai_params->key_count = 0;
+  // Past the fifty-move mark, the oldest position is out of reach anyway.
+  if (CHESS_AI_FIFTY_MOVE_PLIES<ai_params->key_count) {
+    for (u32 i = 1; ai_params->key_count>i; ++i)
+      g_key_history[i-1] = g_key_history[i];
+    --ai_params->key_count;
+  }
+  g_key_history[ai_params->key_count++] = STATE->zobrist;
+}
+
 IWRAM_CODE void ChessAI_Move(ChessAI_Params_t *ai_params,
                              ChessAI_MoveSearch_Result_t *returned_move) {
-  const u32 ini_depth = ai_params->depth;
+  ChessAI_MoveBegin(ai_params);
 #ifdef _DEBUG_BUILD_
-   *returned_move
-        = ChessAI_ABSearch(ai_params,
-                           INT16_MIN,
-                           INT16_MAX); 
+  ChessAI_MoveStep(ai_params, 0);
 #else
-  REG_IME = 0;
-  REG_IE &= ~IRQ_FLAGS(VBLANK, KEYPAD);
-  REG_IME = 1;
-  *returned_move
-        = ChessAI_ABSearch(ai_params,
-                           INT16_MIN,
-                           INT16_MAX);
-  REG_IME = 0;
-  REG_IF |= IRQ_FLAGS(VBLANK, KEYPAD);
-  REG_IE |= IRQ_FLAGS(VBLANK, KEYPAD);
-  REG_IME = 1;
+  ChessAI_Platform_SearchIRQs_Disable();
+  ChessAI_MoveStep(ai_params, 0);
+  ChessAI_Platform_SearchIRQs_Enable();
 #endif
-  ai_params->depth = ini_depth;
-  ++ai_params->gen;
+  ChessAI_MoveEnd(ai_params, returned_move);
+}
+
+IWRAM_CODE void ChessAI_MoveBegin(ChessAI_Params_t *ai_params) {
+  const BOOL PONDER_HIT
+      = INVALID_IDX_COMPACT_RAW!=ai_params->ponder_best.start.raw
+        && ai_params->ponder_key==ai_params->root_state->zobrist;
+  ChessMove_t book_move;
+  assert(!ai_params->pondering);
+  g_search.budget = ai_params->time_budget;
+  // A book move costs no search at all. The clock makes a good enough seed
+  // to vary the opening between games.
+  if (ai_params->book
+      && ChessBook_Probe(ai_params->root_state,
+                         ChessClock_Ticks(),
+                         &book_move)) {
+    g_search.best = (ChessAI_MoveSearch_Result_t) {
+      .score = 0,
+      .start = book_move.start,
+      .dst = book_move.dst,
+      .promo = book_move.promotion,
+      .mv_flags = book_move.flags,
+    };
+    ai_params->pv[0] = book_move;
+    ai_params->pv_length = 1;
+    ai_params->completed_depth = 0;
+    ai_params->nodes = ai_params->qnodes = 0;
+    g_search.max_depth = ai_params->depth;
+    g_search.sp = -1;
+    g_search.drive = CHESS_AI_DRIVE_DONE;
+    return;
+  }
+  // The opponent played the move pondered on. If pondering got as deep as
+  // the last search did, its answer stands. Otherwise the search runs as
+  // usual, but finds the depths pondering covered in the table.
+  if (PONDER_HIT && ai_params->ponder_depth>=ai_params->ponder_target) {
+    g_search.best = ai_params->ponder_best;
+    g_search.max_depth = ai_params->depth;
+    g_search.sp = -1;
+    g_search.drive = CHESS_AI_DRIVE_DONE;
+    return;
+  }
+  ChessAI_SearchBegin(ai_params);
+}
+
+IWRAM_CODE BOOL ChessAI_MoveStep(ChessAI_Params_t *ai_params,
+                                 u32 slice_ticks) {
+  return ChessAI_SearchStep(ai_params, slice_ticks);
+}
+
+IWRAM_CODE void ChessAI_MoveRestartClock(ChessAI_Params_t *ai_params,
+                                         u32 budget_ticks) {
+  // Both the deadline and the rule against starting another iteration past
+  // half the budget go by g_search.start.
+  g_search.start = ChessClock_Ticks();
+  ai_params->time_budget = budget_ticks;
+  ai_params->deadline = g_search.start+budget_ticks;
 }
 
+IWRAM_CODE void ChessAI_MoveEnd(ChessAI_Params_t *ai_params,
+                                ChessAI_MoveSearch_Result_t *returned_move) {
+  assert(CHESS_AI_DRIVE_DONE==g_search.drive);
+  ai_params->time_budget = g_search.budget;
+  *returned_move = g_search.best;
+  TTable_NewSearch(ai_params->ttable);
+  // The PV's second move is the reply this search expects, so that's what
+  // to ponder on. The PV always starts with the move being returned.
+  ChessAI_ResetPonder(ai_params);
+  if (1<ai_params->pv_length)
+    ai_params->ponder_move = ai_params->pv[1];
+  // A search without a budget always goes to full depth, and so does one
+  // that never got to run (i.e.: a book move).
+  ai_params->ponder_target
+    = ai_params->time_budget && ai_params->completed_depth
+        ? ai_params->completed_depth
+        : g_search.max_depth;
+}
+
+IWRAM_CODE BOOL ChessAI_Ponder(ChessAI_Params_t *ai_params) {
+  BoardState_t *const STATE = ai_params->root_state;
+  const BOOL PREDICTED
+                = INVALID_IDX_COMPACT_RAW!=ai_params->ponder_move.start.raw;
+  BOOL done;
+  if (ChessAI_Platform_Input_Pending()) {
+    ChessAI_Platform_Input_Clear();
+    return TRUE;
+  }
+  if (ai_params->ponder_done)
+    return FALSE;
+  // First call since the last move: set the search up, and from here on
+  // just pick it back up where the last keypress left it.
+  if (!ai_params->pondering) {
+    if (PREDICTED) {
+      BoardState_MakeMove(STATE,
+                          &ai_params->ponder_move,
+                          &g_search.ponder_undo);
+      ai_params->ponder_key = STATE->zobrist;
+      g_key_history[ai_params->key_count++] = STATE->zobrist;
+    }
+    ai_params->pondering = TRUE;
+    g_search.budget = ai_params->time_budget;
+    ai_params->time_budget = 0;
+    ChessAI_SearchBegin(ai_params);
+  }
+  do {
+    done = ChessAI_SearchStep(ai_params, CHESS_AI_PONDER_SLICE);
+    // An iteration's result is only ever replaced by the next one's, so
+    // whatever the latest finished depth is, g_search.best is its answer.
+    if (PREDICTED && ai_params->completed_depth>ai_params->ponder_depth) {
+      ai_params->ponder_best = g_search.best;
+      ai_params->ponder_depth = ai_params->completed_depth;
+    }
+    if (done) {
+      ChessAI_PonderEnd(ai_params);
+      ai_params->ponder_done = TRUE;
+      return FALSE;
+    }
+  } while (!ChessAI_Platform_Input_Pending());
+  ChessAI_Platform_Input_Clear();
+  return TRUE;
+}
+
+IWRAM_CODE void ChessAI_PonderEnd(ChessAI_Params_t *ai_params) {
+  if (!ai_params->pondering)
+    return;
+  // Unwind whatever's left of the search, back to the pondered position.
+  if (CHESS_AI_DRIVE_DONE!=g_search.drive) {
+    ai_params->stop = TRUE;
+    ChessAI_SearchStep(ai_params, 0);
+  }
+  ai_params->time_budget = g_search.budget;
+  ai_params->pondering = FALSE;
+  if (INVALID_IDX_COMPACT_RAW!=ai_params->ponder_move.start.raw) {
+    --ai_params->key_count;
+    BoardState_UnmakeMove(ai_params->root_state, &g_search.ponder_undo);
+  }
+}
 
+IWRAM_CODE void ChessAI_SearchBegin(ChessAI_Params_t *params) {
+  g_search.start = ChessClock_Ticks();
+  g_search.best = CHESS_AI_SCORE_ONLY(0);
+  g_search.max_depth = params->depth;
+  g_search.iter_depth = 1;
+  g_search.sp = -1;
+  g_search.drive = CHESS_AI_DRIVE_ITERATE;
+  params->nodes = 0;
+  params->qnodes = 0;
+  params->stop = FALSE;
+  params->abort = FALSE;
+  params->deadline = g_search.start+params->time_budget;
+  params->pv_length = 0;
+  params->completed_depth = 0;
+  // Killers only make sense for the position they were found in, but the
+  // history is still a fair guess, so it just gets faded.
+  static_assert(0==(sizeof(g_killers)%sizeof(WORD)));
+  Fast_Memset32(g_killers, INVALID_IDX_COMPACT_RAW*0x01010101UL,
+                sizeof(g_killers)/sizeof(WORD));
+  ChessAI_AgeHistory();
+}
 
-IWRAM_CODE ChessAI_MoveSearch_Result_t ChessAI_ABSearch(
-                                                      ChessAI_Params_t *params,
-                                                      i16 alpha,
-                                                      i16 beta) {
-  ENSURE_STACK_SAFETY();
+IWRAM_CODE BOOL ChessAI_SearchStep(ChessAI_Params_t *params,
+                                   u32 slice_ticks) {
+  const u32 SLICE_END = ChessClock_Ticks()+slice_ticks;
+  const u16 COMPLETED_DEPTH = params->completed_depth;
+  ChessAI_SearchFrame_t *frame;
+  // Every bit of search state lives in the frames, g_search and params, so
+  // it's safe to leave off between any two steps.
+  for (u32 steps = 0; ; ) {
+    if (slice_ticks
+        && 0==(++steps&CHESS_AI_TIME_CHECK_MASK)
+        && CHESS_CLOCK_EXPIRED(SLICE_END))
+      return FALSE;
+    if (0>g_search.sp) {
+      if (ChessAI_SearchDrive(params))
+        return TRUE;
+      // A sliced search leaves off after every iteration it finishes, so
+      // the caller gets to see each one.
+      if (slice_ticks && COMPLETED_DEPTH!=params->completed_depth)
+        return FALSE;
+      continue;
+    }
+    frame = &g_search.frames[g_search.sp];
+    if (CHESS_AI_Q_ENTER<=frame->resume)
+      ChessAI_QNode(params, frame);
+    else
+      ChessAI_ABNode(params, frame);
+  }
+}
 
-    // 1. Check transposition table
-  TTableEnt_t tt_entry = {
-    .key = params->root_state->zobrist,
-    .depth = params->depth,
-    .gen = params->gen,
-    .best_move = {
-      .dst.raw=0xFF,
-      .start.raw = 0xFF,
+/* Iterative deepening, from depth 1 up to the params->depth the search began
+ * with. Each call either starts a root search or deals with the one that
+ * just finished, and returns TRUE once there's nothing left to search. */
+IWRAM_CODE BOOL ChessAI_SearchDrive(ChessAI_Params_t *params) {
+  ChessAI_MoveSearch_Result_t iter;
+  switch (g_search.drive) {
+  case CHESS_AI_DRIVE_ITERATE:
+    if (g_search.max_depth<g_search.iter_depth) {
+      g_search.drive = CHESS_AI_DRIVE_DONE;
+      return FALSE;
     }
-  };
-  if (TTable_Probe(params->ttable, &tt_entry)) {
-    if (tt_entry.depth >= params->depth) {
-      return tt_entry.best_move;
+    params->depth = g_search.iter_depth;
+    if (CHESS_AI_ASPIRATION_MIN_DEPTH>g_search.iter_depth) {
+      params->follow_pv = TRUE;
+      g_search.drive = CHESS_AI_DRIVE_AFTER_ITERATION;
+      ChessAI_SearchCall(NULL, 0, CHESS_AI_AB_ENTER, INT16_MIN, INT16_MAX, 0);
+      return FALSE;
+    }
+    // From here on, each root search starts in a window around the last
+    // iteration's score.
+    g_search.asp_delta = CHESS_AI_ASPIRATION_WINDOW;
+    g_search.asp_alpha = g_search.best.score-g_search.asp_delta;
+    g_search.asp_beta = g_search.best.score+g_search.asp_delta;
+    g_search.drive = CHESS_AI_DRIVE_ASPIRATE;
+    return FALSE;
+  case CHESS_AI_DRIVE_ASPIRATE:
+    if (INT16_MIN>g_search.asp_alpha)
+      g_search.asp_alpha = INT16_MIN;
+    if (INT16_MAX<g_search.asp_beta)
+      g_search.asp_beta = INT16_MAX;
+    params->follow_pv = TRUE;
+    g_search.drive = CHESS_AI_DRIVE_AFTER_ASPIRATE;
+    ChessAI_SearchCall(NULL, 0, CHESS_AI_AB_ENTER,
+                       (i16)g_search.asp_alpha, (i16)g_search.asp_beta, 0);
+    return FALSE;
+  case CHESS_AI_DRIVE_AFTER_ASPIRATE:
+    // Outside the window, the score is only a bound. Widen the side it fell
+    // out of, twice as far each time, and search again.
+    g_search.drive = CHESS_AI_DRIVE_AFTER_ITERATION;
+    if (params->stop)
+      return FALSE;
+    if (INT16_MIN<g_search.asp_alpha
+        && g_search.ret.score<=g_search.asp_alpha) {
+      g_search.asp_delta <<= 1;
+      g_search.asp_alpha = g_search.ret.score-g_search.asp_delta;
+      g_search.drive = CHESS_AI_DRIVE_ASPIRATE;
+    } else if (INT16_MAX>g_search.asp_beta
+               && g_search.ret.score>=g_search.asp_beta) {
+      g_search.asp_delta <<= 1;
+      g_search.asp_beta = g_search.ret.score+g_search.asp_delta;
+      g_search.drive = CHESS_AI_DRIVE_ASPIRATE;
+    }
+    return FALSE;
+  case CHESS_AI_DRIVE_AFTER_ITERATION:
+    iter = g_search.ret;
+    // An aborted iteration still searched the last best move first, so any
+    // root move it did finish is at least as good a pick as that one.
+    if (INVALID_IDX_COMPACT_RAW!=iter.start.raw)
+      g_search.best = iter;
+    if (!params->stop) {
+      params->pv_length = g_pv_length[0];
+      for (u32 i = 0; params->pv_length>i; ++i)
+        params->pv[i] = g_pv[0][i];
+      params->completed_depth = g_search.iter_depth;
+      params->completed_score = iter.score;
+    }
+    // A table hit at the root leaves no line behind, and an aborted
+    // iteration may have switched moves. Either way, all that's known is
+    // the move.
+    if (INVALID_IDX_COMPACT_RAW!=g_search.best.start.raw
+        && (0==params->pv_length
+            || g_search.best.start.raw!=params->pv[0].start.raw
+            || g_search.best.dst.raw!=params->pv[0].dst.raw
+            || g_search.best.promo!=params->pv[0].promotion)) {
+      params->pv[0] = (ChessMove_t) {
+        .start = g_search.best.start,
+        .dst = g_search.best.dst,
+        .flags = g_search.best.mv_flags,
+        .promotion = g_search.best.promo,
+      };
+      params->pv_length = 1;
+    }
+    g_search.drive = CHESS_AI_DRIVE_ITERATE;
+    ++g_search.iter_depth;
+    // Each iteration costs several times the last one, so don't start one
+    // once half the budget is gone. It would only be thrown away.
+    if (params->stop
+        || (params->time_budget
+            && ChessClock_Ticks()-g_search.start>(params->time_budget>>1)))
+      g_search.drive = CHESS_AI_DRIVE_DONE;
+    return FALSE;
+  case CHESS_AI_DRIVE_DONE:
+  default:
+    params->depth = g_search.max_depth;
+    return TRUE;
+  }
+}
+
+IWRAM_CODE BOOL ChessAI_OutOfTime(const ChessAI_Params_t *params) {
+  // Pondering has no budget, and ChessAI_Ponder leaves off between slices
+  // for keypresses, so it only ever ends through ChessAI_PonderEnd.
+  // The PV only gets set once depth 1 has finished, and depth 1 is never
+  // cut short, not even by ChessAI_MoveAbort.
+  return params->pv_length
+      && (params->abort
+          || (params->time_budget && CHESS_CLOCK_EXPIRED(params->deadline)));
+}
+
+/* Rough piece values for MVV-LVA ordering, and for pruning captures in the
+ * quiescence search. The king never gets traded, so it outranks everything. */
+static const u8 MOVE_ORDER_PIECE_VALUES[8] = {
+  [PAWN_IDX] = 1, [KNIGHT_IDX] = 3, [BISHOP_IDX] = 3, [ROOK_IDX] = 5,
+  [QUEEN_IDX] = 9, [KING_IDX] = 100, [EMPTY_IDX] = 0,
+};
+#define MOVE_ORDER_PIECE_VALUE(piece)\
+  MOVE_ORDER_PIECE_VALUES[PIECE_IDX_MASK&(piece)]
+
+/* Move ordering tiers. The hash move goes first, then captures (and queen
+ * promotions) by most valuable victim/least valuable attacker, then the two
+ * killers, then every other quiet move by its history score. Histories are
+ * kept under MOVE_ORDER_HISTORY_MAX so they never climb into the killers. */
+#define MOVE_ORDER_HASH_MOVE 30000
+#define MOVE_ORDER_CAPTURE 20000
+#define MOVE_ORDER_KILLER 19000
+#define MOVE_ORDER_HISTORY_MAX 16383
+
+IWRAM_CODE BOOL ChessAI_SameMove(const ChessMove_t *a, const ChessMove_t *b) {
+  return a->start.raw==b->start.raw
+      && a->dst.raw==b->dst.raw
+      && a->promotion==b->promotion;
+}
+
+IWRAM_CODE void ChessAI_ScoreMoves(const BoardState_t *state,
+                                   ChessMoveList_t *list,
+                                   const ChessMove_t *hash_move,
+                                   u32 ply) {
+  const ChessPiece_e (*board)[CHESS_BOARD_FILE_COUNT] = state->board;
+  const u16 (*history)[BB_SQUARE_COUNT] = g_history[BB_TEAM_IDX(
+                    CONVERT_BOARD_STATE_MOVE_FLAG(state->state.side_to_move))];
+  const ChessMove_t *const killers = g_killers[ply];
+  const BOOL HASH_MOVE = INVALID_IDX_COMPACT_RAW!=hash_move->start.raw;
+  int victim;
+  for (u32 i = 0; list->count>i; ++i) {
+    const ChessMove_t *const MV = &list->moves[i];
+    if (HASH_MOVE && ChessAI_SameMove(MV, hash_move)) {
+      list->scores[i] = MOVE_ORDER_HASH_MOVE;
+    } else if ((MOVE_CAPTURE&MV->flags) || QUEEN_IDX==MV->promotion) {
+      victim = (MOVE_EN_PASSENT&MV->flags)
+                ? MOVE_ORDER_PIECE_VALUE(PAWN_IDX)
+                : MOVE_ORDER_PIECE_VALUE(board[BOARD_IDX(MV->dst)]);
+      if (MV->promotion)
+        victim += MOVE_ORDER_PIECE_VALUE(MV->promotion);
+      list->scores[i] = MOVE_ORDER_CAPTURE + (victim<<6)
+                      - MOVE_ORDER_PIECE_VALUE(board[BOARD_IDX(MV->start)]);
+    } else if (ChessAI_SameMove(MV, &killers[0])) {
+      list->scores[i] = MOVE_ORDER_KILLER;
+    } else if (ChessAI_SameMove(MV, &killers[1])) {
+      list->scores[i] = MOVE_ORDER_KILLER-1;
+    } else {
+      list->scores[i] = history[BB_SQ_FROM_COMPACT(MV->start)]
+                               [BB_SQ_FROM_COMPACT(MV->dst)];
     }
   }
+}
+
+/* Lazy selection sort: swaps the best scoring move left in list->moves[idx..]
+ * into idx. A node that cuts off early never pays to order the rest. */
+IWRAM_CODE const ChessMove_t *ChessAI_PickNextMove(ChessMoveList_t *list,
+                                                   u32 idx) {
+  u32 best_idx = idx;
+  ChessMove_t tmp;
+  i16 tmp_score;
+  for (u32 i = idx+1; list->count>i; ++i)
+    if (list->scores[i]>list->scores[best_idx])
+      best_idx = i;
+  if (best_idx!=idx) {
+    tmp = list->moves[idx];
+    list->moves[idx] = list->moves[best_idx];
+    list->moves[best_idx] = tmp;
+    tmp_score = list->scores[idx];
+    list->scores[idx] = list->scores[best_idx];
+    list->scores[best_idx] = tmp_score;
+  }
+  return &list->moves[idx];
+}
+
+/* Credit a quiet move that failed high. Deeper cutoffs prune more, so they
+ * count for more. */
+IWRAM_CODE void ChessAI_QuietCutoff(const ChessMove_t *mv,
+                                    u32 team_idx,
+                                    u32 ply,
+                                    u32 depth) {
+  u16 *const entry = &g_history[team_idx][BB_SQ_FROM_COMPACT(mv->start)]
+                                         [BB_SQ_FROM_COMPACT(mv->dst)];
+  ChessMove_t *const killers = g_killers[ply];
+  if (!ChessAI_SameMove(mv, &killers[0])) {
+    killers[1] = killers[0];
+    killers[0] = *mv;
+  }
+  *entry += depth*depth;
+  if (MOVE_ORDER_HISTORY_MAX<*entry)
+    ChessAI_AgeHistory();
+}
+
+/* Halves every history score, two at a time. */
+IWRAM_CODE void ChessAI_AgeHistory(void) {
+  u32 *const words = (u32*)g_history;
+  for (u32 i = 0; sizeof(g_history)/sizeof(u32)>i; ++i)
+    words[i] = (words[i]>>1)&0x7FFF7FFFUL;
+}
+
+/* Table entries are shared by every path to a position, so mate scores go
+ * in counted from the node itself, and come back out counted from the root
+ * again at whatever ply the probing node sits. */
+IWRAM_CODE i16 ChessAI_ScoreToTT(i16 score, u32 ply) {
+  if (CHESS_AI_MATE_BOUND<=score)
+    return score+(i16)ply;
+  if (-CHESS_AI_MATE_BOUND>=score)
+    return score-(i16)ply;
+  return score;
+}
+
+IWRAM_CODE i16 ChessAI_ScoreFromTT(i16 score, u32 ply) {
+  if (CHESS_AI_MATE_BOUND<=score)
+    return score-(i16)ply;
+  if (-CHESS_AI_MATE_BOUND>=score)
+    return score+(i16)ply;
+  return score;
+}
 
-  // 2. Base case
-  if (params->depth == 0) {
-    return (ChessAI_MoveSearch_Result_t) {
-      .score = BoardState_Eval(params->root_state, params->last_move),
+/* Pushes a child node searching (alpha, beta), which picks up at entry. Its
+ * caller picks up at resume once it returns. The driver calls the root with
+ * no caller frame. */
+IWRAM_CODE void ChessAI_SearchCall(ChessAI_SearchFrame_t *caller,
+                                   ChessAI_SearchResume_e resume,
+                                   ChessAI_SearchResume_e entry,
+                                   i16 alpha,
+                                   i16 beta,
+                                   u32 qply) {
+  ChessAI_SearchFrame_t *child;
+  if (NULL!=caller)
+    caller->resume = resume;
+  assert(CHESS_AI_SEARCH_STACK_SIZE-1>g_search.sp);
+  child = &g_search.frames[++g_search.sp];
+  child->resume = entry;
+  child->alpha = alpha;
+  child->beta = beta;
+  child->qply = qply;
+}
+
+/* Searches the child with a null window at the bound the side to move in
+ * caller is trying to raise: alpha for white, beta for black. */
+IWRAM_CODE void ChessAI_SearchCallNullWindow(ChessAI_SearchFrame_t *caller,
+                                             ChessAI_SearchResume_e resume) {
+  if (caller->maximizing)
+    ChessAI_SearchCall(caller, resume, CHESS_AI_AB_ENTER,
+                       caller->alpha, caller->alpha+1, 0);
+  else
+    ChessAI_SearchCall(caller, resume, CHESS_AI_AB_ENTER,
+                       caller->beta-1, caller->beta, 0);
+}
+
+/* Pops the top node, handing result to its parent. */
+IWRAM_CODE void ChessAI_SearchReturn(ChessAI_MoveSearch_Result_t result) {
+  assert(0<=g_search.sp);
+  g_search.ret = result;
+  --g_search.sp;
+}
+
+/* mv is ply's new best move, so its line becomes mv followed by the line the
+ * child node just left behind. */
+IWRAM_CODE void ChessAI_UpdatePV(u32 ply, const ChessMove_t *mv) {
+  const ChessMove_t *const child = g_pv[ply+1];
+  const u32 CHILD_LENGTH = g_pv_length[ply+1];
+  assert(MAX_DEPTH>CHILD_LENGTH);
+  g_pv[ply][0] = *mv;
+  for (u32 i = 0; CHILD_LENGTH>i; ++i)
+    g_pv[ply][i+1] = child[i];
+  g_pv_length[ply] = 1+CHILD_LENGTH;
+}
+
+
+
+/* The side to move's roster ids, as the search's check tests want them. */
+#define SEARCH_TEAM_OFS(board)\
+  ((board)->state.side_to_move&WHITE_TO_MOVE_FLAGBIT\
+    ?PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT:0)
+
+IWRAM_CODE void ChessAI_ABNode(ChessAI_Params_t *params,
+                               ChessAI_SearchFrame_t *frame) {
+  BoardState_t *const ROOT_STATE = params->root_state;
+  const u32 TEAM_PIECE_IDXS_OFS = SEARCH_TEAM_OFS(ROOT_STATE),
+            ALLIED_KING = TEAM_PIECE_IDXS_OFS|KING,
+            OPP_IDX_OFS = PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT
+                          ^TEAM_PIECE_IDXS_OFS;
+  switch (frame->resume) {
+  case CHESS_AI_AB_ENTER:
+    frame->after_null = params->after_null;
+    g_pv_length[params->ply] = 0;
+    params->after_null = FALSE;
+
+    // 0. Bail out once the time budget is spent. Whatever is returned from
+    // here on gets thrown away by the caller. Depth 1 is never cut short.
+    if (params->stop) {
+      ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(0));
+      return;
+    }
+    if (0==(++params->nodes&CHESS_AI_TIME_CHECK_MASK)
+        && ChessAI_OutOfTime(params)) {
+      params->stop = TRUE;
+      ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(0));
+      return;
+    }
+
+    // 0a. Draws. A line that repeats a position since the last capture or
+    // pawn move can be repeated forever by whichever side it suits, so it's
+    // scored as a draw on the first repetition, cutting off the whole cycle.
+    // Same goes once the fifty-move rule kicks in, unless the move that got
+    // there mated, since mate ends the game first. (A repeated position
+    // can't be mate, having been played on from before.) The root has to
+    // pick a move either way.
+    if (0!=params->ply && ChessAI_IsDraw(params)) {
+      ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(
+          CHESS_AI_FIFTY_MOVE_PLIES<=ROOT_STATE->state.halfmove_clock
+            && ChessAI_IsCheckmate(params)
+              ? CHESS_AI_MATED_SCORE(IS_MAXIMIZING(
+                                       ROOT_STATE->state.side_to_move),
+                                     params->ply)
+              : CHESS_AI_DRAW_SCORE));
+      return;
+    }
+
+    // 0b. Mate distance pruning. Nothing found from here can beat being
+    // mated right here, or mating on the very next ply, so if a shorter mate
+    // is already in hand, the window is empty and there's nothing to search.
+    if (0!=params->ply) {
+      const i16 LO = -CHESS_AI_MATE_SCORE+(i16)params->ply,
+                HI = CHESS_AI_MATE_SCORE-(i16)params->ply;
+      if (LO>=frame->beta || HI<=frame->alpha) {
+        ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(LO>=frame->beta ? LO : HI));
+        return;
+      }
+      if (LO>frame->alpha)
+        frame->alpha = LO;
+      if (HI<frame->beta)
+        frame->beta = HI;
+    }
+
+    // 0c. Endgame bitbases. King and pawn, rook or queen against a bare
+    // king has an exact win/draw answer on file, which beats searching the
+    // ending out. A draw settles the node outright. A win only knows it's a
+    // win, not how to make progress, so it only settles the node the ending
+    // was just reached from by a capture or pawn move. Further in, the search
+    // still has to find the way to mate, with every drawn line cut off. The
+    // root always searches, since it needs a move.
+    if (0!=params->ply) {
+      i16 bitbase_score;
+      if (ChessBitbase_Probe(ROOT_STATE, &bitbase_score)
+          && (0==bitbase_score || 0==ROOT_STATE->state.halfmove_clock)) {
+        ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(bitbase_score));
+        return;
+      }
+    }
+
+    // 1. Check transposition table. A deep enough entry settles this node
+    // if its bound does under the current window. Otherwise its move is
+    // still the best guess going, so it gets searched first. The root always
+    // searches, since its move goes back to the game and a table move has no
+    // flags (nor any guarantee it isn't from another position with the same
+    // key check).
+    frame->alpha_orig = frame->alpha;
+    frame->beta_orig = frame->beta;
+    frame->tt_move = (ChessMove_t) {
       .start = INVALID_IDX_COMPACT,
       .dst = INVALID_IDX_COMPACT,
-      .mv_flags = 0,
-      .promo = 0,
     };
-  }
+    frame->tt_entry = (TTable_Query_t) {
+      .key = ROOT_STATE->zobrist,
+    };
+    if (TTable_Probe(params->ttable, &frame->tt_entry)) {
+      const TTable_Query_t *const TT = &frame->tt_entry;
+      const i16 TT_SCORE = ChessAI_ScoreFromTT(TT->best_move.score,
+                                               params->ply);
+      frame->tt_entry.best_move.score = TT_SCORE;
+      if (0!=params->ply
+          && TT->depth >= params->depth
+          && (TTABLE_BOUND_EXACT==TT->bound
+              || ((TTABLE_BOUND_LOWER&TT->bound) && TT_SCORE>=frame->beta)
+              || ((TTABLE_BOUND_UPPER&TT->bound) && TT_SCORE<=frame->alpha))) {
+        ChessAI_SearchReturn(TT->best_move);
+        return;
+      }
+      frame->tt_move = (ChessMove_t) {
+        .start = TT->best_move.start,
+        .dst = TT->best_move.dst,
+        .promotion = TT->best_move.promo,
+      };
+    }
+    frame->tt_entry.best_move = CHESS_AI_SCORE_ONLY(0);
 
-  // 3. Generate moves
-  BoardState_t move_applied_state;
-  ChessMoveIteration_t move;
-  PieceState_Graph_Vertex_t v;
-  ChessMoveIterator_t movegen = {0};
-  BoardState_t *const PREMOVE_ROOT_STATE = params->root_state;
-  const u32 TEAM_PIECE_IDXS_OFS
-                = PREMOVE_ROOT_STATE->state.side_to_move&WHITE_TO_MOVE_FLAGBIT
-                              ?PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT
-                              :0,
-            ALLIED_KING = 
-              TEAM_PIECE_IDXS_OFS|KING,
-            OPP_IDX_OFS = 
-              PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT^TEAM_PIECE_IDXS_OFS;
-  Move_Validation_Flag_e last_move = params->last_move;
-  i16 best_move = IS_MAXIMIZING(PREMOVE_ROOT_STATE->state.side_to_move)
-                        ? INT16_MIN
-                        : INT16_MAX;
-  ChessBoard_Idx_Compact_t src;
-  BOOL prune=FALSE, skip_castles = FALSE;
-  params->root_state = &move_applied_state;  // switch out params board state 
-                                             // ptr to the addr of the mutable 
-                                             // local board state.
-  for (u32 i,i_base = 0; CHESS_TEAM_PIECE_COUNT>i_base; ++i_base) {
-    i = i_base|TEAM_PIECE_IDXS_OFS;
-    if (!CHESS_ROSTER_PIECE_ALIVE(PREMOVE_ROOT_STATE->graph.roster, i))
-      continue;
+    // 2. Base case. Settle any captures still in flight before trusting the
+    // static eval.
+    if (params->depth == 0) {
+      ChessAI_SearchCall(frame, CHESS_AI_AB_AFTER_QSEARCH, CHESS_AI_Q_ENTER,
+                         frame->alpha, frame->beta, 0);
+      return;
+    }
 
-    v = PREMOVE_ROOT_STATE->graph.vertices[i];
+    // 3. Set up to search the moves.
+    frame->moves = &g_ply_move_lists[params->ply];
+    frame->last_move = params->last_move;
+    frame->maximizing = IS_MAXIMIZING(ROOT_STATE->state.side_to_move);
+    frame->on_pv = params->follow_pv && params->pv_length>params->ply;
+    frame->in_check = BoardState_KingInCheck(ROOT_STATE,
+                                             ALLIED_KING,
+                                             OPP_IDX_OFS);
+    frame->best = frame->maximizing ? INT16_MIN : INT16_MAX;
+    frame->legal_moves = 0;
+    assert(MAX_SEARCH_PLY>params->ply);
 
-    src = v.location;
-#ifdef _AI_VISUALIZE_MOVE_CANDIDATES_
-    if (MAX_DEPTH==params->depth) {
-      UPDATE_MOVE_TRAVERSAL_SEL_SPRITE(0, 
-                                       BOARD_IDX_CONVERT(src, NORMAL_IDX_TYPE));
+    // 3a. Null move. If the side to move could pass and the opponent, given
+    // a shallower search, still couldn't get back inside the window, the
+    // real moves are only going to do better. Passing out of check is
+    // illegal, and with only pawns left, zugzwang makes passing an actual
+    // advantage. It is only tried in null window nodes, off the principal
+    // variation.
+    if ((CHESS_AI_PRUNE_NULL_MOVE&params->prune)
+        && CHESS_AI_NULL_MOVE_MIN_DEPTH<=params->depth
+        && 0!=params->ply
+        && !frame->on_pv
+        && !frame->after_null
+        && !frame->in_check
+        && 1==(int)frame->beta-frame->alpha
+        && ((ROOT_STATE->bb.pieces[KNIGHT_IDX]
+             |ROOT_STATE->bb.pieces[BISHOP_IDX]
+             |ROOT_STATE->bb.pieces[ROOK_IDX]
+             |ROOT_STATE->bb.pieces[QUEEN_IDX])
+            &ROOT_STATE->bb.teams[frame->maximizing ? BB_WHITE_TEAM_IDX
+                                                    : BB_BLACK_TEAM_IDX])) {
+      const i16 STATIC_EVAL = ChessAI_Eval(ROOT_STATE, frame->last_move);
+      if (frame->maximizing ? STATIC_EVAL>=frame->beta
+                            : STATIC_EVAL<=frame->alpha) {
+        BoardState_MakeNullMove(ROOT_STATE, &frame->undo);
+        params->depth -= 1+CHESS_AI_NULL_MOVE_REDUCTION;
+        ++params->ply;
+        g_key_history[params->key_count++] = ROOT_STATE->zobrist;
+        params->last_move = 0;
+        params->after_null = TRUE;
+        params->follow_pv = FALSE;
+        if (frame->maximizing)
+          ChessAI_SearchCall(frame, CHESS_AI_AB_AFTER_NULL_MOVE,
+                             CHESS_AI_AB_ENTER, frame->beta-1, frame->beta, 0);
+        else
+          ChessAI_SearchCall(frame, CHESS_AI_AB_AFTER_NULL_MOVE,
+                             CHESS_AI_AB_ENTER, frame->alpha, frame->alpha+1,
+                             0);
+        return;
+      }
     }
-#endif
+    frame->resume = CHESS_AI_AB_GENERATE;
+    return;
 
-    ChessMoveIterator_Alloc(&movegen, BOARD_IDX_CONVERT(src, NORMAL_IDX_TYPE),
-                            PREMOVE_ROOT_STATE,
-                            MV_ITER_MOVESET_ALL_MINUS_ALLIED_COLLISIONS
-                               |MV_ITER_MOVESET_ORDERED_FLAGBIT);
-    while (ChessMoveIterator_HasNext(&movegen)) {
-      // copy immutable initial root state to the local mutable root state, 
-      // so that it's ready to have the move applied to it.
-#ifndef _AI_VISUALIZE_MOVE_CANDIDATES_
-      UPDATE_MOVE_TRAVERSAL_SEL_SPRITE(0, 
-                                       BOARD_IDX_CONVERT(src, NORMAL_IDX_TYPE));
-#endif  /* NDEF _AI_VISUALIZE_MOVE_CANDIDATES_ */
-      Fast_Memcpy32(&move_applied_state,
-                    PREMOVE_ROOT_STATE,
-                    sizeof(BoardState_t)/sizeof(WORD));
-      ChessMoveIterator_Next(&movegen, &move);
+  case CHESS_AI_AB_AFTER_QSEARCH:
+    ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(g_search.ret.score));
+    return;
+
+  case CHESS_AI_AB_AFTER_NULL_MOVE: {
+    const i16 NULL_SCORE = g_search.ret.score;
+    params->after_null = FALSE;
+    params->last_move = frame->last_move;
+    --params->key_count;
+    --params->ply;
+    params->depth += 1+CHESS_AI_NULL_MOVE_REDUCTION;
+    BoardState_UnmakeNullMove(params->root_state, &frame->undo);
+    if (params->stop) {
+      ChessAI_SearchReturn(frame->tt_entry.best_move);
+      return;
+    }
+    if (frame->maximizing ? NULL_SCORE>=frame->beta
+                          : NULL_SCORE<=frame->alpha) {
+      ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(frame->maximizing
+                                                 ? frame->beta
+                                                 : frame->alpha));
+      return;
+    }
+    frame->resume = CHESS_AI_AB_GENERATE;
+    return;
+  }
+
+  case CHESS_AI_AB_GENERATE:
+    // Moves are made and unmade on ROOT_STATE in place, so it is back to its
+    // premove state every time the next move is picked off the list.
+    // Along the last iteration's principal variation, its move beats
+    // whatever the table kept.
+    ChessMoveGen_Generate(ROOT_STATE, frame->moves);
+    ChessAI_ScoreMoves(ROOT_STATE, frame->moves,
+                       frame->on_pv ? &params->pv[params->ply]
+                                    : &frame->tt_move,
+                       params->ply);
+    frame->mv_idx = 0;
+    frame->resume = CHESS_AI_AB_NEXT_MOVE;
+    return;
+
+  case CHESS_AI_AB_NEXT_MOVE:
+    for (; frame->moves->count>frame->mv_idx; ++frame->mv_idx) {
+      const ChessMove_t *const MV = ChessAI_PickNextMove(frame->moves,
+                                                         frame->mv_idx);
+      const ChessMoveIteration_t move = {
+        .dst = BOARD_IDX_CONVERT(MV->dst, NORMAL_IDX_TYPE),
+        .promotion_flag = MV->promotion,
+        .special_flags = MV->flags,
+      };
 #ifdef _AI_VISUALIZE_MOVE_CANDIDATES_
-      if (MAX_DEPTH==params->depth) {
+      if (0==params->ply) {
+        UPDATE_MOVE_TRAVERSAL_SEL_SPRITE(0, 
+                                 BOARD_IDX_CONVERT(MV->start, NORMAL_IDX_TYPE));
         UPDATE_MOVE_TRAVERSAL_SEL_SPRITE(1, move.dst);
       }
 #else
+      UPDATE_MOVE_TRAVERSAL_SEL_SPRITE(0, 
+                                 BOARD_IDX_CONVERT(MV->start, NORMAL_IDX_TYPE));
       UPDATE_MOVE_TRAVERSAL_SEL_SPRITE(1, move.dst);
       Debug_Ksync(A, KSYNC_CONTINUOUS);
 #endif  /* _AI_VISUALIZE_MOVE_CANDIDATES_ */
-      // 4. Validate move special cases
-      if (KING==i_base) {
-        if (MOVE_CASTLE_MOVE_FLAGS_MASK&move.special_flags) {
-          if (skip_castles)
-            continue;
-          BoardState_CastleLegalityStatus_t
-            stat = BoardState_Validate_CastleLegaility(&move_applied_state,
-                                                       move.dst);
-          if (0>stat) {
-            if (stat!=BOARD_STATE_CASTLE_BLOCKED_BY_CHECK)
-              continue;
-            skip_castles = TRUE;
-            continue;
-          }
-          assert(BOARD_STATE_CASTLE_OK==stat);
-        }
-      }
-      // 4. Apply move
-
-      BoardState_ApplyMove(&move_applied_state, &move, src);
-      if (BoardState_KingInCheck(&move_applied_state,
+      // 4. Apply move. Castles come out of the generator already validated,
+      // so only the mover's own king needs checking.
+      BoardState_MakeMove(ROOT_STATE, MV, &frame->undo);
+      if (BoardState_KingInCheck(ROOT_STATE,
                                  ALLIED_KING,
-                                 OPP_IDX_OFS))
+                                 OPP_IDX_OFS)) {
+        BoardState_UnmakeMove(ROOT_STATE, &frame->undo);
         continue;
+      }
+
+      ChessAI_SearchVisualize_Move(ROOT_STATE, &move,
+                          ROOT_STATE->graph.vertex_hashmap[BOARD_IDX(MV->dst)]);
 
-      ChessAI_SearchVisualize_Move(&move_applied_state, &move, i);
+      // 4a. Late move reductions. A quiet move ordered this far down rarely
+      // turns out best, so it gets a shallower look first. Not while in
+      // check, and not for a move that gives check.
+      frame->reduction = 0;
+      if ((CHESS_AI_PRUNE_LMR&params->prune)
+          && CHESS_AI_LMR_MIN_DEPTH<=params->depth
+          && CHESS_AI_LMR_MIN_MOVES<=frame->legal_moves
+          && !frame->in_check
+          && !(MOVE_CAPTURE&MV->flags)
+          && !MV->promotion
+          && MOVE_ORDER_KILLER-1>frame->moves->scores[frame->mv_idx]
+          && !BoardState_KingInCheck(ROOT_STATE,
+                                     OPP_IDX_OFS|KING,
+                                     TEAM_PIECE_IDXS_OFS))
+        frame->reduction = CHESS_AI_LMR_DEEP_MOVES<=frame->legal_moves
+                           && CHESS_AI_LMR_MIN_DEPTH<params->depth ? 2 : 1;
 
-      // recursed, so now all we need to do 
       --params->depth;
+      ++params->ply;
+      g_key_history[params->key_count++] = ROOT_STATE->zobrist;
       params->last_move = move.special_flags;
-      {
-        ChessAI_MoveSearch_Result_t mv = ChessAI_ABSearch(params,
-                                              alpha,
-                                              beta);
-        ChessAI_ResetPieceVisualizer(PREMOVE_ROOT_STATE);
-        // 6. Reset params->depth to this call's param values.
-        // Don't need to reset last_move
-        ++params->depth;
-       
-        // 7. Alpha-beta logic
-        if (IS_MAXIMIZING(PREMOVE_ROOT_STATE->state.side_to_move)) {
-          if (mv.score > best_move) {
-            best_move = mv.score;
-            tt_entry.best_move = (ChessAI_MoveSearch_Result_t){
-              .dst = BOARD_IDX_CONVERT(move.dst, COMPACT_IDX_TYPE),
-              .promo = move.promotion_flag,
-              .mv_flags = move.special_flags,
-              .score = mv.score,
-              .start = src
-            };  /* update ttable entry that will be 
-                                       * tabulated upon exit. */
-            if (mv.score > alpha)
-              alpha = mv.score;
-          }
-          if (mv.score >= beta) {
-            prune = TRUE;
-            break;
-          }
-        } else {
-          if (mv.score < best_move) {
-            best_move=mv.score;
-            tt_entry.best_move = (ChessAI_MoveSearch_Result_t){
-              .dst = BOARD_IDX_CONVERT(move.dst, COMPACT_IDX_TYPE),
-              .promo = move.promotion_flag,
-              .mv_flags = move.special_flags,
-              .score = mv.score,
-              .start = src
-            };  /* update ttable entry that will be 
-                                       * tabulated upon exit. */
-            if (mv.score < beta)
-              beta=mv.score;
-          }
-          if (mv.score <= alpha) {
-            prune = TRUE;
-            break;
-          }
-        }
+      frame->mv = MV;
+
+      // 5. Principal variation search. Only the first move gets the full
+      // window. The rest only have to be proven no better than it, which a
+      // null window at the bound this side is trying to raise does cheaply.
+      // A reduced move that fails that proof is tried again at full depth,
+      // and one that still does gets searched again with the full window.
+      frame->child_on_pv = frame->on_pv
+                    && ChessAI_SameMove(MV, &params->pv[params->ply-1]);
+      params->follow_pv = frame->child_on_pv;
+      if (0==frame->legal_moves++) {
+        ChessAI_SearchCall(frame, CHESS_AI_AB_AFTER_SEARCH, CHESS_AI_AB_ENTER,
+                           frame->alpha, frame->beta, 0);
+      } else {
+        params->depth -= frame->reduction;
+        ChessAI_SearchCallNullWindow(frame, CHESS_AI_AB_AFTER_NULL_WINDOW);
       }
+      return;
     }
-    ChessMoveIterator_Dealloc(&movegen);
-    if (prune) {
-      break;
+    frame->resume = CHESS_AI_AB_FINISH;
+    return;
+
+  case CHESS_AI_AB_AFTER_NULL_WINDOW:
+    frame->child = g_search.ret;
+    params->depth += frame->reduction;
+    if (frame->reduction && !params->stop
+        && (frame->maximizing ? frame->child.score>frame->alpha
+                              : frame->child.score<frame->beta)) {
+      params->follow_pv = frame->child_on_pv;
+      ChessAI_SearchCallNullWindow(frame, CHESS_AI_AB_AFTER_UNREDUCED);
+      return;
     }
-  }
-  // Restore pointer to original immutable copy of board_state
-  params->root_state = PREMOVE_ROOT_STATE;
-  params->last_move = last_move;
-
-  // 8. Store in TT
-  tt_entry.key = params->root_state->zobrist;
-  tt_entry.gen = params->gen;
-  tt_entry.depth = params->depth;
-
-  TTable_Insert(params->ttable, &tt_entry);
-
-  return tt_entry.best_move;
-}
-
-IWRAM_CODE i16 Piece_Eval(ChessPiece_e piece) {
-  switch (piece) {
-  case PAWN_IDX:
-    return 100;
-  case BISHOP_IDX:
-  case KNIGHT_IDX:
-    return 300;
-  case ROOK_IDX:
-    return 500;
-  case QUEEN_IDX:
-    return 900;
-  case KING_IDX:
+    ChessAI_ABResearch(params, frame);
+    return;
+
+  case CHESS_AI_AB_AFTER_UNREDUCED:
+    frame->child = g_search.ret;
+    ChessAI_ABResearch(params, frame);
+    return;
+
+  case CHESS_AI_AB_AFTER_SEARCH:
+    frame->child = g_search.ret;
+    ChessAI_ABAfterChild(params, frame);
+    return;
+
+  case CHESS_AI_AB_FINISH:
   default:
-    return 0;
-    break;
+    params->last_move = frame->last_move;
+    // A partial search's best move and score can't go in the table.
+    if (params->stop) {
+      ChessAI_SearchReturn(frame->tt_entry.best_move);
+      return;
+    }
+
+    // 8. No legal moves: checkmate if in check, otherwise stalemate. Either
+    // way the score is exact.
+    if (0==frame->legal_moves) {
+      frame->best = frame->in_check
+                      ? CHESS_AI_MATED_SCORE(frame->maximizing, params->ply)
+                      : 0;
+      frame->tt_entry.best_move.score = frame->best;
+    }
+
+    // 9. Store in TT
+    frame->tt_entry.depth = params->depth;
+    frame->tt_entry.bound = 0==frame->legal_moves ? TTABLE_BOUND_EXACT
+                          : frame->best<=frame->alpha_orig ? TTABLE_BOUND_UPPER
+                          : frame->best>=frame->beta_orig ? TTABLE_BOUND_LOWER
+                          : TTABLE_BOUND_EXACT;
+    frame->tt_entry.best_move.score = ChessAI_ScoreToTT(frame->best,
+                                                        params->ply);
+
+    TTable_Insert(params->ttable, &frame->tt_entry);
+
+    frame->tt_entry.best_move.score = frame->best;
+    ChessAI_SearchReturn(frame->tt_entry.best_move);
+    return;
   }
 }
 
-IWRAM_CODE i16 Piece_Development_Eval(ChessPiece_Roster_Id_e rid) {
-  switch (rid) {
-  case ROOK0:
-  case ROOK1:
-    return 0;
-  case KNIGHT0:
-  case KNIGHT1:
-    return 100;
-  case BISHOP0:
-  case BISHOP1:
-    return 200;
-  case QUEEN:
-    return 50;
-  case KING:
-    return 0;
-  case PAWN0:
-  case PAWN1:
-  case PAWN2:
-    return 20;
-  case PAWN3:
-  case PAWN4:
-    return 200;
-  case PAWN5:
-  case PAWN6:
-  case PAWN7:
-    return 20;
-    break;
-  default:
-    assert((rid&PIECE_ROSTER_ABS_ID_MASK) == rid);
+/* A null window search that beat the bound it was testing has to be run
+ * again with the full window to get its real score. */
+IWRAM_CODE void ChessAI_ABResearch(ChessAI_Params_t *params,
+                                   ChessAI_SearchFrame_t *frame) {
+  if (!params->stop
+      && frame->child.score>frame->alpha
+      && frame->child.score<frame->beta) {
+    params->follow_pv = frame->child_on_pv;
+    ChessAI_SearchCall(frame, CHESS_AI_AB_AFTER_SEARCH, CHESS_AI_AB_ENTER,
+                       frame->alpha, frame->beta, 0);
+    return;
   }
-  return 0;
+  ChessAI_ABAfterChild(params, frame);
 }
 
-IWRAM_CODE i16 Positional_Eval(ChessPiece_e piece,
-                               ChessBoard_Idx_Compact_t loc) {
-  ChessBoard_File_e x=loc.coord.x;
-  ChessBoard_Row_e y=loc.coord.y;
-  if (PAWN_IDX==piece)
-    return 0;
-  if (x<FILE_C || x>FILE_F)
-    return 0;
-  if (y<ROW_6 || y>ROW_3)
-    return 0;
-  return 15;
+/* frame->mv has been searched, with frame->child as the result. Takes it
+ * back and moves on to the next move, unless it cut the node off. */
+IWRAM_CODE void ChessAI_ABAfterChild(ChessAI_Params_t *params,
+                                     ChessAI_SearchFrame_t *frame) {
+  const ChessMove_t *const MV = frame->mv;
+  const i16 SCORE = frame->child.score;
+  params->follow_pv = frame->on_pv;
+  BoardState_UnmakeMove(params->root_state, &frame->undo);
+  ChessAI_ResetPieceVisualizer(params->root_state);
+  // 6. Reset params->depth to this node's values.
+  // Don't need to reset last_move
+  ++params->depth;
+  --params->ply;
+  --params->key_count;
+  frame->resume = CHESS_AI_AB_FINISH;
+  if (params->stop)
+    return;
+
+  // 7. Alpha-beta logic
+  if (frame->maximizing) {
+    if (SCORE > frame->best) {
+      frame->best = SCORE;
+      ChessAI_UpdatePV(params->ply, MV);
+      frame->tt_entry.best_move = (ChessAI_MoveSearch_Result_t){
+        .dst = MV->dst,
+        .promo = MV->promotion,
+        .mv_flags = MV->flags,
+        .score = SCORE,
+        .start = MV->start
+      };  /* update ttable entry that will be tabulated upon exit. */
+      if (SCORE > frame->alpha)
+        frame->alpha = SCORE;
+    }
+    if (SCORE >= frame->beta) {
+      if (!(MOVE_CAPTURE&MV->flags) && !MV->promotion)
+        ChessAI_QuietCutoff(MV, BB_WHITE_TEAM_IDX, params->ply,
+                            params->depth);
+      return;
+    }
+  } else {
+    if (SCORE < frame->best) {
+      frame->best = SCORE;
+      ChessAI_UpdatePV(params->ply, MV);
+      frame->tt_entry.best_move = (ChessAI_MoveSearch_Result_t){
+        .dst = MV->dst,
+        .promo = MV->promotion,
+        .mv_flags = MV->flags,
+        .score = SCORE,
+        .start = MV->start
+      };  /* update ttable entry that will be tabulated upon exit. */
+      if (SCORE < frame->beta)
+        frame->beta = SCORE;
+    }
+    if (SCORE <= frame->alpha) {
+      if (!(MOVE_CAPTURE&MV->flags) && !MV->promotion)
+        ChessAI_QuietCutoff(MV, BB_BLACK_TEAM_IDX, params->ply,
+                            params->depth);
+      return;
+    }
+  }
+  ++frame->mv_idx;
+  frame->resume = CHESS_AI_AB_NEXT_MOVE;
+}
+
+IWRAM_CODE u32 ChessAI_GenerateCaptures(const BoardState_t *state,
+                                        ChessMoveList_t *list) {
+  const PieceState_Graph_Vertex_t *const vertices = state->graph.vertices;
+  const ChessPiece_e (*board)[CHESS_BOARD_FILE_COUNT] = state->board;
+  const BOOL WHITE = 0!=(state->state.side_to_move&WHITE_TO_MOVE_FLAGBIT);
+  const u32 TEAM_OFS = WHITE ? PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT : 0,
+            // Roster ids double as edge bit indices.
+            OPP_EDGES = WHITE ? 0x0000FFFFUL : 0xFFFF0000UL;
+  const ChessBoard_Row_e PROMO_ROW = WHITE ? ROW_8 : ROW_1;
+  const int FORWARD = WHITE ? -1 : 1;
+  ChessMove_t *cursor = list->moves;
+  u32 alive = WHITE ? state->graph.roster.by_color.white
+                    : state->graph.roster.by_color.black,
+      opp_alive = state->graph.roster.all&OPP_EDGES,
+      defended = 0;
+  Bitboard_t pushes;
+
+  // A victim is defended if any of its own team's vertices has an edge to it.
+  while (opp_alive) {
+    defended |= vertices[__builtin_ctz(opp_alive)].edges.all;
+    opp_alive &= opp_alive-1;
+  }
+  defended &= OPP_EDGES;
+
+  // Every capture is already sitting in the attack graph, as an edge from
+  // the attacker's vertex to its victim's.
+  while (alive) {
+    const u32 RID = TEAM_OFS|(u32)__builtin_ctz(alive);
+    const ChessBoard_Idx_Compact_t START = vertices[RID].location;
+    const ChessPiece_e ATTACKER = PIECE_IDX_MASK&board[BOARD_IDX(START)];
+    const BOOL PAWN = PAWN_IDX==ATTACKER;
+    u32 victims = vertices[RID].edges.all&OPP_EDGES;
+    alive &= alive-1;
+    while (victims) {
+      const u32 VICTIM_RID = (u32)__builtin_ctz(victims);
+      ChessMove_t mv = {
+        .start = START,
+        .dst = vertices[VICTIM_RID].location,
+        .flags = MOVE_CAPTURE,
+        .promotion = 0,
+      };
+      victims &= victims-1;
+      // Skip trading a piece for a cheaper, defended one. It almost never
+      // wins anything, and it's most of what blows the tree up.
+      if ((defended&(1UL<<VICTIM_RID))
+          && MOVE_ORDER_PIECE_VALUE(ATTACKER)
+               >MOVE_ORDER_PIECE_VALUE(board[BOARD_IDX(mv.dst)]))
+        continue;
+      if (PAWN && mv.dst.coord.y==START.coord.y) {
+        // Only an en passent victim sits beside the capturing pawn.
+        mv.dst.coord.y += FORWARD;
+        mv.flags |= MOVE_EN_PASSENT;
+      } else if (PAWN && PROMO_ROW==mv.dst.coord.y) {
+        mv.promotion = QUEEN_IDX;
+      }
+      *cursor++ = mv;
+    }
+  }
+
+  // Quiet queen promotions swing the material count just as hard.
+  pushes = state->bb.pieces[PAWN_IDX]
+          &state->bb.teams[WHITE ? BB_WHITE_TEAM_IDX : BB_BLACK_TEAM_IDX];
+  pushes = WHITE ? (pushes>>8)&BB_ROW(ROW_8) : (pushes<<8)&BB_ROW(ROW_1);
+  pushes &= ~Bitboard_Occupancy(&state->bb);
+  for (u32 to_sq; pushes; ) {
+    to_sq = Bitboard_PopLSB(&pushes);
+    *cursor++ = (ChessMove_t) {
+      .start = BB_SQ_TO_COMPACT(WHITE ? to_sq+8 : to_sq-8),
+      .dst = BB_SQ_TO_COMPACT(to_sq),
+      .flags = 0,
+      .promotion = QUEEN_IDX,
+    };
+  }
+
+  list->count = (u32)(cursor-list->moves);
+  assert(CHESS_MOVE_LIST_CAPACITY>=list->count);
+  return list->count;
+}
+
+IWRAM_CODE void ChessAI_QNode(ChessAI_Params_t *params,
+                              ChessAI_SearchFrame_t *frame) {
+  BoardState_t *const ROOT_STATE = params->root_state;
+  const u32 TEAM_PIECE_IDXS_OFS = SEARCH_TEAM_OFS(ROOT_STATE),
+            ALLIED_KING = TEAM_PIECE_IDXS_OFS|KING,
+            OPP_IDX_OFS = PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT
+                          ^TEAM_PIECE_IDXS_OFS;
+  switch (frame->resume) {
+  case CHESS_AI_Q_ENTER:
+    frame->moves = &g_ply_move_lists[params->ply];
+    frame->maximizing = IS_MAXIMIZING(ROOT_STATE->state.side_to_move);
+    frame->last_move = params->last_move;
+    frame->stand_pat = 0;
+    if (params->stop) {
+      ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(0));
+      return;
+    }
+    if (0==(++params->qnodes&CHESS_AI_TIME_CHECK_MASK)
+        && ChessAI_OutOfTime(params)) {
+      params->stop = TRUE;
+      ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(0));
+      return;
+    }
+    if (QSEARCH_MAX_PLY-1<=frame->qply || MAX_SEARCH_PLY-1<=params->ply) {
+      ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(
+                                  ChessAI_Eval(ROOT_STATE, frame->last_move)));
+      return;
+    }
+
+    // Stand pat: the side to move doesn't have to capture, so the static
+    // eval already bounds this node. That doesn't hold in check, where every
+    // evasion has to be tried instead, but only for the first few plies past
+    // the horizon. Any deeper, and the evasions cost more than they find.
+    frame->in_check = QSEARCH_EVASION_PLY>frame->qply
+            && BoardState_KingInCheck(ROOT_STATE, ALLIED_KING, OPP_IDX_OFS);
+    if (frame->in_check) {
+      // Any legal evasion beats this, so it only stands if there are none.
+      frame->best = CHESS_AI_MATED_SCORE(frame->maximizing, params->ply);
+      ChessMoveGen_Generate(ROOT_STATE, frame->moves);
+    } else {
+      frame->stand_pat = frame->best = ChessAI_Eval(ROOT_STATE,
+                                                    frame->last_move);
+      if (frame->maximizing) {
+        if (frame->best>=frame->beta) {
+          ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(frame->best));
+          return;
+        }
+        if (frame->best>frame->alpha)
+          frame->alpha = frame->best;
+      } else {
+        if (frame->best<=frame->alpha) {
+          ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(frame->best));
+          return;
+        }
+        if (frame->best<frame->beta)
+          frame->beta = frame->best;
+      }
+      ChessAI_GenerateCaptures(ROOT_STATE, frame->moves);
+    }
+    ChessAI_ScoreMoves(ROOT_STATE, frame->moves,
+                       &(const ChessMove_t) { .start = INVALID_IDX_COMPACT },
+                       params->ply);
+    frame->mv_idx = 0;
+    frame->resume = CHESS_AI_Q_NEXT_MOVE;
+    return;
+
+  case CHESS_AI_Q_NEXT_MOVE:
+    for (; frame->moves->count>frame->mv_idx; ++frame->mv_idx) {
+      const ChessMove_t *const MV = ChessAI_PickNextMove(frame->moves,
+                                                         frame->mv_idx);
+      if (!frame->in_check) {
+        // Delta pruning: even winning the victim outright, plus some slack
+        // for positional swings, can't bring the stand pat score up to the
+        // window.
+        const i16 gain = QSEARCH_DELTA_MARGIN
+              + ((MOVE_EN_PASSENT&MV->flags)
+                  ? Piece_Eval(PAWN_IDX)
+                  : Piece_Eval(PIECE_IDX_MASK
+                               &ROOT_STATE->board[BOARD_IDX(MV->dst)]))
+              + (MV->promotion ? Piece_Eval(QUEEN_IDX)-Piece_Eval(PAWN_IDX)
+                               : 0);
+        if (frame->maximizing ? frame->stand_pat+gain<=frame->alpha
+                              : frame->stand_pat-gain>=frame->beta)
+          continue;
+      }
+      BoardState_MakeMove(ROOT_STATE, MV, &frame->undo);
+      if (BoardState_KingInCheck(ROOT_STATE, ALLIED_KING, OPP_IDX_OFS)) {
+        BoardState_UnmakeMove(ROOT_STATE, &frame->undo);
+        continue;
+      }
+      ++params->ply;
+      params->last_move = MV->flags;
+      ChessAI_SearchCall(frame, CHESS_AI_Q_AFTER_CHILD, CHESS_AI_Q_ENTER,
+                         frame->alpha, frame->beta, frame->qply+1);
+      return;
+    }
+    frame->resume = CHESS_AI_Q_FINISH;
+    return;
+
+  case CHESS_AI_Q_AFTER_CHILD: {
+    const i16 SCORE = g_search.ret.score;
+    --params->ply;
+    BoardState_UnmakeMove(ROOT_STATE, &frame->undo);
+    frame->resume = CHESS_AI_Q_FINISH;
+    if (params->stop)
+      return;
+    if (frame->maximizing) {
+      if (SCORE>frame->best)
+        frame->best = SCORE;
+      if (frame->best>frame->alpha)
+        frame->alpha = frame->best;
+    } else {
+      if (SCORE<frame->best)
+        frame->best = SCORE;
+      if (frame->best<frame->beta)
+        frame->beta = frame->best;
+    }
+    if (frame->alpha>=frame->beta)
+      return;
+    ++frame->mv_idx;
+    frame->resume = CHESS_AI_Q_NEXT_MOVE;
+    return;
+  }
+
+  case CHESS_AI_Q_FINISH:
+  default:
+    params->last_move = frame->last_move;
+    ChessAI_SearchReturn(CHESS_AI_SCORE_ONLY(frame->best));
+    return;
+  }
 }
 
 IWRAM_CODE i16 BoardState_Eval(const BoardState_t *state, 
@@ -559,10 +1577,40 @@ IWRAM_CODE i16 BoardState_Eval(const BoardState_t *state,
   const PieceState_Graph_Vertex_t *vertices = state->graph.vertices;
 
   const ChessPiece_Roster_t ROSTER_STATE = state->graph.roster;
-  const ChessPiece_e (*board)[CHESS_BOARD_ROW_COUNT] = state->board;
   const u16 NONFORFEITED_CASTLE_FLAGS = NON_FORFEITED_CASTLE_RIGHTS(state);
-  i16 score=0, base, tactical, white_check_count = 0, black_check_count = 0;
-  ChessPiece_e piece;
+  const BoardState_Bitboards_t *const BBS = &state->bb;
+  const PawnHash_Entry_t *const PAWNS = PawnHash_Probe(&g_pawn_hash, state);
+  const Bitboard_t WHITE_PAWNS = BBS->pieces[PAWN_IDX]
+                                  &BBS->teams[BB_WHITE_TEAM_IDX],
+                   BLACK_PAWNS = BBS->pieces[PAWN_IDX]
+                                  &BBS->teams[BB_BLACK_TEAM_IDX];
+  // Material and placement are kept current by BoardState_ApplyMove, and pawn
+  // structure comes out of the pawn hash, so only the terms that depend on
+  // how the pieces see each other get summed here.
+  BoardState_EvalSums_t sums = state->eval;
+  // Knights posted up the board on a square one of their own pawns guards
+  // and none of the enemy's pawns can ever attack.
+  const i32 OUTPOSTS
+    = (i32)Bitboard_PopCount(BBS->pieces[KNIGHT_IDX]
+                             &BBS->teams[BB_WHITE_TEAM_IDX]
+                             &EVAL_WHITE_OUTPOST_ROWS
+                             &Bitboard_WhitePawnAttacks(WHITE_PAWNS)
+                             &~PAWNS->attack_spans[BB_BLACK_TEAM_IDX])
+    - (i32)Bitboard_PopCount(BBS->pieces[KNIGHT_IDX]
+                             &BBS->teams[BB_BLACK_TEAM_IDX]
+                             &EVAL_BLACK_OUTPOST_ROWS
+                             &Bitboard_BlackPawnAttacks(BLACK_PAWNS)
+                             &~PAWNS->attack_spans[BB_WHITE_TEAM_IDX]);
+  const i32 CASTLE_RIGHTS
+    = (i32)(0!=(NONFORFEITED_CASTLE_FLAGS&WK))
+    + (i32)(0!=(NONFORFEITED_CASTLE_FLAGS&WQ))
+    - (i32)(0!=(NONFORFEITED_CASTLE_FLAGS&BK))
+    - (i32)(0!=(NONFORFEITED_CASTLE_FLAGS&BQ));
+  sums.mg += PAWNS->mg + OUTPOSTS*EVAL_KNIGHT_OUTPOST_MG
+           + CASTLE_RIGHTS*EVAL_CASTLE_RIGHT_MG;
+  sums.eg += PAWNS->eg + OUTPOSTS*EVAL_KNIGHT_OUTPOST_EG;
+  i16 score=EvalSums_Taper(&sums), tactical,
+      white_check_count = 0, black_check_count = 0;
   for (u32 j, i=0; CHESS_TOTAL_PIECE_COUNT>i; ++i) {
     if (!CHESS_ROSTER_PIECE_ALIVE(ROSTER_STATE, i))
       continue;
@@ -580,21 +1628,15 @@ IWRAM_CODE i16 BoardState_Eval(const BoardState_t *state,
     } else if (v.edges.all&(1<<WHITE_ROSTER_ID(KING))) {
       int counter_count = 0;
       for (j=0; CHESS_TEAM_PIECE_COUNT>j; ++j) {
-        if (vertices[BLACK_ROSTER_ID(j)].edges.all&(1<<i)) {
+        if (vertices[WHITE_ROSTER_ID(j)].edges.all&(1<<i)) {
           ++counter_count;
         }
       }
       white_check_count += 50 - (counter_count*50)/CHESS_TEAM_PIECE_COUNT;
     }
 
-    piece = board[BOARD_IDX(v.location)];
-    base = Piece_Eval(PIECE_IDX_MASK&piece);
-    tactical=0;
-    tactical+=10*v.attacking_count;
-    tactical+=5*v.defending_count;
-    tactical+=Positional_Eval(PIECE_IDX_MASK&piece, v.location);
-    score += WHITE_FLAGBIT&piece ? (base+tactical)
-                      : -(base+tactical);
+    tactical=10*v.attacking_count + 5*v.defending_count;
+    score += i&PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT ? tactical : -tactical;
   }
 
   assert((0==white_check_count) || (0==black_check_count));
@@ -604,30 +1646,74 @@ IWRAM_CODE i16 BoardState_Eval(const BoardState_t *state,
     score += black_check_count;
   }
 
-  for (u16 flag=1; flag&ALL_CASTLE_RIGHTS_MASK; flag<<=1) {
-    /* Truth table:
-     *  curflag HIGH | white flag | positive score change
-     *       0       |   0        |    1        // black forfeited right  (+)
-     *       0       |   1        |    0        // white forfeited right  (-)
-     *       1       |   0        |    0        // black has or used right (-)
-     *       1       |   1        |    1        // white has or used right (+)
-     * Truth table shows that positive score change can be represented by
-     * <curflag is HIGH in state->castle_rights> XNOR <curflag is white>
-     * AKA
-     * (!((0!=(NONFORFEITED_CASTLE_FLAGS&flag))
-     *          ^(0!=(WHITE_CASTLE_RIGHTS_MASK))))
-     * So if we do:
-     * ((0!=(NONFORFEITED_CASTLE_FLAGS&flag)) ^ (0!=(WHITE_CASTLE_MASK&flag)))
-     * which is <has said castle right> XOR <flag is a white castle right>
-     * we get inverse of positive score change (so negative score change):
-    */
-    if ((0!=(NONFORFEITED_CASTLE_FLAGS&flag))
-              ^(0!=(WHITE_CASTLE_RIGHTS_MASK&flag)))
-      score -= 1000;
-    else
-      score += 1000;
-  }
+  return score;
+
+}
 
+/* BoardState_Eval behind the eval cache. */
+IWRAM_CODE i16 ChessAI_Eval(const BoardState_t *state,
+                            Move_Validation_Flag_e last_move) {
+  i16 score;
+  if (EvalCache_Probe(&g_eval_cache, state->zobrist, &score))
+    return score;
+  score = BoardState_Eval(state, last_move);
+  EvalCache_Store(&g_eval_cache, state->zobrist, score);
   return score;
+}
+
+/* Whether the node on top of the key history is drawn by the fifty-move rule
+ * or by repeating an earlier position. Only positions with the same side to
+ * move, at least two moves apiece back, and no further back than the last
+ * irreversible move, can possibly be the same one. */
+IWRAM_CODE BOOL ChessAI_IsDraw(const ChessAI_Params_t *params) {
+  const u32 HALFMOVES = params->root_state->state.halfmove_clock,
+            TOP = params->key_count-1;
+  const u64 KEY = g_key_history[TOP];
+  if (CHESS_AI_FIFTY_MOVE_PLIES<=HALFMOVES)
+    return TRUE;
+  for (u32 back = 4; HALFMOVES>=back && TOP>=back; back+=2)
+    if (KEY==g_key_history[TOP-back])
+      return TRUE;
+  return FALSE;
+}
 
+/* Whether the side to move at the node being searched has been mated. Only
+ * for nodes that get settled before their moves are searched, which is
+ * where the search would otherwise find out. Uses the ply's move list. */
+IWRAM_CODE BOOL ChessAI_IsCheckmate(const ChessAI_Params_t *params) {
+  BoardState_t *const STATE = params->root_state;
+  ChessMoveList_t *const MOVES = &g_ply_move_lists[params->ply];
+  const u32 TEAM_PIECE_IDXS_OFS = SEARCH_TEAM_OFS(STATE),
+            ALLIED_KING = TEAM_PIECE_IDXS_OFS|KING,
+            OPP_IDX_OFS = PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT
+                          ^TEAM_PIECE_IDXS_OFS;
+  BoardState_Undo_t undo;
+  BOOL legal;
+  if (!BoardState_KingInCheck(STATE, ALLIED_KING, OPP_IDX_OFS))
+    return FALSE;
+  ChessMoveGen_Generate(STATE, MOVES);
+  for (u32 i = 0; MOVES->count>i; ++i) {
+    BoardState_MakeMove(STATE, &MOVES->moves[i], &undo);
+    legal = !BoardState_KingInCheck(STATE, ALLIED_KING, OPP_IDX_OFS);
+    BoardState_UnmakeMove(STATE, &undo);
+    if (legal)
+      return FALSE;
+  }
+  return TRUE;
+}
+
+IWRAM_CODE void ChessAI_ResetPonder(ChessAI_Params_t *params) {
+  params->ponder_move = (ChessMove_t) {
+    .start = INVALID_IDX_COMPACT,
+    .dst = INVALID_IDX_COMPACT,
+  };
+  params->ponder_best = (ChessAI_MoveSearch_Result_t) {
+    .start = INVALID_IDX_COMPACT,
+    .dst = INVALID_IDX_COMPACT,
+  };
+  params->ponder_key = 0;
+  params->ponder_depth = 0;
+  params->ponder_target = 0;
+  params->pondering = FALSE;
+  params->ponder_done = FALSE;
 }
@@ -0,0 +1,97 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+#define __TRANSPARENT_BOARD_STATE__
+
+#include <GBAdev_memdef.h>
+#include "chess_ai_types.h"
+#include "chess_bitbase.h"
+
+/* On top of CHESS_BITBASE_WIN_SCORE, so the search has something to make
+ * progress toward: more material (promoting is worth it), a pawn further up
+ * the board, or a weak king further from the center and closer to the
+ * strong king, where it gets mated. */
+static const i16 BITBASE_ENDING_BONUS[CHESS_BITBASE_COUNT] = {
+  [CHESS_BITBASE_KPK] = 0,
+  [CHESS_BITBASE_KRK] = 100,
+  [CHESS_BITBASE_KQK] = 200,
+};
+#define BITBASE_PAWN_ROW_BONUS 10
+#define BITBASE_EDGE_BONUS 10
+#define BITBASE_KING_CLOSE_BONUS 4
+
+/* 0 on the four center squares, up to 3 on the edges. */
+INLN u32 ChessBitbase_CenterDistance(u32 coord) {
+  return 3<coord ? coord-4 : 3-coord;
+}
+
+IWRAM_CODE BOOL ChessBitbase_Probe(const BoardState_t *state, i16 *score) {
+  const BoardState_Bitboards_t *const BBS = &state->bb;
+  const Bitboard_t OCC = BBS->teams[BB_WHITE_TEAM_IDX]
+                        |BBS->teams[BB_BLACK_TEAM_IDX],
+                   PIECE = OCC&~BBS->pieces[KING_IDX];
+  Bitboard_t rest = OCC&(OCC-1);
+  ChessBitbase_e id;
+  u32 strong_team, strong_king, piece, weak_king, flip, win;
+  BOOL strong_to_move;
+  // Exactly three pieces, one of which isn't a king.
+  rest &= rest-1;
+  if (0==rest || 0!=(rest&(rest-1)) || 0==PIECE)
+    return FALSE;
+  if (PIECE&BBS->pieces[PAWN_IDX])
+    id = CHESS_BITBASE_KPK;
+  else if (PIECE&BBS->pieces[ROOK_IDX])
+    id = CHESS_BITBASE_KRK;
+  else if (PIECE&BBS->pieces[QUEEN_IDX])
+    id = CHESS_BITBASE_KQK;
+  else
+    return FALSE;
+  strong_team = PIECE&BBS->teams[BB_WHITE_TEAM_IDX]
+                  ? BB_WHITE_TEAM_IDX
+                  : BB_BLACK_TEAM_IDX;
+  piece = (u32)__builtin_ctzll(PIECE);
+  strong_king = (u32)__builtin_ctzll(BBS->pieces[KING_IDX]
+                                      &BBS->teams[strong_team]);
+  weak_king = (u32)__builtin_ctzll(BBS->pieces[KING_IDX]
+                                    &~BBS->teams[strong_team]);
+  strong_to_move = (BB_WHITE_TEAM_IDX==strong_team)
+                    ==(0!=(state->state.side_to_move&WHITE_TO_MOVE_FLAGBIT));
+  if (!strong_to_move) {
+    const Bitboard_t ATTACKS
+        = CHESS_BITBASE_KPK==id ? BB_PAWN_ATTACKS[strong_team][piece]
+        : CHESS_BITBASE_KRK==id ? Bitboard_RookAttacks(piece, OCC)
+        : Bitboard_QueenAttacks(piece, OCC);
+    if (ATTACKS&BB_SQ_BIT(weak_king))
+      return FALSE;
+  }
+  // Turn the board around so the strong side plays up it, like white.
+  flip = BB_WHITE_TEAM_IDX==strong_team ? 0 : 56;
+  strong_king ^= flip;
+  piece ^= flip;
+  weak_king ^= flip;
+  if (!ChessBitbase_Lookup(id, ChessBitbase_Index(id,
+                                                  strong_king,
+                                                  piece,
+                                                  weak_king,
+                                                  strong_to_move))) {
+    *score = 0;
+    return TRUE;
+  }
+  win = CHESS_BITBASE_WIN_SCORE+BITBASE_ENDING_BONUS[id];
+  if (CHESS_BITBASE_KPK==id) {
+    win += BITBASE_PAWN_ROW_BONUS*(6-BB_SQ_ROW(piece));
+  } else {
+    const u32 FILE_DIST = BB_SQ_FILE(strong_king)>BB_SQ_FILE(weak_king)
+                            ? BB_SQ_FILE(strong_king)-BB_SQ_FILE(weak_king)
+                            : BB_SQ_FILE(weak_king)-BB_SQ_FILE(strong_king),
+              ROW_DIST = BB_SQ_ROW(strong_king)>BB_SQ_ROW(weak_king)
+                            ? BB_SQ_ROW(strong_king)-BB_SQ_ROW(weak_king)
+                            : BB_SQ_ROW(weak_king)-BB_SQ_ROW(strong_king);
+    win += BITBASE_EDGE_BONUS
+             *(ChessBitbase_CenterDistance(BB_SQ_FILE(weak_king))
+               +ChessBitbase_CenterDistance(BB_SQ_ROW(weak_king)))
+           + BITBASE_KING_CLOSE_BONUS*(14-FILE_DIST-ROW_DIST);
+  }
+  *score = BB_WHITE_TEAM_IDX==strong_team ? (i16)win
+                                          : -(i16)win;
+  return TRUE;
+}
@@ -0,0 +1,197 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+#define __TRANSPARENT_BOARD_STATE__
+
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#include "chess_ai_types.h"
+#include "chess_bitboard.h"
+#include "chess_board.h"
+#include "chess_board_state_analysis.h"
+#include "chess_move_gen.h"
+#include "debug_io.h"
+
+extern const ChessPiece_e PROMOTION_SEL[4];
+
+#define PUSH_MOVE(cursor, from_sq, to_sq, mv_flags, promo)\
+  (*(cursor)++ = (ChessMove_t) {\
+    .start = BB_SQ_TO_COMPACT(from_sq),\
+    .dst = BB_SQ_TO_COMPACT(to_sq),\
+    .flags = (mv_flags),\
+    .promotion = (promo),\
+  })
+
+static IWRAM_CODE ChessMove_t *MoveGen_PushPawnMove(
+                                                 ChessMove_t *cursor,
+                                                 u32 from_sq,
+                                                 u32 to_sq,
+                                                 Move_Validation_Flag_e flags,
+                                                 Bitboard_t promo_row);
+static IWRAM_CODE ChessMove_t *MoveGen_PushTargets(ChessMove_t *cursor,
+                                                   u32 from_sq,
+                                                   Bitboard_t targets,
+                                                   Bitboard_t opp);
+static IWRAM_CODE ChessMove_t *MoveGen_PushCastles(
+                                               const BoardState_t *board_state,
+                                               ChessMove_t *cursor,
+                                               ChessPiece_e us);
+
+IWRAM_CODE ChessMove_t *MoveGen_PushPawnMove(ChessMove_t *cursor,
+                                             u32 from_sq,
+                                             u32 to_sq,
+                                             Move_Validation_Flag_e flags,
+                                             Bitboard_t promo_row) {
+  if (!(BB_SQ_BIT(to_sq)&promo_row)) {
+    PUSH_MOVE(cursor, from_sq, to_sq, flags, 0);
+    return cursor;
+  }
+  for (u32 i = 0; 4>i; ++i)
+    PUSH_MOVE(cursor, from_sq, to_sq, flags, PROMOTION_SEL[i]);
+  return cursor;
+}
+
+IWRAM_CODE ChessMove_t *MoveGen_PushTargets(ChessMove_t *cursor,
+                                            u32 from_sq,
+                                            Bitboard_t targets,
+                                            Bitboard_t opp) {
+  for (u32 to_sq; targets; ) {
+    to_sq = Bitboard_PopLSB(&targets);
+    PUSH_MOVE(cursor, from_sq, to_sq,
+              (BB_SQ_BIT(to_sq)&opp) ? MOVE_CAPTURE : 0, 0);
+  }
+  return cursor;
+}
+
+IWRAM_CODE ChessMove_t *MoveGen_PushCastles(const BoardState_t *board_state,
+                                            ChessMove_t *cursor,
+                                            ChessPiece_e us) {
+  const BOOL WHITE = WHITE_FLAGBIT==us;
+  const ChessBoard_Row_e HOME_ROW = WHITE ? ROW_1 : ROW_8;
+  const ChessPiece_e THEM = us^PIECE_TEAM_MASK;
+  const u32 SHAMT = WHITE ? CASTLE_RIGHTS_WHITE_FLAGS_SHAMT
+                          : CASTLE_RIGHTS_BLACK_FLAGS_SHAMT,
+            RIGHTS = (board_state->state.castle_rights>>SHAMT)
+                        &CASTLE_RIGHTS_SHAMT_INVARIANT,
+            RID_OFS = WHITE ? PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT : 0,
+            KING_SQ = BB_SQ(FILE_E, HOME_ROW);
+  const Bitboard_t OCC = Bitboard_Occupancy(&board_state->bb);
+  const u8 (*vmap)[CHESS_BOARD_FILE_COUNT] = board_state->graph.vertex_hashmap;
+
+  if (!RIGHTS)
+    return cursor;
+  if (!(BB_SQ_BIT(KING_SQ)&board_state->bb.pieces[KING_IDX]
+                          &board_state->bb.teams[BB_TEAM_IDX(us)]))
+    return cursor;
+  if (BoardState_SquareAttacked(board_state, KING_SQ, THEM))
+    return cursor;
+  // Castling rights aren't dropped when a rook is captured at home, so make
+  // sure the right rook is actually still sitting in its corner.
+  if ((KINGSIDE_SHAMT_INVARIANT&RIGHTS)
+      && (RID_OFS|ROOK1)==vmap[HOME_ROW][FILE_H]
+      && !(OCC&(BB_SQ_BIT(BB_SQ(FILE_F, HOME_ROW))
+                |BB_SQ_BIT(BB_SQ(FILE_G, HOME_ROW))))
+      && !BoardState_SquareAttacked(board_state, BB_SQ(FILE_F, HOME_ROW), THEM)
+      && !BoardState_SquareAttacked(board_state, BB_SQ(FILE_G, HOME_ROW), THEM))
+    PUSH_MOVE(cursor, KING_SQ, BB_SQ(FILE_G, HOME_ROW),
+              MOVE_CASTLE_KINGSIDE, 0);
+  if ((QUEENSIDE_SHAMT_INVARIANT&RIGHTS)
+      && (RID_OFS|ROOK0)==vmap[HOME_ROW][FILE_A]
+      && !(OCC&(BB_SQ_BIT(BB_SQ(FILE_B, HOME_ROW))
+                |BB_SQ_BIT(BB_SQ(FILE_C, HOME_ROW))
+                |BB_SQ_BIT(BB_SQ(FILE_D, HOME_ROW))))
+      && !BoardState_SquareAttacked(board_state, BB_SQ(FILE_D, HOME_ROW), THEM)
+      && !BoardState_SquareAttacked(board_state, BB_SQ(FILE_C, HOME_ROW), THEM))
+    PUSH_MOVE(cursor, KING_SQ, BB_SQ(FILE_C, HOME_ROW),
+              MOVE_CASTLE_QUEENSIDE, 0);
+  return cursor;
+}
+
+IWRAM_CODE u32 ChessMoveGen_Generate(const BoardState_t *board_state,
+                                     ChessMoveList_t *list) {
+  const BoardState_Bitboards_t *const bbs = &board_state->bb;
+  const BOOL WHITE
+                = 0!=(board_state->state.side_to_move&WHITE_TO_MOVE_FLAGBIT);
+  const ChessPiece_e US = WHITE ? WHITE_FLAGBIT : BLACK_FLAGBIT;
+  const u32 US_IDX = BB_TEAM_IDX(US), THEM_IDX = US_IDX^1;
+  const Bitboard_t OWN = bbs->teams[US_IDX],
+                   OPP = bbs->teams[THEM_IDX],
+                   OCC = OWN|OPP,
+                   EMPTY = ~OCC,
+                   PROMO_ROW = BB_ROW(WHITE ? ROW_8 : ROW_1),
+                   PAWNS = bbs->pieces[PAWN_IDX]&OWN;
+  ChessMove_t *cursor = list->moves;
+  Bitboard_t pieces, single, twice;
+
+  // Pawn pushes. White pawns advance toward ROW_8, i.e.: toward bit 0.
+  if (WHITE) {
+    single = (PAWNS>>8)&EMPTY;
+    twice = ((single&BB_ROW(ROW_3))>>8)&EMPTY;
+  } else {
+    single = (PAWNS<<8)&EMPTY;
+    twice = ((single&BB_ROW(ROW_6))<<8)&EMPTY;
+  }
+  for (u32 to_sq; single; ) {
+    to_sq = Bitboard_PopLSB(&single);
+    cursor = MoveGen_PushPawnMove(cursor, WHITE ? to_sq+8 : to_sq-8, to_sq,
+                                  0, PROMO_ROW);
+  }
+  for (u32 to_sq; twice; ) {
+    to_sq = Bitboard_PopLSB(&twice);
+    PUSH_MOVE(cursor, WHITE ? to_sq+16 : to_sq-16, to_sq,
+              MOVE_PAWN_TWO_SQUARE, 0);
+  }
+  // Pawn captures, including en passent. ep_file is only ever left set when
+  // the side to move can actually make the capture.
+  for (pieces = PAWNS; pieces; ) {
+    const u32 FROM_SQ = Bitboard_PopLSB(&pieces);
+    Bitboard_t targets = BB_PAWN_ATTACKS[US_IDX][FROM_SQ]&OPP;
+    for (u32 to_sq; targets; ) {
+      to_sq = Bitboard_PopLSB(&targets);
+      cursor = MoveGen_PushPawnMove(cursor, FROM_SQ, to_sq, MOVE_CAPTURE,
+                                    PROMO_ROW);
+    }
+  }
+  if (EN_PASSENT_POSSIBLE(board_state->state.ep_file)) {
+    const u32 EP_SQ = BB_SQ(board_state->state.ep_file,
+                            WHITE ? ROW_6 : ROW_3);
+    pieces = BB_PAWN_ATTACKS[THEM_IDX][EP_SQ]&PAWNS;
+    for (u32 from_sq; pieces; ) {
+      from_sq = Bitboard_PopLSB(&pieces);
+      PUSH_MOVE(cursor, from_sq, EP_SQ, MOVE_CAPTURE|MOVE_EN_PASSENT, 0);
+    }
+  }
+
+  for (pieces = bbs->pieces[KNIGHT_IDX]&OWN; pieces; ) {
+    const u32 FROM_SQ = Bitboard_PopLSB(&pieces);
+    cursor = MoveGen_PushTargets(cursor, FROM_SQ,
+                                 BB_KNIGHT_ATTACKS[FROM_SQ]&~OWN, OPP);
+  }
+  for (pieces = bbs->pieces[BISHOP_IDX]&OWN; pieces; ) {
+    const u32 FROM_SQ = Bitboard_PopLSB(&pieces);
+    cursor = MoveGen_PushTargets(cursor, FROM_SQ,
+                                 Bitboard_BishopAttacks(FROM_SQ, OCC)&~OWN,
+                                 OPP);
+  }
+  for (pieces = bbs->pieces[ROOK_IDX]&OWN; pieces; ) {
+    const u32 FROM_SQ = Bitboard_PopLSB(&pieces);
+    cursor = MoveGen_PushTargets(cursor, FROM_SQ,
+                                 Bitboard_RookAttacks(FROM_SQ, OCC)&~OWN,
+                                 OPP);
+  }
+  for (pieces = bbs->pieces[QUEEN_IDX]&OWN; pieces; ) {
+    const u32 FROM_SQ = Bitboard_PopLSB(&pieces);
+    cursor = MoveGen_PushTargets(cursor, FROM_SQ,
+                                 Bitboard_QueenAttacks(FROM_SQ, OCC)&~OWN,
+                                 OPP);
+  }
+  for (pieces = bbs->pieces[KING_IDX]&OWN; pieces; ) {
+    const u32 FROM_SQ = Bitboard_PopLSB(&pieces);
+    cursor = MoveGen_PushTargets(cursor, FROM_SQ,
+                                 BB_KING_ATTACKS[FROM_SQ]&~OWN, OPP);
+  }
+  cursor = MoveGen_PushCastles(board_state, cursor, US);
+
+  list->count = (u32)(cursor-list->moves);
+  assert(CHESS_MOVE_LIST_CAPACITY>=list->count);
+  return list->count;
+}
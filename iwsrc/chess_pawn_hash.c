@@ -0,0 +1,93 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+#define __TRANSPARENT_BOARD_STATE__
+
+#include <GBAdev_memdef.h>
+#include "chess_pawn_hash.h"
+#include "chess_eval.h"
+
+/* Indexed by how many rows a passed pawn has advanced from its own back row,
+ * so both teams share it. */
+static const i16 PASSED_PAWN_BONUS[EVAL_STAGE_COUNT][CHESS_BOARD_ROW_COUNT] = {
+  [EVAL_MG] = { 0,  5, 10, 15, 25, 40,  60, 0 },
+  [EVAL_EG] = { 0, 10, 15, 25, 45, 70, 100, 0 },
+};
+
+/* Collapses a set of squares onto the files they occupy, FILE_A as bit 0. */
+INLN u32 PawnHash_Files(Bitboard_t bb) {
+  bb |= bb>>32;
+  bb |= bb>>16;
+  bb |= bb>>8;
+  return (u32)bb&0xFFU;
+}
+
+/* Adds one team's doubled, isolated and passed pawns into score, from that
+ * team's point of view. */
+static IWRAM_CODE void PawnHash_ScoreTeam(i32 score[EVAL_STAGE_COUNT],
+                                          Bitboard_t pawns,
+                                          Bitboard_t passed,
+                                          u32 team_idx) {
+  const u32 FILES = PawnHash_Files(pawns),
+            ISOLATED_FILES = FILES&~((FILES<<1)|(FILES>>1));
+  // One pawn per occupied file is fine, the rest are doubled up.
+  const i32 DOUBLED = (i32)(Bitboard_PopCount(pawns)
+                           -(u32)__builtin_popcount(FILES)),
+            // Spreading a byte of files across every row turns it into the
+            // set of squares on those files.
+            ISOLATED = (i32)Bitboard_PopCount(pawns
+                                              &(ISOLATED_FILES*BB_FILE_A));
+  u32 row;
+  score[EVAL_MG] += DOUBLED*PAWN_DOUBLED_MG + ISOLATED*PAWN_ISOLATED_MG;
+  score[EVAL_EG] += DOUBLED*PAWN_DOUBLED_EG + ISOLATED*PAWN_ISOLATED_EG;
+  while (passed) {
+    row = BB_SQ_ROW(Bitboard_PopLSB(&passed));
+    if (BB_WHITE_TEAM_IDX==team_idx)
+      row = ROW_1-row;
+    score[EVAL_MG] += PASSED_PAWN_BONUS[EVAL_MG][row];
+    score[EVAL_EG] += PASSED_PAWN_BONUS[EVAL_EG][row];
+  }
+}
+
+static IWRAM_CODE void PawnHash_Fill(PawnHash_Entry_t *ent,
+                                     const BoardState_Bitboards_t *bbs) {
+  const Bitboard_t PAWNS = bbs->pieces[PAWN_IDX],
+                   WHITE = PAWNS&bbs->teams[BB_WHITE_TEAM_IDX],
+                   BLACK = PAWNS&bbs->teams[BB_BLACK_TEAM_IDX],
+                   // Squares straight ahead of each team's pawns.
+                   WHITE_FRONT = Bitboard_FillNorth(WHITE>>8),
+                   BLACK_FRONT = Bitboard_FillSouth(BLACK<<8),
+                   WHITE_SPAN = Bitboard_WhitePawnAttacks(
+                                                Bitboard_FillNorth(WHITE)),
+                   BLACK_SPAN = Bitboard_BlackPawnAttacks(
+                                                Bitboard_FillSouth(BLACK));
+  i32 white_score[EVAL_STAGE_COUNT] = {0}, black_score[EVAL_STAGE_COUNT] = {0};
+  // Passed: nothing in the way on its own file and nothing on the files
+  // either side that could ever capture it on the way up.
+  PawnHash_ScoreTeam(white_score,
+                     WHITE,
+                     WHITE&~(BLACK_FRONT|BLACK_SPAN),
+                     BB_WHITE_TEAM_IDX);
+  PawnHash_ScoreTeam(black_score,
+                     BLACK,
+                     BLACK&~(WHITE_FRONT|WHITE_SPAN),
+                     BB_BLACK_TEAM_IDX);
+  ent->attack_spans[BB_WHITE_TEAM_IDX] = WHITE_SPAN;
+  ent->attack_spans[BB_BLACK_TEAM_IDX] = BLACK_SPAN;
+  ent->mg = white_score[EVAL_MG]-black_score[EVAL_MG];
+  ent->eg = white_score[EVAL_EG]-black_score[EVAL_EG];
+}
+
+IWRAM_CODE const PawnHash_Entry_t *PawnHash_Probe(PawnHash_t *ph,
+                                                  const BoardState_t *state) {
+  assert(NULL!=ph);
+  const u32 KEY = state->pawn_zobrist;
+  PawnHash_Entry_t *const ent = &ph->entries[KEY&PAWN_HASH_IDX_MASK];
+  ++ph->probes;
+  if (KEY==ent->key) {
+    ++ph->hits;
+    return ent;
+  }
+  PawnHash_Fill(ent, &state->bb);
+  ent->key = KEY;
+  return ent;
+}
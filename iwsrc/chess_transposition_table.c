@@ -4,53 +4,101 @@
 
 #include <GBAdev_memdef.h>
 #include "chess_transposition_table.h"
+#include "chess_bitboard.h"
 
-static int tt_probes=0, tt_hits = 0;
+#define ENT_BOUND(ent) ((TTable_Bound_e)((ent)->gen_bound&TTABLE_BOUND_MASK))
+#define ENT_AGE(tt, ent)\
+  (((tt)->generation-((ent)->gen_bound>>2))&TTABLE_GEN_MASK)
 
-IWRAM_CODE BOOL TTable_Probe(TTable_t *tt,
-                             TTableEnt_t *query_entry) {
-  if (NULL==query_entry)
+IWRAM_CODE void TTable_Init(TTable_t *tt) {
+  assert(NULL!=tt);
+  tt->generation = (tt->generation+TTENT_TIME_TO_LIVE+1)&TTABLE_GEN_MASK;
+  tt->probes = tt->hits = 0;
+}
+
+IWRAM_CODE BOOL TTable_Probe(TTable_t *tt, TTable_Query_t *query) {
+  if (NULL==query)
     return FALSE;
   assert (NULL!=tt);
-  ++tt_probes;
-  const u64 KEY = query_entry->key;
-  const TTableEnt_t *const SLOT_BUCKETS = tt->slots[KEY&TTABLE_IDX_MASK].buckets;
-  u64 curkey;
-  u32 slot_idx = KEY&TTABLE_IDX_MASK;
-  const u8 MAXDEPTH = query_entry->depth;
-  const u8 CURGEN = query_entry->gen;
-  for (int  i=0; TTABLE_CLUSTER_SIZE>i; ++i) {
-    curkey = SLOT_BUCKETS[i].key;
-    if (!curkey || KEY!=curkey)
+  ++tt->probes;
+  const u16 CHECK = TTABLE_KEY_CHECK(query->key);
+  TTableEnt_t *const SLOT_BUCKETS =
+                              tt->slots[query->key&TTABLE_IDX_MASK].buckets;
+  for (int i=0; TTABLE_CLUSTER_SIZE>i; ++i) {
+    TTableEnt_t *const ENT = &SLOT_BUCKETS[i];
+    if (CHECK!=ENT->check || TTABLE_BOUND_NONE==ENT_BOUND(ENT))
       continue;
-    if ((CURGEN-SLOT_BUCKETS[i].gen)>TTENT_TIME_TO_LIVE) {
-      // Lazy delete by setting key equal to zero.
-      tt->slots[slot_idx].buckets[i].key = 0ULL;
+    if (ENT_AGE(tt, ENT)>TTENT_TIME_TO_LIVE) {
+      // Lazy delete by clearing the bound.
+      ENT->gen_bound = 0;
       continue;
     }
-    if (MAXDEPTH < SLOT_BUCKETS[i].depth)
-      continue;
-    *query_entry = SLOT_BUCKETS[i];
-    ++tt_hits;
+    const TTable_Move_t MV = ENT->move;
+    query->best_move = (TTable_BestMove_Score_t) {
+      .score = ENT->score,
+      .start = TTABLE_MOVE_NONE==MV ? INVALID_IDX_COMPACT
+                                    : BB_SQ_TO_COMPACT(TTABLE_MOVE_START(MV)),
+      .dst = TTABLE_MOVE_NONE==MV ? INVALID_IDX_COMPACT
+                                  : BB_SQ_TO_COMPACT(TTABLE_MOVE_DST(MV)),
+      .promo = TTABLE_MOVE_PROMO(MV),
+    };
+    query->depth = ENT->depth;
+    query->bound = ENT_BOUND(ENT);
+    ++tt->hits;
     return TRUE;
   }
   return FALSE;
 }
 
-IWRAM_CODE void TTable_Insert(TTable_t *tt, const TTableEnt_t *entry) {
-  TTableEnt_t *const slot_buckets = tt->slots[(entry->key)&TTABLE_IDX_MASK].buckets;
-  int target=0;
+IWRAM_CODE void TTable_Insert(TTable_t *tt, const TTable_Query_t *entry) {
+  TTableEnt_t *const slot_buckets =
+                              tt->slots[entry->key&TTABLE_IDX_MASK].buckets;
+  const u16 CHECK = TTABLE_KEY_CHECK(entry->key);
+  TTable_Move_t move = TTABLE_MOVE_NONE;
+  int target=0, target_worth=INT32_MAX;
+  if (INVALID_IDX_COMPACT_RAW!=entry->best_move.start.raw)
+    move = TTABLE_MOVE_PACK(BB_SQ_FROM_COMPACT(entry->best_move.start),
+                            BB_SQ_FROM_COMPACT(entry->best_move.dst),
+                            entry->best_move.promo);
+  // Same position goes back in its own entry. Otherwise the victim is the
+  // entry worth least, counting empty and stale entries as worth nothing and
+  // knocking some depth off the others for each search they've sat through.
   for (int i=0; TTABLE_CLUSTER_SIZE>i; ++i) {
-    if (!slot_buckets[i].key) {
+    const TTableEnt_t *const ENT = &slot_buckets[i];
+    const u32 AGE = ENT_AGE(tt, ENT);
+    int worth;
+    if (TTABLE_BOUND_NONE==ENT_BOUND(ENT) || AGE>TTENT_TIME_TO_LIVE) {
+      worth = INT32_MIN;
+    } else if (CHECK==ENT->check) {
       target = i;
+      if (TTABLE_MOVE_NONE==move)
+        move = ENT->move;
       break;
+    } else {
+      worth = (int)ENT->depth - TTABLE_AGE_WEIGHT*(int)AGE;
     }
-    if (slot_buckets[i].gen != entry->gen) {
+    if (worth<target_worth) {
       target = i;
-      break;
+      target_worth = worth;
     }
-    if (slot_buckets[i].depth < slot_buckets[target].depth)
-      target = i;
   }
-  slot_buckets[target] = *entry;
+  slot_buckets[target] = (TTableEnt_t) {
+    .check = CHECK,
+    .move = move,
+    .score = entry->best_move.score,
+    .depth = entry->depth,
+    .gen_bound = (u8)((tt->generation<<2)|entry->bound),
+  };
+}
+
+IWRAM_CODE u32 TTable_Usage(const TTable_t *tt) {
+  const u32 SAMPLE = MIN(TTABLE_USAGE_SAMPLE, TTABLE_SIZE*TTABLE_CLUSTER_SIZE);
+  u32 used = 0;
+  for (u32 i = 0; SAMPLE>i; ++i) {
+    const TTableEnt_t *const ENT
+      = &tt->slots[i/TTABLE_CLUSTER_SIZE].buckets[i%TTABLE_CLUSTER_SIZE];
+    if (TTABLE_BOUND_NONE!=ENT_BOUND(ENT) && 0==ENT_AGE(tt, ENT))
+      ++used;
+  }
+  return used*TTABLE_USAGE_SAMPLE/SAMPLE;
 }
@@ -0,0 +1,89 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+#define __TRANSPARENT_BOARD_STATE__
+
+#include <GBAdev_types.h>
+#include "chess_ai.h"
+#include "chess_ai_types.h"
+#include "chess_bench.h"
+#include "chess_board_state.h"
+#include "chess_clock.h"
+#include "chess_transposition_table.h"
+
+/* Openings, middlegames and endings, quiet and tactical, including the
+ * standard perft positions and a few bitbase endings. */
+const char *const CHESS_BENCH_FENS[] = {
+  "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+  "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+  "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+  "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+  "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+  "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+  "r3k2r/2pb1ppp/2pp1q2/p7/1nP1B3/1P2P3/P2N1PPP/R2QK2R w KQkq a6 0 14",
+  "4rrk1/2p1b1p1/p1p3q1/4p3/2P2n1p/1P1NR2P/PB3PP1/3R1QK1 b - - 2 24",
+  "r3qbrk/6p1/2b2pPp/p3pP1Q/PpPpP2P/3P1B2/2PB3K/R5R1 w - - 16 42",
+  "6k1/1R3p2/6p1/2Bp3p/3P2q1/P7/1P2rQ1K/5R2 b - - 4 44",
+  "8/8/1p2k1p1/3p3p/1p1P1P1P/1P2PK2/8/8 w - - 3 54",
+  "7r/2p3k1/1p1p1qp1/1P1Bp3/p1P2r1P/P7/4R3/Q4RK1 w - - 0 36",
+  "r1bq1rk1/pp2b1pp/n1pp1n2/3P1p2/2P1p3/2N1P2N/PP2BPPP/R1BQ1RK1 b - - 2 10",
+  "3r3k/2r4p/1p1b3q/p4P2/P2Pp3/1B2P3/3BQ1RP/6K1 w - - 3 87",
+  "2r4r/1p4k1/1Pnp4/3Qb1pq/8/4BpPp/5P2/2RR1BK1 w - - 0 42",
+  "2q3r1/1r2pk2/pp3pp1/2pP3p/P1Pb1BbP/1P4Q1/R3NPP1/4R1K1 w - - 2 34",
+  "1r2r2k/1b4q1/pp5p/2pPp1p1/P3Pn2/1P1B1Q1P/2R3P1/4BR1K b - - 1 37",
+  "r3kbbr/pp1n1p1P/3ppnp1/q5N1/1P1pP3/P1N1B3/2P1QP2/R3KB1R b KQq b3 0 17",
+  "8/6pk/2b1Rp2/3r4/1R1B2PP/P5K1/8/2r5 b - - 16 42",
+  "1r4k1/4ppb1/2n1b1qp/pB4p1/1n1BP1P1/7P/2PNQPK1/3RN3 w - - 8 29",
+  "8/p2B4/PkP5/4p1pK/4Pb1p/5P2/8/8 w - - 29 68",
+  "3r4/ppq1ppkp/4bnp1/2pN4/2P1P3/1P4P1/PQ3PBP/R4K2 b - - 2 20",
+  "5rr1/4n2k/4q2P/P1P2n2/3B1p2/4pP2/2N1P3/1RR1K2Q w - - 1 49",
+  "1r5k/2pq2p1/3p3p/p1pP4/4QP2/PP1R3P/6PK/8 w - - 1 51",
+  "q5k1/5ppp/1r3bn1/1B6/P1N2P2/BQ2P1P1/5K1P/8 b - - 2 34",
+  "r1bqk2r/pppp1ppp/5n2/4b3/4P3/P1N5/1PP2PPP/R1BQKB1R w KQkq - 0 5",
+  "r1bqr1k1/pp1p1ppp/2p5/8/3N1Q2/P2BB3/1PP2PPP/R3K2n b Q - 1 12",
+  "r1bq2k1/p4r1p/1pp2pp1/3p4/1P1B3Q/P2B1N2/2P3PP/4R1K1 b - - 2 19",
+  "4k3/8/8/8/8/8/8/4K2R w K - 0 1",
+  "8/8/8/4k3/8/8/4P3/4K3 w - - 0 1",
+};
+const u32 CHESS_BENCH_POSITION_COUNT
+                          = sizeof(CHESS_BENCH_FENS)/sizeof(*CHESS_BENCH_FENS);
+
+u32 ChessBench_Run(u32 depth,
+                   ChessBench_Report_cb report,
+                   ChessBench_Result_t *total) {
+  BoardState_t *const root = BoardState_Alloc();
+  ChessAI_Params_t ai;
+  ChessAI_MoveSearch_Result_t move;
+  ChessBench_Result_t position;
+  u32 i, start;
+  *total = (ChessBench_Result_t){0};
+  if (NULL==root)
+    return 0;
+  for (i = 0; CHESS_BENCH_POSITION_COUNT>i; ++i) {
+    if (NULL==BoardState_FromFEN(root, CHESS_BENCH_FENS[i]))
+      break;
+    ChessAI_Params_Init(&ai,
+                        root,
+                        depth,
+                        root->state.side_to_move&WHITE_TO_MOVE_FLAGBIT
+                          ? WHITE_FLAGBIT
+                          : BLACK_FLAGBIT);
+    ai.book = FALSE;
+    ai.time_budget = 0;
+    start = ChessClock_Ticks();
+    ChessAI_Move(&ai, &move);
+    position = (ChessBench_Result_t) {
+      .nodes = ai.nodes+ai.qnodes,
+      .ticks = ChessClock_Ticks()-start,
+      .tt_probes = ai.ttable->probes,
+      .tt_hits = ai.ttable->hits,
+    };
+    total->nodes += position.nodes;
+    total->ticks += position.ticks;
+    total->tt_probes += position.tt_probes;
+    total->tt_hits += position.tt_hits;
+    if (NULL!=report)
+      report(i, &move, &position);
+  }
+  BoardState_Dealloc(root);
+  return i;
+}
@@ -0,0 +1,1210 @@
+//---------------------------------------------------------------
+// Auto-gen'd endgame bitbases by bin/host/bitbase_gen. Regenerate
+// with make bitbases instead of editing by hand.
+//---------------------------------------------------------------
+#include "chess_bitbase.h"
+
+static const u16 KPK_BLOCKS[768] = {
+  0x0000, 0x0001, 0x0002, 0x0001, 0x0003, 0x0001, 0x0004, 0x0001, 0x0001, 0x0001,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0005, 0x0006, 0x0007, 0x0008,
+  0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+  0x000D, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015,
+  0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0017, 0x0018,
+  0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x001F, 0x001F, 0x001F,
+  0x001F, 0x001F, 0x001F, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025,
+  0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+  0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+  0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+  0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0040, 0x0040, 0x0040,
+  0x0040, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048,
+  0x0049, 0x004A, 0x004B, 0x004B, 0x004B, 0x004B, 0x004B, 0x004B, 0x004C, 0x004D,
+  0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+  0x0058, 0x0058, 0x0058, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E,
+  0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+  0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072,
+  0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C,
+  0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086,
+  0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+  0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0095, 0x0097, 0x0098, 0x0099,
+  0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+  0x00A4, 0x00A5, 0x0095, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC,
+  0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6,
+  0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+  0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA,
+  0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4,
+  0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00D8, 0x00DA, 0x00DB, 0x00DC, 0x00DD,
+  0x00DE, 0x00DF, 0x00E0, 0x00D8, 0x00E1, 0x00E2, 0x00E3, 0x00E2, 0x00E4, 0x00E5,
+  0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+  0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9,
+  0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100, 0x0101, 0x0102, 0x0103,
+  0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x010C, 0x010D,
+  0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0115,
+  0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x0120,
+  0x0121, 0x0122, 0x0123, 0x0124, 0x0125, 0x0126, 0x0127, 0x0128, 0x0129, 0x012A,
+  0x012B, 0x012C, 0x012D, 0x012E, 0x012F, 0x0130, 0x0131, 0x0132, 0x0133, 0x0134,
+  0x0135, 0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E,
+  0x013F, 0x0140, 0x0141, 0x0142, 0x0143, 0x0144, 0x0145, 0x0144, 0x0146, 0x0144,
+  0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144, 0x0144,
+  0x0147, 0x0148, 0xFFFF, 0x0148, 0x0149, 0x0148, 0x014A, 0x0148, 0x0148, 0x0148,
+  0x0148, 0x0148, 0x0148, 0x0148, 0x0148, 0x0148, 0x014B, 0x014C, 0xFFFF, 0x014D,
+  0x014E, 0x014D, 0x014F, 0x0150, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151, 0x0151,
+  0x0151, 0x0151, 0x0152, 0x0153, 0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159,
+  0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015A, 0x015B, 0x015C,
+  0x015D, 0x015C, 0x015E, 0x015C, 0x015F, 0x015C, 0x015C, 0x015C, 0x015C, 0x015C,
+  0x015C, 0x015C, 0x015C, 0x015C, 0x0160, 0x0161, 0x0162, 0x0163, 0x0164, 0x0163,
+  0x0165, 0x0163, 0x0166, 0x0161, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167, 0x0167,
+  0x0168, 0x0169, 0x016A, 0x016B, 0x016C, 0x016B, 0x016D, 0x016B, 0x016E, 0x016F,
+  0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0170, 0x0171, 0x0172, 0x0173, 0x0174,
+  0x0175, 0x0176, 0x0177, 0x0178, 0x0179, 0x017A, 0x017B, 0x017B, 0x017B, 0x017B,
+  0x017B, 0x017B, 0x017C, 0x017D, 0x017E, 0x017F, 0x0180, 0x0181, 0x0182, 0x0183,
+  0x0184, 0x0185, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0186, 0x0187, 0x0188,
+  0x0189, 0x018A, 0x018B, 0x018C, 0x018D, 0x018E, 0x018F, 0x0190, 0x0191, 0x0192,
+  0x0192, 0x0192, 0x0192, 0x0192, 0x0193, 0x0194, 0x0195, 0x0196, 0x0197, 0x0198,
+  0x0199, 0x019A, 0x019B, 0x019C, 0x019D, 0x019E, 0x019F, 0x019F, 0x019F, 0x019F,
+  0x01A0, 0x01A1, 0x01A2, 0x01A3, 0x01A4, 0x01A5, 0x01A6, 0x01A7, 0x01A8, 0x01A9,
+  0x01AA, 0x01AB, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AD, 0x01AE, 0x01AF, 0x01B0,
+  0x01B1, 0x01B2, 0x01B3, 0x01B4, 0x01B5, 0x01B6, 0x01B7, 0x01B8, 0x01B9, 0x01B9,
+  0x01B9, 0x01B9, 0x01BA, 0x01BB, 0x01BC, 0x01BD, 0x01BE, 0x01BF, 0x01C0, 0x01C1,
+  0x01C2, 0x01C3, 0x01C4, 0x01C5, 0x01C6, 0x01C7, 0x01C8, 0x01C9, 0x01CA, 0x01CB,
+  0x01CC, 0x01CD, 0x01CE, 0x01CF, 0x01D0, 0x01D1, 0x01D2, 0x01D3, 0x01D4, 0x01D5,
+  0x01D6, 0x01D7, 0x01D8, 0x01D9, 0x01DA, 0x01DB, 0x01DC, 0x01DD, 0x01DE, 0x01DF,
+  0x01E0, 0x01E1, 0x01E2, 0x01E3, 0x01E4, 0x01E5, 0x01E6, 0x01E7, 0x0077, 0x01E8,
+  0x01E9, 0x01EA, 0x01EB, 0x01EC, 0x01ED, 0x01EE, 0x01EF, 0x01F0, 0x01F1, 0x01F2,
+  0x01F3, 0x0094, 0x01F4, 0x0096, 0x0095, 0x0097, 0x01F5, 0x01F6, 0x01F7, 0x01F8,
+  0x01F9, 0x01FA, 0x01FB, 0x01FC, 0x01FD, 0x01FE, 0x01FF, 0x0200, 0x0201, 0x0202,
+  0x0203, 0x0204, 0x0205, 0x0206, 0x0207, 0x0208, 0x0209, 0x020A, 0x020B, 0x020C,
+  0x020D, 0x020E, 0x020F, 0x0210, 0x0211, 0x0212, 0x0213, 0x0214, 0x0215, 0x0216,
+  0x0217, 0x0218, 0x0219, 0x021A, 0x021B, 0x021C, 0x021D, 0x021E, 0x021F, 0x0220,
+  0x0221, 0x0222, 0x0223, 0x0224, 0x0225, 0x0226, 0x0227, 0x0228, 0x0229, 0x022A,
+  0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0233, 0x0234,
+  0x0235, 0x0236, 0x0237, 0x0238, 0x0239, 0x023A, 0x023B, 0x023C, 0x023D, 0x023C,
+  0x023E, 0x023F, 0x0240, 0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247,
+  0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024B, 0x024D, 0x024E, 0x024F, 0x0250,
+  0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A,
+  0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260, 0x0261, 0x0262,
+};
+
+static const u32 KPK_WORDS[4888] = {
+  0xFFF1F3F3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFCFFFE, 0xFFFFFFFF,
+  0xFFF8FDFC, 0xFFFFFFFF, 0xFFF8F9F8, 0xFFFFFFFF, 0xFFF8F9F8, 0xFFFFFFFF,
+  0xFFF8F9F8, 0xFFFFFFFF, 0xFFF8F9F8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFEFFFE, 0xFFFFFFFF, 0xFFFCFDFC, 0xFFFFFFFF,
+  0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFC, 0xFFFFFFFF, 0xFFFEFFFC, 0xFFFFFFFF,
+  0xFFFCFDF8, 0xFFFFFFFF, 0xFFFBF9F8, 0xFFFFFFFF, 0xFFFFF9F8, 0xFFFFFFFF,
+  0xFFFEF9F8, 0xFFFFFFFF, 0xFFFCF9F8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFF8FEFC, 0xFFFFFFFF,
+  0xFFF0FAF8, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF,
+  0xFFF0F2F0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFCFEFC, 0xFFFFFFFF, 0xFFF8FAF8, 0xFFFFFFFF,
+  0xFFF0F2F0, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF,
+  0xFFFFFBFA, 0xFFFFFFFF, 0xFFFFFFFD, 0xFFFFFFFF, 0xFFFFFEFA, 0xFFFFFFFF,
+  0xFFFCFEF8, 0xFFFFFFFF, 0xFFF8FAF0, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF,
+  0xFFF0F2F0, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF, 0xFFF3F2F0, 0xFFFFFFFF,
+  0xFFF7F2F0, 0xFFFFFFFF, 0xFFFEF2F0, 0xFFFFFFFF, 0xFFFCF2F0, 0xFFFFFFFF,
+  0xFFF8F2F0, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF,
+  0xFFF0F2F0, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF,
+  0xFFF0F2F0, 0xFFFFFFFF, 0xFFF0F2F0, 0xFFFFFFFF, 0xFFF1F7F3, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFF1FDF9, 0xFFFFFFFF, 0xFFE0F4F0, 0xFFFFFFFF, 0xFFE0E4E0, 0xFFFFFFFF,
+  0xFFE0E4E0, 0xFFFFFFFF, 0xFFF3F7F3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFF9FDF9, 0xFFFFFFFF,
+  0xFFF0F4F0, 0xFFFFFFFF, 0xFFE0E4E0, 0xFFFFFFFF, 0xFFE0E4E0, 0xFFFFFFFF,
+  0xFFF3F7F0, 0xFFFFFFFF, 0xFFFFF7F4, 0xFFFFFFFF, 0xFFFFFFFB, 0xFFFFFFFF,
+  0xFFFFFDF5, 0xFFFFFFFF, 0xFFF9FDF1, 0xFFFFFFFF, 0xFFF0F4E0, 0xFFFFFFFF,
+  0xFFE0E4E0, 0xFFFFFFFF, 0xFFE0E4E0, 0xFFFFFFFF, 0xFFE3E4E0, 0xFFFFFFFF,
+  0xFFE7E4E0, 0xFFFFFFFF, 0xFFEEE4E0, 0xFFFFFFFF, 0xFFFCE4E0, 0xFFFFFFFF,
+  0xFFF8E4E0, 0xFFFFFFFF, 0xFFF0E4E0, 0xFFFFFFFF, 0xFFE0E4E0, 0xFFFFFFFF,
+  0xFFE0E4E0, 0xFFFFFFFF, 0xFFE0E4E0, 0xFFFFFFFF, 0xFFE0E4E0, 0xFFFFFFFF,
+  0xFFE0E4E0, 0xFFFFFFFF, 0xFFE0E4E0, 0xFFFFFFFF, 0xFFC1CBC3, 0xFFFFFFFF,
+  0xFFE3EFE7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFE3FBF3, 0xFFFFFFFF, 0xFFC1E9E1, 0xFFFFFFFF,
+  0xFFC1C9C1, 0xFFFFFFFF, 0xFFC3CBC3, 0xFFFFFFFF, 0xFFE7EFE7, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFF3FBF3, 0xFFFFFFFF, 0xFFE1E9E1, 0xFFFFFFFF, 0xFFC1C9C1, 0xFFFFFFFF,
+  0xFFC3CBC1, 0xFFFFFFFF, 0xFFE7EFE3, 0xFFFFFFFF, 0xFFFFEFEB, 0xFFFFFFFF,
+  0xFFFFFFF7, 0xFFFFFFFF, 0xFFFFFBEB, 0xFFFFFFFF, 0xFFF3FBE3, 0xFFFFFFFF,
+  0xFFE1E9C1, 0xFFFFFFFF, 0xFFC1C9C1, 0xFFFFFFFF, 0xFFC3C9C1, 0xFFFFFFFF,
+  0xFFC7C9C1, 0xFFFFFFFF, 0xFFCFC9C1, 0xFFFFFFFF, 0xFFDDC9C1, 0xFFFFFFFF,
+  0xFFF9C9C1, 0xFFFFFFFF, 0xFFF1C9C1, 0xFFFFFFFF, 0xFFE1C9C1, 0xFFFFFFFF,
+  0xFFC1C9C1, 0xFFFFFFFF, 0xFFC1C9C1, 0xFFFFFFFF, 0xFFC1C9C1, 0xFFFFFFFF,
+  0xFFC1C9C1, 0xFFFFFFFF, 0xFFC1C9C1, 0xFFFFFFFF, 0xF8F1F3F3, 0xFFFFFFFF,
+  0xFCFDFFFF, 0xFFFFFFFF, 0xF8F9FEFE, 0xFFFFFFFF, 0xF0F1FCFC, 0xFFFFFFFF,
+  0xF0F1F8F8, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF,
+  0xF0F1F0F0, 0xFFFFFFFF, 0xFFF3F3F3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFCFFFEFE, 0xFFFFFFFF, 0xF8FDFCFC, 0xFFFFFFFF, 0xF0F9F8F8, 0xFFFFFFFF,
+  0xF0F1F0F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFF8, 0xFFFFFFFF, 0xFEFFFEF8, 0xFFFFFFFF,
+  0xFCFDFCF0, 0xFFFFFFFF, 0xF8F9F8F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF,
+  0xF0F1F0F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF, 0xF3F3F0F0, 0xFFFFFFFF,
+  0xFFF7F0F0, 0xFFFFFFFF, 0xFEFFF0F0, 0xFFFFFFFF, 0xFCFDF0F0, 0xFFFFFFFF,
+  0xF8F9F0F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF,
+  0xF0F1F0F0, 0xFFFFFFFF, 0xF3F1F0F0, 0xFFFFFFFF, 0xF7F1F0F0, 0xFFFFFFFF,
+  0xFEF1F0F0, 0xFFFFFFFF, 0xFCF1F0F0, 0xFFFFFFFF, 0xF8F1F0F0, 0xFFFFFFFF,
+  0xF0F1F0F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF,
+  0xF0F1F0F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF, 0xF0F1F0F0, 0xFFFFFFFF,
+  0xF0F1F0F0, 0xFFFFFFFF, 0xF8FAFBFF, 0xFFFFFFFF, 0xF8FAFFFF, 0xFFFFFFFF,
+  0xF8FAFEFE, 0xFFFFFFFF, 0xF0F2FCFC, 0xFFFFFFFF, 0xE0E2F8F8, 0xFFFFFFFF,
+  0xE0E2F0F0, 0xFFFFFFFF, 0xE0E2E0E0, 0xFFFFFFFF, 0xE0E2E0E0, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF,
+  0xF8FEFCFC, 0xFFFFFFFF, 0xF0FAF8F8, 0xFFFFFFFF, 0xE0F2F0F0, 0xFFFFFFFF,
+  0xE0E2E0E0, 0xFFFFFFFF, 0xE0E2E0E0, 0xFFFFFFFF, 0xFFFFFFFD, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFEF5, 0xFFFFFFFF, 0xFCFEFCF8, 0xFFFFFFFF,
+  0xF8FAF8F0, 0xFFFFFFFF, 0xF0F2F0E0, 0xFFFFFFFF, 0xE0E2E0E0, 0xFFFFFFFF,
+  0xE0E2E0E0, 0xFFFFFFFF, 0xFFFBF8F8, 0xFFFFFFFF, 0xFFFFF8F8, 0xFFFFFFFF,
+  0xFFFEF8F8, 0xFFFFFFFF, 0xFCFEF8F8, 0xFFFFFFFF, 0xF8FAF0F0, 0xFFFFFFFF,
+  0xF0F2E0E0, 0xFFFFFFFF, 0xE0E2E0E0, 0xFFFFFFFF, 0xE0E2E0E0, 0xFFFFFFFF,
+  0xF3F2F0F0, 0xFFFFFFFF, 0xF7F2F0F0, 0xFFFFFFFF, 0xFEF2F0F0, 0xFFFFFFFF,
+  0xFCE2E0F0, 0xFFFFFFFF, 0xF8E2E0F0, 0xFFFFFFFF, 0xF0E2E0E0, 0xFFFFFFFF,
+  0xE0E2E0E0, 0xFFFFFFFF, 0xE0E2E0E0, 0xFFFFFFFF, 0xE0E2E0E0, 0xFFFFFFFF,
+  0xE0E2E0E0, 0xFFFFFFFF, 0xE0E2E0E0, 0xFFFFFFFF, 0xE0E2E0E0, 0xFFFFFFFF,
+  0xF0F4F3F3, 0xFFFFFFFF, 0xF1F5F7FF, 0xFFFFFFFF, 0xF1F5FFFF, 0xFFFFFFFF,
+  0xF1F5FDFF, 0xFFFFFFFF, 0xE1E5F9F9, 0xFFFFFFFF, 0xC0C4F0F0, 0xFFFFFFFF,
+  0xC0C4E0E0, 0xFFFFFFFF, 0xC0C4C0C0, 0xFFFFFFFF, 0xF1F7F3F3, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xF1FDF9F9, 0xFFFFFFFF, 0xE0F4F0F0, 0xFFFFFFFF, 0xC0E4E0E0, 0xFFFFFFFF,
+  0xC0C4C0C0, 0xFFFFFFFF, 0xF3F7F3F1, 0xFFFFFFFF, 0xFFFFFFFA, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFEB, 0xFFFFFFFF, 0xF9FDF9F1, 0xFFFFFFFF,
+  0xF0F4F0E0, 0xFFFFFFFF, 0xE0E4E0C0, 0xFFFFFFFF, 0xC0C4C0C0, 0xFFFFFFFF,
+  0xF3F7F1F1, 0xFFFFFFFF, 0xFFF7F1F1, 0xFFFFFFFF, 0xFFFFF1F1, 0xFFFFFFFF,
+  0xFFFDF1F1, 0xFFFFFFFF, 0xF9FDF1F1, 0xFFFFFFFF, 0xF0F4E0E0, 0xFFFFFFFF,
+  0xE0E4C0C0, 0xFFFFFFFF, 0xC0C4C0C0, 0xFFFFFFFF, 0xE3E4E0E0, 0xFFFFFFFF,
+  0xE7E4E0E0, 0xFFFFFFFF, 0xEEE4E0E0, 0xFFFFFFFF, 0xFCE4E0E0, 0xFFFFFFFF,
+  0xF8C4C0E0, 0xFFFFFFFF, 0xF0C4C0E0, 0xFFFFFFFF, 0xE0C4C0C0, 0xFFFFFFFF,
+  0xC0C4C0C0, 0xFFFFFFFF, 0xC0C4C0C0, 0xFFFFFFFF, 0xC0C4C0C0, 0xFFFFFFFF,
+  0xC0C4C0C0, 0xFFFFFFFF, 0xC0C4C0C0, 0xFFFFFFFF, 0xC0C8C3C3, 0xFFFFFFFF,
+  0xE1E9E7E7, 0xFFFFFFFF, 0xE3EBEFFF, 0xFFFFFFFF, 0xE3EBFFFF, 0xFFFFFFFF,
+  0xE3EBFBFF, 0xFFFFFFFF, 0xC3CBF3F3, 0xFFFFFFFF, 0x8189E1E1, 0xFFFFFFFF,
+  0x8088C0C0, 0xFFFFFFFF, 0xC1CBC3C3, 0xFFFFFFFF, 0xE3EFE7E7, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xE3FBF3F3, 0xFFFFFFFF, 0xC1E9E1E1, 0xFFFFFFFF, 0x80C8C0C0, 0xFFFFFFFF,
+  0xC3CBC3C1, 0xFFFFFFFF, 0xE7EFE7E3, 0xFFFFFFFF, 0xFFFFFFF5, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFD7, 0xFFFFFFFF, 0xF3FBF3E3, 0xFFFFFFFF,
+  0xE1E9E1C1, 0xFFFFFFFF, 0xC0C8C080, 0xFFFFFFFF, 0xC3CBC1C1, 0xFFFFFFFF,
+  0xE7EFE3E3, 0xFFFFFFFF, 0xFFEFE3E3, 0xFFFFFFFF, 0xFFFFE3E3, 0xFFFFFFFF,
+  0xFFFBE3E3, 0xFFFFFFFF, 0xF3FBE3E3, 0xFFFFFFFF, 0xE1E9C1C1, 0xFFFFFFFF,
+  0xC0C88080, 0xFFFFFFFF, 0xC3C8C0C1, 0xFFFFFFFF, 0xC7C8C0C1, 0xFFFFFFFF,
+  0xCFC9C1C1, 0xFFFFFFFF, 0xDDC9C1C1, 0xFFFFFFFF, 0xF9C9C1C1, 0xFFFFFFFF,
+  0xF18981C1, 0xFFFFFFFF, 0xE18981C1, 0xFFFFFFFF, 0xC0888080, 0xFFFFFFFF,
+  0x80888080, 0xFFFFFFFF, 0x80888080, 0xFFFFFFFF, 0x80888080, 0xFFFFFFFF,
+  0x80888080, 0xFFFFFFFF, 0xF1F0F3F3, 0xFFFFFFF8, 0xF9F8FFFF, 0xFFFFFFF8,
+  0xF1F0FEFE, 0xFFFFFFF8, 0xE1E0FCFC, 0xFFFFFFF0, 0xE1E0F8F8, 0xFFFFFFE0,
+  0xE1E0F0F0, 0xFFFFFFE0, 0xE1E0E0E0, 0xFFFFFFE0, 0xE1E0E0E0, 0xFFFFFFE0,
+  0xF1F3F3F3, 0xFFFFFFFC, 0xFDFFFFFF, 0xFFFFFFFC, 0xF9FEFEFE, 0xFFFFFFF8,
+  0xF1FCFCFC, 0xFFFFFFF0, 0xE1F8F8F8, 0xFFFFFFE0, 0xE1F0F0F0, 0xFFFFFFE0,
+  0xE1E0E0E0, 0xFFFFFFE0, 0xE1E0E0E0, 0xFFFFFFE0, 0xF3F3F3F0, 0xFFFFFFFF,
+  0xFFFFF7F0, 0xFFFFFFFF, 0xFFFEFEF0, 0xFFFFFFFC, 0xFDFCFCE0, 0xFFFFFFF8,
+  0xF9F8F8E0, 0xFFFFFFF0, 0xF1F0F0E0, 0xFFFFFFE0, 0xE1E0E0E0, 0xFFFFFFE0,
+  0xE1E0E0E0, 0xFFFFFFE0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFE7E0E0, 0xFFFFFFFF,
+  0xFFEEE0E0, 0xFFFFFFFE, 0xFDFCE0E0, 0xFFFFFFFC, 0xF9F8E0E0, 0xFFFFFFF8,
+  0xF1F0E0E0, 0xFFFFFFF0, 0xE1E0E0E0, 0xFFFFFFE0, 0xE1E0E0E0, 0xFFFFFFE0,
+  0xE3E0E0E0, 0xFFFFFFF3, 0xE7E0E0E0, 0xFFFFFFFF, 0xEFE0E0E0, 0xFFFFFFFE,
+  0xFDE0E0E0, 0xFFFFFFFC, 0xF9E0E0E0, 0xFFFFFFF8, 0xF1E0E0E0, 0xFFFFFFF0,
+  0xE1E0E0E0, 0xFFFFFFE0, 0xE1E0E0E0, 0xFFFFFFE0, 0xE1E0E0E0, 0xFFFFFFE3,
+  0xE1E0E0E0, 0xFFFFFFE7, 0xE1E0E0E0, 0xFFFFFFEE, 0xE1E0E0E0, 0xFFFFFFFC,
+  0xE1E0E0E0, 0xFFFFFFF8, 0xE1E0E0E0, 0xFFFFFFF0, 0xE1E0E0E0, 0xFFFFFFE0,
+  0xE1E0E0E0, 0xFFFFFFE0, 0xE1E0E0E0, 0xFFFFFFE0, 0xE1E0E0E0, 0xFFFFFFE0,
+  0xE1E0E0E0, 0xFFFFFFE0, 0xE1E0E0E0, 0xFFFFFFE0, 0xF2F0FBFF, 0xFFFFFFF0,
+  0xF2F0FFFF, 0xFFFFFFF0, 0xF2F0FEFF, 0xFFFFFFF0, 0xE2E0FCFC, 0xFFFFFFF0,
+  0xC2C0F8F8, 0xFFFFFFE0, 0xC2C0F0F0, 0xFFFFFFC0, 0xC2C0E0E0, 0xFFFFFFC0,
+  0xC2C0C0C0, 0xFFFFFFC0, 0xFAFBFFFF, 0xFFFFFFF8, 0xFAFFFFFF, 0xFFFFFFF8,
+  0xFAFEFFFF, 0xFFFFFFF8, 0xF2FCFCFC, 0xFFFFFFF0, 0xE2F8F8F8, 0xFFFFFFE0,
+  0xC2F0F0F0, 0xFFFFFFC0, 0xC2E0E0E0, 0xFFFFFFC0, 0xC2C0C0C0, 0xFFFFFFC0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFEFCFCF8, 0xFFFFFFF8, 0xFAF8F8F0, 0xFFFFFFF0, 0xF2F0F0E0, 0xFFFFFFE0,
+  0xE2E0E0C0, 0xFFFFFFC0, 0xC2C0C0C0, 0xFFFFFFC0, 0xFFFBF8F8, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFEF0F0, 0xFFFFFFFF, 0xFEFCF0F0, 0xFFFFFFFC,
+  0xFAF8E0E0, 0xFFFFFFF8, 0xF2F0C0C0, 0xFFFFFFF0, 0xE2E0C0C0, 0xFFFFFFE0,
+  0xC2C0C0C0, 0xFFFFFFC0, 0xFBF0F0F0, 0xFFFFFFFF, 0xFFF0F0F0, 0xFFFFFFFF,
+  0xEEE0E0E0, 0xFFFFFFFF, 0xFEE0E0E0, 0xFFFFFFFC, 0xFAC0C0E0, 0xFFFFFFF8,
+  0xF2C0C0C0, 0xFFFFFFF0, 0xE2C0C0C0, 0xFFFFFFE0, 0xC2C0C0C0, 0xFFFFFFC0,
+  0xE2E0E0E0, 0xFFFFFFF3, 0xE2E0E0E0, 0xFFFFFFF7, 0xE2E0E0E0, 0xFFFFFFFE,
+  0xC2C0C0C0, 0xFFFFFFDC, 0xC0C0C0C0, 0xFFC7C7C0, 0xC0C0C0C0, 0xFF8F8F80,
+  0xC0C0C0C0, 0xFF1F1F00, 0xC0C0C0C0, 0xFF3F3F00, 0xC0C0C0C0, 0xFCFCFCC0,
+  0xC0C0C0C0, 0xF8F8F8C0, 0xC0C0C0C0, 0xF1F1F1C0, 0xC0C0C0C0, 0xE3E3E3C0,
+  0xC0C0C0C0, 0xC7C7C7C0, 0xC0C0C0C0, 0x8F8F8FC0, 0xC0C0C0C0, 0x1F1F1FC0,
+  0xC0C0C0C0, 0x3F3F3FC0, 0xC0C0C0C0, 0xFCFCFFC0, 0xC0C0C0C0, 0xF8F8FFC0,
+  0xC0C0C0C0, 0xF1F1FFC0, 0xC0C0C0C0, 0xE3E3FFC0, 0xC0C0C0C0, 0xC7C7FFC0,
+  0xC0C0C0C0, 0x8F8FFFC0, 0xC0C0C0C0, 0x1F1FFFC0, 0xC0C0C0C0, 0x3F3FFFC0,
+  0xE4E0F3F3, 0xFFFFFFE0, 0xE4E0F7FF, 0xFFFFFFE0, 0xE4E0FFFF, 0xFFFFFFE0,
+  0xE4E0FDFF, 0xFFFFFFE0, 0xC4C0F9F9, 0xFFFFFFE0, 0x8480F0F0, 0xFFFFFFC0,
+  0x8480E0E0, 0xFFFFFF80, 0x8480C0C0, 0xFFFFFF80, 0xF4F3F3F3, 0xFFFFFFF0,
+  0xF5F7FFFF, 0xFFFFFFF1, 0xF5FFFFFF, 0xFFFFFFF1, 0xF5FDFFFF, 0xFFFFFFF1,
+  0xE5F9F9F9, 0xFFFFFFE1, 0xC4F0F0F0, 0xFFFFFFC0, 0x84E0E0E0, 0xFFFFFF80,
+  0x84C0C0C0, 0xFFFFFF80, 0xF7F3F3F1, 0xFFFFFFF1, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFDF9F9F1, 0xFFFFFFF1,
+  0xF4F0F0E0, 0xFFFFFFE0, 0xE4E0E0C0, 0xFFFFFFC0, 0xC4C0C080, 0xFFFFFF80,
+  0xF7F3F0F0, 0xFFFFFFF3, 0xFFF7F0F0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFDE1E1, 0xFFFFFFFF, 0xFDF9E1E1, 0xFFFFFFF9, 0xF4F0C0C0, 0xFFFFFFF0,
+  0xE4E08080, 0xFFFFFFE0, 0xC4C08080, 0xFFFFFFC0, 0xF7E0E0E0, 0xFFFFFFF3,
+  0xF7E0E0E0, 0xFFFFFFFF, 0xFFE0E0E0, 0xFFFFFFFF, 0xDDC0C0C0, 0xFFFFFFFF,
+  0xC1C0C0C0, 0xFFFFC7C1, 0x808080C0, 0xFFFF8F80, 0x00808080, 0xFFFF1F00,
+  0x00808080, 0xFFFF3F00, 0xC4C0C0C0, 0xFFFFFFE3, 0xC4C0C0C0, 0xFFFFFFE7,
+  0xC4C0C0C0, 0xFFFFFFEE, 0xC4C0C0C0, 0xFFFFFFFC, 0x80808080, 0xFFC7C780,
+  0x80808080, 0xFF8F8F80, 0x80808080, 0xFF1F1F00, 0x80808080, 0xFF3F3F00,
+  0x80808080, 0xFCFCFC80, 0x80808080, 0xF8F8F880, 0x80808080, 0xF1F1F180,
+  0x80808080, 0xE3E3E380, 0x80808080, 0xC7C7C780, 0x80808080, 0x8F8F8F80,
+  0x80808080, 0x1F1F1F80, 0x80808080, 0x3F3F3F80, 0x80808080, 0xFCFCFF80,
+  0x80808080, 0xF8F8FF80, 0x80808080, 0xF1F1FF80, 0x80808080, 0xE3E3FF80,
+  0x80808080, 0xC7C7FF80, 0x80808080, 0x8F8FFF80, 0x80808080, 0x1F1FFF80,
+  0x80808080, 0x3F3FFF80, 0xC8C0C3C3, 0xFFFFFFC0, 0xC8C0E7E7, 0xFFFFFFC1,
+  0xC9C1EFFF, 0xFFFFFFC1, 0xC9C1FFFF, 0xFFFFFFC1, 0xC9C1FBFF, 0xFFFFFFC1,
+  0x8981F3F3, 0xFFFFFFC1, 0x0901E1E1, 0xFFFFFF81, 0x0800C0C0, 0xFFFFFF00,
+  0xC8C3C3C3, 0xFFFFFFC0, 0xE9E7E7E7, 0xFFFFFFE1, 0xEBEFFFFF, 0xFFFFFFE3,
+  0xEBFFFFFF, 0xFFFFFFE3, 0xEBFBFFFF, 0xFFFFFFE3, 0xCBF3F3F3, 0xFFFFFFC3,
+  0x89E1E1E1, 0xFFFFFF81, 0x08C0C0C0, 0xFFFFFF00, 0xCBC3C3C1, 0xFFFFFFC1,
+  0xEFE7E7E3, 0xFFFFFFE3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFBF3F3E3, 0xFFFFFFE3, 0xE9E1E1C1, 0xFFFFFFC1,
+  0xC8C0C080, 0xFFFFFF80, 0xCBC3C0C0, 0xFFFFFFC3, 0xEFE7E1E1, 0xFFFFFFE7,
+  0xFFEFE1E1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFBC3C3, 0xFFFFFFFF,
+  0xFBF3C3C3, 0xFFFFFFF3, 0xE9E18181, 0xFFFFFFE1, 0xC8C00000, 0xFFFFFFC0,
+  0xCBC0C0C0, 0xFFFFFFC3, 0xEFC0C0C0, 0xFFFFFFE7, 0xEEC0C0C0, 0xFFFFFFFF,
+  0xFFC1C1C1, 0xFFFFFFFF, 0xBB818181, 0xFFFFFFFF, 0xFB818181, 0xFFFFFFF3,
+  0xE9010181, 0xFFFFFFE1, 0xC8000000, 0xFFFFFFC0, 0x80808080, 0xFFFCFCC0,
+  0x80808080, 0xFFF8F8C0, 0x80808080, 0xFFF1F1C1, 0x80808080, 0xFFE3E3C1,
+  0x80808080, 0xFFC7C7C1, 0x00000000, 0xFF8F8F01, 0x00000000, 0xFF1F1F01,
+  0x00000000, 0xFF3F3F00, 0x00000000, 0xFCFCFC00, 0x00000000, 0xF8F8F800,
+  0x00000000, 0xF1F1F100, 0x00000000, 0xE3E3E300, 0x00000000, 0xC7C7C700,
+  0x00000000, 0x8F8F8F00, 0x00000000, 0x1F1F1F00, 0x00000000, 0x3F3F3F00,
+  0x00000000, 0xFCFCFF00, 0x00000000, 0xF8F8FF00, 0x00000000, 0xF1F1FF00,
+  0x00000000, 0xE3E3FF00, 0x00000000, 0xC7C7FF00, 0x00000000, 0x8F8FFF00,
+  0x00000000, 0x1F1FFF00, 0x00000000, 0x3F3FFF00, 0xF0F0F3F3, 0xFFFFF0F1,
+  0xF0F0F7FF, 0xFFFFF0F1, 0xF0F0FEFE, 0xFFFFF0F1, 0xE0E0FCFC, 0xFFFFE0E1,
+  0xC0C0C0C0, 0xFFFFC0C0, 0xC0C08080, 0xFFFFC0C0, 0xC0C00000, 0xFFFFC0C0,
+  0xC0C00000, 0xFFFFC0C0, 0xF0F3F3F3, 0xFFFFF8F1, 0xF8FFFFFF, 0xFFFFF8F9,
+  0xF0FEFEFE, 0xFFFFF8F1, 0xE0FCFCFC, 0xFFFFF0E1, 0xC0C0C0C0, 0xFFFFE0C0,
+  0xC0808080, 0xFFFFC0C0, 0xC0000000, 0xFFFFC0C0, 0xC0000000, 0xFFFFC0C0,
+  0xF3F3F3F0, 0xFFFFFCF1, 0xFFFFF7F0, 0xFFFFFCFD, 0xFEFEFEF0, 0xFFFFF8F9,
+  0xFCFCFCE0, 0xFFFFF0F1, 0xC0C0C0C0, 0xFFFFE0E0, 0x808080C0, 0xFFFFC0C0,
+  0x000000C0, 0xFFFFC0C0, 0x000000C0, 0xFFFFC0C0, 0xF3E3E0E0, 0xFFFFFFF3,
+  0xFFE7E0E0, 0xFFFFFFFF, 0xFEEEE0E0, 0xFFFFFCFF, 0xFCFCE0E0, 0xFFFFF8FD,
+  0xC0C0C0C0, 0xFFFFF0C0, 0x8080C0C0, 0xFFFFE080, 0x0000C0C0, 0xFFFFC000,
+  0x0000C0C0, 0xFFFFC000, 0xFFFFFFFF, 0xFFFFFFFF, 0xC7C0C0C0, 0xFFFFFFFF,
+  0xCEC0C0C0, 0xFFFFFEFF, 0xDCC0C0C0, 0xFFFFFCFD, 0xC0C0C0C0, 0xFFFFC0C0,
+  0x80C0C0C0, 0xFFFF8080, 0x00C0C0C0, 0xFFFF0000, 0x00C0C0C0, 0xFFFF0000,
+  0xC0C0C0C0, 0xFFFCF0C0, 0xC0C0C0C0, 0xFFF8F8C0, 0xC0C0C0C0, 0xFFF1F0C0,
+  0xC0C0C0C0, 0xFFE3E0C0, 0xC0C0C0C0, 0xFFC7C0C0, 0xC0C0C0C0, 0xFF8F8080,
+  0xC0C0C0C0, 0xFF1F0000, 0xC0C0C0C0, 0xFF3F0000, 0xC0C0C0C0, 0xFCFCC0C0,
+  0xC0C0C0C0, 0xF8F8C0C0, 0xC0C0C0C0, 0xF1F1C0C0, 0xC0C0C0C0, 0xE3E3C0C0,
+  0xC0C0C0C0, 0xC7C7C0C0, 0xC0C0C0C0, 0x8F8F80C0, 0xC0C0C0C0, 0x1F1F00C0,
+  0xC0C0C0C0, 0x3F3F00C0, 0xC0C0C0C0, 0xC7C7C0C0, 0xC0C0C0C0, 0x8F8FC0C0,
+  0xC0C0C0C0, 0x1F1FC0C0, 0xC0C0C0C0, 0x3F3FC0C0, 0xE0E0F3FF, 0xFFFFE0E2,
+  0xE0E0F7FF, 0xFFFFE0E2, 0xE0E0FEFF, 0xFFFFE0E2, 0xE0E0FCFC, 0xFFFFE0E2,
+  0xC0C0C0C0, 0xFFFFC0C0, 0x80808080, 0xFFFF8080, 0x80800000, 0xFFFF8080,
+  0x80800000, 0xFFFF8080, 0xF0FBFFFF, 0xFFFFF0F2, 0xF0FFFFFF, 0xFFFFF0F2,
+  0xF0FEFFFF, 0xFFFFF0F2, 0xE0FCFCFC, 0xFFFFF0E2, 0xC0C0C0C0, 0xFFFFE0C0,
+  0x80808080, 0xFFFFC080, 0x80000000, 0xFFFF8080, 0x80000000, 0xFFFF8080,
+  0xFBFFFFFF, 0xFFFFF8FA, 0xFFFFFFFF, 0xFFFFF8FA, 0xFEFFFFFF, 0xFFFFF8FA,
+  0xFCFCFCF8, 0xFFFFF0F2, 0xC0C0C0F0, 0xFFFFE0E0, 0x808080E0, 0xFFFFC0C0,
+  0x000000C0, 0xFFFF8080, 0x00000080, 0xFFFF8080, 0xFFFFFDFC, 0xFFFFFFFF,
+  0xFFFFFAF8, 0xFFFFFFFF, 0xFFFFF5F1, 0xFFFFFFFF, 0xFCFCE8E0, 0xFFFFF8FE,
+  0xC0C0D0C0, 0xFFFFF0C0, 0x8080A080, 0xFFFFE080, 0x0000C0C0, 0xFFFFC000,
+  0x00008080, 0xFFFF8000, 0xFBF8F8F8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFEF0F0F0, 0xFFFFFFFF, 0xFCE0E0E0, 0xFFFFFCFE, 0xC0C0C0C0, 0xFFFFC0C0,
+  0x80808080, 0xFFFF8080, 0x00808080, 0xFFFF0000, 0x00808080, 0xFFFF0000,
+  0xF0F0F0F0, 0xFFFFFFFB, 0xF0F0F0F0, 0xFFFFFFFF, 0xE0E0E0E0, 0xFFFFFFEE,
+  0xE0E0E0E0, 0xFFFFFCFE, 0xC0C0C0C0, 0xFFC7C0C0, 0x80808080, 0xFF8F8080,
+  0x80808080, 0xFF1F0000, 0x80808080, 0xFF3F0000, 0xE0E0E0E0, 0xFFFFF3E2,
+  0xE0E0E0E0, 0xFFFFF7E2, 0xE0E0E0E0, 0xFFFFFEE2, 0xC0C0C0C0, 0xFFFFDCC2,
+  0xC0C0C0C0, 0xC7C7C0C0, 0x80808080, 0x8F8F8080, 0x80808080, 0x1F1F0080,
+  0x80808080, 0x3F3F0080, 0x80808080, 0xC7C78080, 0x80808080, 0x8F8F8080,
+  0x80808080, 0x1F1F8080, 0x80808080, 0x3F3F8080, 0xC0C0E3F3, 0xFFFFC0C4,
+  0xC0C0E7FF, 0xFFFFC0C4, 0xC0C0EEFF, 0xFFFFC0C4, 0xC0C0FCFF, 0xFFFFC0C4,
+  0xC0C0C0C1, 0xFFFFC0C0, 0x80808080, 0xFFFF8080, 0x00000000, 0xFFFF0000,
+  0x00000000, 0xFFFF0000, 0xE0F3F3F3, 0xFFFFE0E4, 0xE0F7FFFF, 0xFFFFE0E4,
+  0xE0FFFFFF, 0xFFFFE0E4, 0xE0FDFFFF, 0xFFFFE0E4, 0xC0C1C1C1, 0xFFFFE0C0,
+  0x80808080, 0xFFFFC080, 0x00000000, 0xFFFF8000, 0x00000000, 0xFFFF0000,
+  0xF3F3F3F1, 0xFFFFF0F4, 0xF7FFFFFF, 0xFFFFF1F5, 0xFFFFFFFF, 0xFFFFF1F5,
+  0xFDFFFFFF, 0xFFFFF1F5, 0xC1C1C1F1, 0xFFFFE1E1, 0x808080E0, 0xFFFFC0C0,
+  0x000000C0, 0xFFFF8080, 0x00000080, 0xFFFF0000, 0xF3F3F1F0, 0xFFFFF1F7,
+  0xFFFFFAF8, 0xFFFFFFFF, 0xFFFFF5F1, 0xFFFFFFFF, 0xFFFFEBE3, 0xFFFFFFFF,
+  0xC1C1D1C1, 0xFFFFF1C1, 0x8080A080, 0xFFFFE080, 0x00004000, 0xFFFFC000,
+  0x00008080, 0xFFFF8000, 0xF3F0F0F0, 0xFFFFF3F7, 0xF7F0F0F0, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFDE1E1E1, 0xFFFFFFFF, 0xC1C1C1C1, 0xFFFFC1C1,
+  0x80808080, 0xFFFF8080, 0x00000000, 0xFFFF0000, 0x00000000, 0xFFFF0000,
+  0xE0E0E0E0, 0xFFFFF3F7, 0xE0E0E0E0, 0xFFFFFFF7, 0xE0E0E0E0, 0xFFFFFFFF,
+  0xC0C0C0C0, 0xFFFFFFDD, 0xC0C0C0C0, 0xFFC7C1C1, 0x80808080, 0xFF8F8080,
+  0x00000000, 0xFF1F0000, 0x00000000, 0xFF3F0000, 0xC0C0C0C0, 0xFCFCE0C0,
+  0xC0C0C0C0, 0xF8F8E0C0, 0xC0C0C0C0, 0xF1F1E0C0, 0xC0C0C0C0, 0xE3E3E0C0,
+  0x80808080, 0xC7C78080, 0x80808080, 0x8F8F8080, 0x00000000, 0x1F1F0000,
+  0x00000000, 0x3F3F0000, 0x80808080, 0xFCFC8080, 0x80808080, 0xF8F88080,
+  0x80808080, 0xF1F18080, 0x80808080, 0xE3E38080, 0x80808080, 0xC7C78080,
+  0x00000000, 0x8F8F0000, 0x00000000, 0x1F1F0000, 0x00000000, 0x3F3F0000,
+  0x8080C0C0, 0xFFFF8080, 0x8080C0E0, 0xFFFF8080, 0x8080C1F1, 0xFFFF8080,
+  0x8080C1E3, 0xFFFF8080, 0x8080C1C7, 0xFFFF8080, 0x80808183, 0xFFFF8080,
+  0x00000101, 0xFFFF0000, 0x00000000, 0xFFFF0000, 0xC0C3C3C3, 0xFFFFC0C8,
+  0xC0E7E7E7, 0xFFFFC1C8, 0xC1EFFFFF, 0xFFFFC1C9, 0xC1FFFFFF, 0xFFFFC1C9,
+  0xC1FBFFFF, 0xFFFFC1C9, 0x81F3F3F3, 0xFFFFC189, 0x01E1E1E1, 0xFFFF8109,
+  0x00C0C0C0, 0xFFFF0008, 0xC3C3C3C1, 0xFFFFC0C8, 0xE7E7E7E3, 0xFFFFE1E9,
+  0xEFFFFFFF, 0xFFFFE3EB, 0xFFFFFFFF, 0xFFFFE3EB, 0xFBFFFFFF, 0xFFFFE3EB,
+  0xF3F3F3E3, 0xFFFFC3CB, 0xE1E1E1C1, 0xFFFF8189, 0xC0C0C080, 0xFFFF0008,
+  0xC3C3C1C0, 0xFFFFC1CB, 0xE7E7E2E0, 0xFFFFE3EF, 0xFFFFF5F1, 0xFFFFFFFF,
+  0xFFFFEBE3, 0xFFFFFFFF, 0xFFFFD7C7, 0xFFFFFFFF, 0xF3F3A383, 0xFFFFE3FB,
+  0xE1E14101, 0xFFFFC1E9, 0xC0C08000, 0xFFFF80C8, 0xC3C0C0C0, 0xFFFFC3CB,
+  0xE7E0E0E0, 0xFFFFE7EF, 0xEFE1E1E1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFBC3C3C3, 0xFFFFFFFF, 0xF3838383, 0xFFFFF3FB, 0xE1010101, 0xFFFFE1E9,
+  0xC0000000, 0xFFFFC0C8, 0xC0C0C0C0, 0xFFFFC3CB, 0xC0C0C0C0, 0xFFFFE7EF,
+  0xC0C0C0C0, 0xFFFFFFEE, 0xC1C1C1C1, 0xFFFFFFFF, 0x81818181, 0xFFC7C783,
+  0x81818181, 0xFF8F8383, 0x01010101, 0xFF1F0101, 0x00000000, 0xFF3F0000,
+  0x80808080, 0xFCFCC080, 0x80808080, 0xF8F8C080, 0x80808080, 0xF1F1C180,
+  0x80808080, 0xE3E3C180, 0x80808080, 0xC7C7C180, 0x00000000, 0x8F8F0100,
+  0x00000000, 0x1F1F0100, 0x00000000, 0x3F3F0000, 0x00000000, 0xFCFC0000,
+  0x00000000, 0xF8F80000, 0x00000000, 0xF1F10000, 0x00000000, 0xE3E30000,
+  0x00000000, 0xC7C70000, 0x00000000, 0x8F8F0000, 0x00000000, 0x1F1F0000,
+  0x00000000, 0x3F3F0000, 0xE0E0E3F3, 0xFFE0E1E0, 0xE0E0E7FF, 0xFFE0E1E0,
+  0xE0E0EEFE, 0xFFE0E1E0, 0xE0E0FCFC, 0xFFE0E1E0, 0xC0C0C0C0, 0xFFC0C0C0,
+  0x80808080, 0xFF808080, 0x80800000, 0xFF808080, 0x80800000, 0xFF808080,
+  0xF0F3F3F3, 0xFFF0F1F0, 0xF0F7FFFF, 0xFFF0F1F0, 0xF0FEFEFE, 0xFFF0F1F0,
+  0xE0FCFCFC, 0xFFE0E1E0, 0xC0C0C0C0, 0xFFC0C0C0, 0x80808080, 0xFF808080,
+  0x80000000, 0xFF808080, 0x80000000, 0xFF808080, 0xF3F3F3F0, 0xFFF8F1F0,
+  0xFFFFF7F0, 0xFFF8F9F8, 0xFEFEFEF0, 0xFFF8F1F0, 0xFCFCFCE0, 0xFFF0E1E0,
+  0xC0C0C0C0, 0xFFE0C0C0, 0x80808080, 0xFFC08080, 0x00000080, 0xFF808080,
+  0x00000080, 0xFF808080, 0xF3E3E0E0, 0xFFFCF1F3, 0xFFE7E0E0, 0xFFFCFDFF,
+  0xFEEEE0E0, 0xFFF8F9FE, 0xFCFCE0E0, 0xFFF0F1FC, 0xC0C0C0C0, 0xFFE0E0C0,
+  0x80808080, 0xFFC0C080, 0x00008080, 0xFF808000, 0x00008080, 0xFF808000,
+  0xC3C0C0C0, 0xFFFFF3F3, 0xC7C0C0C0, 0xFFFFFFFF, 0xCEC0C0C0, 0xFFFCFFFE,
+  0xDCC0C0C0, 0xFFF8FDFC, 0xC0C0C0C0, 0xFFF0C0C0, 0x80808080, 0xFFE08080,
+  0x00808080, 0xFFC00000, 0x00808080, 0xFF800000, 0x00000000, 0x00000000,
+  0x80808080, 0xFFF8F880, 0x80808080, 0xFFF0F080, 0x80808080, 0xFFE0E080,
+  0x80808080, 0xFFC0C080, 0x80808080, 0xFF808080, 0x80808080, 0xFF000000,
+  0x80808080, 0xFF000000, 0x80808080, 0xFCF08080, 0x80808080, 0xF8F88080,
+  0x80808080, 0xF1F08080, 0x80808080, 0xE3E08080, 0x80808080, 0xC7C08080,
+  0x80808080, 0x8F808080, 0x80808080, 0x1F000080, 0x80808080, 0x3F000080,
+  0x80808080, 0xFC808080, 0x80808080, 0xF8808080, 0x80808080, 0xF1808080,
+  0x80808080, 0xE3808080, 0x80808080, 0xC7808080, 0x80808080, 0x8F808080,
+  0x80808080, 0x1F008080, 0x80808080, 0x3F008080, 0xC0C0E0FC, 0xFFC0C0C0,
+  0xC0C0E0F8, 0xFFC0C0C0, 0xC0C0E0F1, 0xFFC0C0C0, 0xC0C0E0E0, 0xFFC0C0C0,
+  0xC0C0C0C0, 0xFFC0C0C0, 0x80808080, 0xFF808080, 0x00000000, 0xFF000000,
+  0x00000000, 0xFF000000, 0xE0F3FFFF, 0xFFE0E2E0, 0xE0F7FFFF, 0xFFE0E2E0,
+  0xE0FEFFFF, 0xFFE0E2E0, 0xE0FCFCFC, 0xFFE0E2E0, 0xFBFFFFFF, 0xFFF0F2F0,
+  0xFFFFFFFF, 0xFFF0F2F0, 0xFEFFFFFF, 0xFFF0F2F0, 0xFCFCFCFF, 0xFFF0E2E0,
+  0xC0C0C0F0, 0xFFE0C0C0, 0x808080E0, 0xFFC08080, 0x000000C0, 0xFF800000,
+  0x00000080, 0xFF000000, 0xFFFFFFFF, 0xFFF8FAFB, 0xFFFFFFFF, 0xFFF8FAFF,
+  0xFFFFFFFF, 0xFFF8FAFE, 0xFCFCF8FF, 0xFFF0F2FC, 0xC0C0F0F0, 0xFFE0E0C0,
+  0x8080E0E0, 0xFFC0C080, 0x0000C0C0, 0xFF808000, 0x00008080, 0xFF000000,
+  0xFFFDFCFF, 0xFFFFFFFF, 0xFFFAF8FF, 0xFFFFFFFF, 0xFFF5F1FF, 0xFFFFFFFF,
+  0xFCE8E0FF, 0xFFF8FEFC, 0xC0D0C0F0, 0xFFF0C0C0, 0x80A080E0, 0xFFE08080,
+  0x004000C0, 0xFFC00000, 0x00808080, 0xFF800000, 0xF8F8F8F8, 0xFFFFFFFB,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF0F0F0F0, 0xFFFFFFFE, 0xE0E0E0E0, 0xFFFCFEFC,
+  0xF0F0F0F0, 0xFFFFFBF0, 0xF0F0F0F0, 0xFFFFFFF0, 0xE0E0E0E0, 0xFFFFEEE0,
+  0xE0E0E0E0, 0xFFFCFEE0, 0xC0C0C0C0, 0xC7C0C0C0, 0x80808080, 0x8F808080,
+  0x00000000, 0x1F000000, 0x00000000, 0x3F000000, 0xE0E0E0E0, 0xFCF0E0E0,
+  0xE0E0E0E0, 0xF8F0E0E0, 0xE0E0E0E0, 0xF1F0E0E0, 0xC0C0C0C0, 0xE3C0C0C0,
+  0x8080C0F0, 0xFF808080, 0x8080C0F8, 0xFF808080, 0x8080C0F1, 0xFF808080,
+  0x8080C0E3, 0xFF808080, 0x8080C0C1, 0xFF808080, 0x80808080, 0xFF808080,
+  0x00000000, 0xFF000000, 0x00000000, 0xFF000000, 0xC0E3F3F3, 0xFFC0C4C0,
+  0xC0E7FFFF, 0xFFC0C4C0, 0xC0EEFFFF, 0xFFC0C4C0, 0xC0FCFFFF, 0xFFC0C4C0,
+  0xC0C0C1C1, 0xFFC0C0C0, 0x80808080, 0xFF808080, 0x00000000, 0xFF000000,
+  0x00000000, 0xFF000000, 0xF3F3F3FF, 0xFFE0E4E0, 0xF7FFFFFF, 0xFFE0E4E0,
+  0xFFFFFFFF, 0xFFE0E4E0, 0xFDFFFFFF, 0xFFE0E4E0, 0xC1C1C1FF, 0xFFE0C0C0,
+  0x808080E0, 0xFFC08080, 0x000000C0, 0xFF800000, 0x00000080, 0xFF000000,
+  0xF3F3F1FF, 0xFFF0F4F3, 0xFFFFFFFF, 0xFFF1F5F7, 0xFFFFFFFF, 0xFFF1F5FF,
+  0xFFFFFFFF, 0xFFF1F5FD, 0xC1C1F1FF, 0xFFE1E1C1, 0x8080E0E0, 0xFFC0C080,
+  0x0000C0C0, 0xFF808000, 0x00008080, 0xFF000000, 0xF3F1F0FF, 0xFFF1F7F3,
+  0xFFFAF8FF, 0xFFFFFFFF, 0xFFF5F1FF, 0xFFFFFFFF, 0xFFEBE3FF, 0xFFFFFFFF,
+  0xC1D1C1FF, 0xFFF1C1C1, 0x80A080E0, 0xFFE08080, 0x004000C0, 0xFFC00000,
+  0x00800080, 0xFF800000, 0xF0F0F0F0, 0xFFF3F7F3, 0xF0F0F0F0, 0xFFFFFFF7,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xE1E1E1E1, 0xFFFFFFFD, 0xC1C1C1C1, 0xFFC1C1C1,
+  0x80808080, 0xFF808080, 0x00000000, 0xFF000000, 0x00000000, 0xFF000000,
+  0xE0E0E0E0, 0xFCF0F0E0, 0xE0E0E0E0, 0xF8F8F0E0, 0xE0E0E0E0, 0xF1F1F1E0,
+  0xC0C0C0C0, 0xE3E3C1C0, 0xC0C0C0C0, 0xC7C1C1C0, 0x80808080, 0x8F808080,
+  0x00000000, 0x1F000000, 0x00000000, 0x3F000000, 0xC0C0C0C0, 0xFCE0C0C0,
+  0xC0C0C0C0, 0xF8E0C0C0, 0xC0C0C0C0, 0xF1E0C0C0, 0xC0C0C0C0, 0xE3E0C0C0,
+  0x80808080, 0xC7808080, 0x80808080, 0x8F808080, 0x00000000, 0x1F000000,
+  0x00000000, 0x3F000000, 0x000080C0, 0xFF000000, 0x000080E0, 0xFF000000,
+  0x000080F1, 0xFF000000, 0x000080E3, 0xFF000000, 0x000080C7, 0xFF000000,
+  0x00008083, 0xFF000000, 0x00000001, 0xFF000000, 0x00000000, 0xFF000000,
+  0x80C0C0C0, 0xFF808080, 0x80C0E0E0, 0xFF808080, 0x80C1F1F1, 0xFF808080,
+  0x80C1E3E3, 0xFF808080, 0x80C1C7C7, 0xFF808080, 0x80818383, 0xFF808080,
+  0x00010101, 0xFF000000, 0x00000000, 0xFF000000, 0xC3C3C3C1, 0xFFC0C8C0,
+  0xE7E7E7FF, 0xFFC1C8C0, 0xEFFFFFFF, 0xFFC1C9C1, 0xFFFFFFFF, 0xFFC1C9C1,
+  0xC3C7C7FF, 0xFFC1C1C1, 0x838383FF, 0xFFC18181, 0x010101C1, 0xFF810101,
+  0x00000080, 0xFF000000, 0xC3C3C1C1, 0xFFC0C8C3, 0xE7E7E3FF, 0xFFE1E9E7,
+  0xFFFFFFFF, 0xFFE3EBEF, 0xFFFFFFFF, 0xFFE3EBFF, 0xFFFFFFFF, 0xFFE3EBFB,
+  0xF3F3E3FF, 0xFFC3CBF3, 0xE1E1C1C1, 0xFF8189E1, 0xC0C08080, 0xFF0008C0,
+  0xC3C1C0C1, 0xFFC1CBC3, 0xE7E2E0FF, 0xFFE3EFE7, 0xFFF5F1FF, 0xFFFFFFFF,
+  0xFFEBE3FF, 0xFFFFFFFF, 0xFFD7C7FF, 0xFFFFFFFF, 0xF3A383FF, 0xFFE3FBF3,
+  0xE14101C1, 0xFFC1E9E1, 0xC0800080, 0xFF80C8C0, 0xC0C0C0C0, 0xFFC3CBC3,
+  0xE0E0E0E0, 0xFFE7EFE7, 0xE1E1E1E1, 0xFFFFFFEF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xC3C3C3C3, 0xFFC7C7C3, 0x83838383, 0xFF838383, 0x01010101, 0xFF010101,
+  0x00000000, 0xFF000000, 0xC0C0C0C0, 0xFCC0C0C0, 0xC0C0C0C0, 0xF8E0E0C0,
+  0xC0C0C0C0, 0xF1F1E0C0, 0xC1C1C1C1, 0xE3E3E3C1, 0x81818181, 0xC7C78381,
+  0x81818181, 0x8F838381, 0x01010101, 0x1F010101, 0x00000000, 0x3F000000,
+  0x80808080, 0xFCC08080, 0x80808080, 0xF8C08080, 0x80808080, 0xF1C18080,
+  0x80808080, 0xE3C18080, 0x80808080, 0xC7C18080, 0x00000000, 0x8F010000,
+  0x00000000, 0x1F010000, 0x00000000, 0x3F000000, 0xE0E0E0F0, 0xFCE0E0E0,
+  0xE0E0E0F8, 0xFCE0E0E0, 0xE0E0E0F0, 0xFCE0E0E0, 0xE0E0E0E0, 0xFCE0E0E0,
+  0xC0C0C0C0, 0xFCC0C0C0, 0x80808080, 0xFC808080, 0x80800000, 0xFC808080,
+  0x80800000, 0xFC808080, 0xF0F3F3F3, 0xFCF1F0F0, 0xF0F7FFFF, 0xFCF1F0F0,
+  0xF0FEFEFE, 0xFCF1F0F0, 0xE0FCFCFC, 0xFCE1E0E0, 0xC0C0C0C0, 0xFCC0C0C0,
+  0x80808080, 0xFC808080, 0x80000000, 0xFC808080, 0x80000000, 0xFC808080,
+  0xF3F3F3F0, 0xFCFDF0F0, 0xFFFFF7F0, 0xFCFDF8F8, 0xFEFEFEF0, 0xFCFDF0F0,
+  0xFCFCFCE0, 0xFCFDE0E0, 0xC0C0C0C0, 0xFCF0C0C0, 0x80808080, 0xFCE08080,
+  0x00000080, 0xFCC08080, 0x00000080, 0xFC808080, 0xF3E3E0E0, 0xFCFDF0F3,
+  0xFFE7E0E0, 0xFCFDFCFF, 0xFEEEE0E0, 0xFCFDFCFE, 0xFCFCE0E0, 0xFCFDF8FC,
+  0xC0C0C0C0, 0xFCF0F0C0, 0x80808080, 0xFCE0E080, 0x00008080, 0xFCC0C000,
+  0x00008080, 0xFC808000, 0xC3C0C0C0, 0xFCFDF3F3, 0xC7C0C0C0, 0xFCFDFFFF,
+  0xCEC0C0C0, 0xFCFDFEFE, 0xDCC0C0C0, 0xFCFDFCFC, 0xC0C0C0C0, 0xFCF0C0C0,
+  0x80808080, 0xFCE08080, 0x00808080, 0xFCC00000, 0x00808080, 0xFC800000,
+  0x80808080, 0xFFF0F080, 0x80808080, 0xFFF8F880, 0x80808080, 0xFCF0F080,
+  0x80808080, 0xFCE0E080, 0x80808080, 0xFCC0C080, 0x80808080, 0xFC808080,
+  0x80808080, 0xFC000000, 0x80808080, 0xFC000000, 0x00000000, 0x00000000,
+  0x80808080, 0xF8F88080, 0x80808080, 0xF0F08080, 0x80808080, 0xE0E08080,
+  0x80808080, 0xC4C08080, 0x80808080, 0x8C808080, 0x80808080, 0x1C000080,
+  0x80808080, 0x3C000080, 0x80808080, 0xFC808080, 0x80808080, 0xF8808080,
+  0x80808080, 0xF0808080, 0x80808080, 0xE0808080, 0x80808080, 0xC4808080,
+  0x80808080, 0x8C808080, 0x80808080, 0x1C008080, 0x80808080, 0x3C008080,
+  0xC0C0C0FC, 0xF8C0C0C0, 0xC0C0C0F8, 0xF8C0C0C0, 0xC0C0C0F1, 0xF8C0C0C0,
+  0xC0C0C0E0, 0xF8C0C0C0, 0xC0C0C0C0, 0xF8C0C0C0, 0x80808080, 0xF8808080,
+  0x00000000, 0xF8000000, 0x00000000, 0xF8000000, 0xE0E3FFFF, 0xF8E2E0E0,
+  0xE0E7FFFF, 0xF8E2E0E0, 0xE0EEFFFF, 0xF8E2E0E0, 0xE0FCFCFC, 0xF8E2E0E0,
+  0xF3FFFFFF, 0xF8FAF0F0, 0xF7FFFFFF, 0xF8FAF0F0, 0xFEFFFFFF, 0xF8FAF0F0,
+  0xFCFCFCFF, 0xF8FAE0E0, 0xC0C0C0FF, 0xF8F8C0C0, 0x808080E0, 0xF8E08080,
+  0x000000C0, 0xF8C00000, 0x00000080, 0xF8800000, 0xFFFFFFFF, 0xF8FAF8FB,
+  0xFFFFFFFF, 0xF8FAF8FF, 0xFFFFFFFF, 0xF8FAF8FE, 0xFCFCFFFF, 0xF8FAF8FC,
+  0xC0C0F0FF, 0xF8F8F0C0, 0x8080E0E0, 0xF8E0E080, 0x0000C0C0, 0xF8C0C000,
+  0x00008080, 0xF8808000, 0xFFFFFFFF, 0xF8FAFBFF, 0xFFFFFFFF, 0xF8FAFFFF,
+  0xFFFFFFFF, 0xF8FAFEFF, 0xFCF8FFFF, 0xF8FAFCFC, 0xC0F0F0FF, 0xF8F8C0C0,
+  0x80E0E0E0, 0xF8E08080, 0x00C0C0C0, 0xF8C00000, 0x00808080, 0xF8800000,
+  0xFDFCFFFF, 0xFFFFFFFF, 0xFAF8FFFF, 0xFFFFFFFF, 0xF5F1FFFF, 0xFFFFFFFF,
+  0xE8E0FFFF, 0xF8FEFCFC, 0xD0C0F0FF, 0xF8C0C0C0, 0xA080E0E0, 0xF8808080,
+  0x4000C0C0, 0xF8000000, 0x80808080, 0xF8000000, 0xF8F8F8FF, 0xFFFFFBF8,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF0F0F0FF, 0xFFFFFEF0, 0xE0E0E0FF, 0xFCFEFCE0,
+  0xC0C0C0FF, 0xC0C0C0C0, 0x808080E0, 0x88808080, 0x000000C0, 0x18000000,
+  0x00000080, 0x38000000, 0xF0F0F0F0, 0xFFFBF0F0, 0xF0F0F0F0, 0xFFFFF0F0,
+  0xE0E0E0E0, 0xFFEEE0E0, 0xE0E0E0E0, 0xFCFEE0E0, 0xC0C0C0C0, 0xC0C0C0C0,
+  0x80808080, 0x88808080, 0x00000000, 0x18000000, 0x00000000, 0x38000000,
+  0x808080F0, 0xF1808080, 0x808080F8, 0xF1808080, 0x808080F1, 0xF1808080,
+  0x808080E3, 0xF1808080, 0x808080C1, 0xF1808080, 0x80808080, 0xF1808080,
+  0x00000000, 0xF1000000, 0x00000000, 0xF1000000, 0xC0C0F0F0, 0xF1C0C0C0,
+  0xC0C0F8F8, 0xF1C0C0C0, 0xC0C0F1F1, 0xF1C0C0C0, 0xC0C0E3E3, 0xF1C0C0C0,
+  0xC0C0C1C1, 0xF1C0C0C0, 0x80808080, 0xF1808080, 0x00000000, 0xF1000000,
+  0x00000000, 0xF1000000, 0xE3F3F3FF, 0xF1F5E0E0, 0xE7FFFFFF, 0xF1F5E0E0,
+  0xEEFFFFFF, 0xF1F5E0E0, 0xFCFFFFFF, 0xF1F5E0E0, 0xC0C1C1FF, 0xF1F1C0C0,
+  0x808080FF, 0xF1F18080, 0x000000C0, 0xF1C00000, 0x00000080, 0xF1800000,
+  0xF3F3FFFF, 0xF1F5F1F3, 0xFFFFFFFF, 0xF1F5F1F7, 0xFFFFFFFF, 0xF1F5F1FF,
+  0xFFFFFFFF, 0xF1F5F1FD, 0xC1C1FFFF, 0xF1F1F1C1, 0x8080E0FF, 0xF1F1E080,
+  0x0000C0C0, 0xF1C0C000, 0x00008080, 0xF1808000, 0xF3F1FFFF, 0xF1F5F3F3,
+  0xFFFFFFFF, 0xF1F5F7FF, 0xFFFFFFFF, 0xF1F5FFFF, 0xFFFFFFFF, 0xF1F5FDFF,
+  0xC1F1FFFF, 0xF1F1C1C1, 0x80E0E0FF, 0xF1F18080, 0x00C0C0C0, 0xF1C00000,
+  0x00808080, 0xF1800000, 0xF1F0FFFF, 0xF1F7F3F3, 0xFAF8FFFF, 0xFFFFFFFF,
+  0xF5F1FFFF, 0xFFFFFFFF, 0xEBE3FFFF, 0xFFFFFFFF, 0xD1C1FFFF, 0xF1C1C1C1,
+  0xA080E0FF, 0xF1818080, 0x4000C0C0, 0xF1000000, 0x80008080, 0xF1000000,
+  0xF0F0F0FF, 0xF3F7F3F0, 0xF0F0F0FF, 0xFFFFF7F0, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xE1E1E1FF, 0xFFFFFDE1, 0xC1C1C1FF, 0xC1C1C1C1, 0x808080FF, 0x81818080,
+  0x000000C0, 0x11000000, 0x00000080, 0x31000000, 0xE0E0E0E0, 0xF0F0E0E0,
+  0xE0E0E0E0, 0xF8F0E0E0, 0xE0E0E0E0, 0xF1F1E0E0, 0xC0C0C0C0, 0xE3C1C0C0,
+  0xC0C0C0C0, 0xC1C1C0C0, 0x80808080, 0x81818080, 0x00000000, 0x11000000,
+  0x00000000, 0x31000000, 0x000000C0, 0xE3000000, 0x000000E0, 0xE3000000,
+  0x000000F1, 0xE3000000, 0x000000E3, 0xE3000000, 0x000000C7, 0xE3000000,
+  0x00000083, 0xE3000000, 0x00000001, 0xE3000000, 0x00000000, 0xE3000000,
+  0x8080C0C0, 0xE3808080, 0x8080E0E0, 0xE3808080, 0x8080F1F1, 0xE3808080,
+  0x8080E3E3, 0xE3808080, 0x8080C7C7, 0xE3808080, 0x80808383, 0xE3808080,
+  0x00000101, 0xE3000000, 0x00000000, 0xE3000000, 0xC3C3C3FF, 0xE3EBC0C0,
+  0xC7E7E7FF, 0xE3EBC0C0, 0xCFFFFFFF, 0xE3EBC1C1, 0xDDFFFFFF, 0xE3EBC1C1,
+  0xC1C7C7FF, 0xE3E3C1C1, 0x818383FF, 0xE3E38181, 0x010101FF, 0xE3E30101,
+  0x00000080, 0xE3800000, 0xC3C3C1FF, 0xE3EBC1C3, 0xE7E7FFFF, 0xE3EBE3E7,
+  0xFFFFFFFF, 0xE3EBE3EF, 0xFFFFFFFF, 0xE3EBE3FF, 0xFFFFFFFF, 0xE3EBE3FB,
+  0xF3F3FFFF, 0xE3EBE3F3, 0xE1E1C1FF, 0xE3EBC1E1, 0xC0C08080, 0xE38880C0,
+  0xC3C1C1FF, 0xE3EBC3C3, 0xE7E3FFFF, 0xE3EBE7E7, 0xFFFFFFFF, 0xE3EBEFFF,
+  0xFFFFFFFF, 0xE3EBFFFF, 0xFFFFFFFF, 0xE3EBFBFF, 0xF3E3FFFF, 0xE3EBF3F3,
+  0xE1C1C1FF, 0xE3EBE1E1, 0xC0808080, 0xE388C0C0, 0xC1C0C1FF, 0xE3EBC3C3,
+  0xE2E0FFFF, 0xE3EFE7E7, 0xF5F1FFFF, 0xFFFFFFFF, 0xEBE3FFFF, 0xFFFFFFFF,
+  0xD7C7FFFF, 0xFFFFFFFF, 0xA383FFFF, 0xE3FBF3F3, 0x4101C1FF, 0xE3EBE1E1,
+  0x80008080, 0xE3C8C0C0, 0xC0C0C0FF, 0xE3EBC3C0, 0xE0E0E0FF, 0xE7EFE7E0,
+  0xE1E1E1FF, 0xFFFFEFE1, 0xFFFFFFFF, 0xFFFFFFFF, 0xC3C3C3FF, 0xC7C7C3C3,
+  0x838383FF, 0x83838383, 0x010101FF, 0x03030101, 0x00000080, 0x23000000,
+  0xC0C0C0C0, 0xE0E0C0C0, 0xC0C0C0C0, 0xE0E0C0C0, 0xC0C0C0C0, 0xF1E0C0C0,
+  0xC1C1C1C1, 0xE3E3C1C1, 0x81818181, 0xC7838181, 0x81818181, 0x83838181,
+  0x01010101, 0x03030101, 0x00000000, 0x23000000, 0xFFFFFBFB, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFDFE, 0xFFFFFFFF,
+  0xFFFFFDFE, 0xFFFFFFFF, 0xFFFFFDFE, 0xFFFFFFFF, 0xFFFFFDFE, 0xFFFFFFFF,
+  0xFFFFFDFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFDFE, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF,
+  0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFDFE, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFD, 0xFFFFFFFF, 0xFFFFFAFD, 0xFFFFFFFF, 0xFFFFFAFD, 0xFFFFFFFF,
+  0xFFFFFAFD, 0xFFFFFFFF, 0xFFFFFAFD, 0xFFFFFFFF, 0xFFFFFFFD, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFD, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFAFF, 0xFFFFFFFF, 0xFFFFFAFF, 0xFFFFFFFF, 0xFFFFFAFF, 0xFFFFFFFF,
+  0xFFFFFAFF, 0xFFFFFFFF, 0xFFFFFFFB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFB, 0xFFFFFFFF,
+  0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF,
+  0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFB, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFB, 0xFFFFFFFF, 0xFFFFF5FF, 0xFFFFFFFF,
+  0xFFFFF5FF, 0xFFFFFFFF, 0xFFFFF5FF, 0xFFFFFFFF, 0xFFFFF5FF, 0xFFFFFFFF,
+  0xFFFFF5FF, 0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF,
+  0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF,
+  0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF,
+  0xFFFFFFF7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFF7, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF,
+  0xFFFFEBF7, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF,
+  0xFFFFEBF7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFF7, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFF7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFEBF7, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF,
+  0xFFFFEBFF, 0xFFFFFFFF, 0xFFFFEBFF, 0xFFFFFFFF, 0xFFFFEBFF, 0xFFFFFFFF,
+  0xFFFFEBFF, 0xFFFFFFFF, 0xFFFFEBFF, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF,
+  0xFFFFEBF7, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF,
+  0xFFFFEBF7, 0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF, 0xFFFDFBFB, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFDFEFE, 0xFFFFFFFF, 0xFFF9FEFC, 0xFFFFFFFF,
+  0xFFF9FAF8, 0xFFFFFFFF, 0xFFF9FAF8, 0xFFFFFFFF, 0xFFF9FAF8, 0xFFFFFFFF,
+  0xFFF9FAF8, 0xFFFFFFFF, 0xFFFFFBFB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFEFE, 0xFFFFFFFF, 0xFFFDFEFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFEFC, 0xFFFFFFFF, 0xFFFDFEF8, 0xFFFFFFFF,
+  0xFFFBFAF8, 0xFFFFFFFF, 0xFFFFFAF8, 0xFFFFFFFF, 0xFFFFFAF8, 0xFFFFFFFF,
+  0xFFFDFAF8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFBFDFC, 0xFFFFFFFF, 0xFFF2FDF8, 0xFFFFFFFF,
+  0xFFF2F5F0, 0xFFFFFFFF, 0xFFF2F5F0, 0xFFFFFFFF, 0xFFF2F5F0, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFDFD, 0xFFFFFFFF, 0xFFFAFDF8, 0xFFFFFFFF, 0xFFF2F5F0, 0xFFFFFFFF,
+  0xFFF2F5F0, 0xFFFFFFFF, 0xFFF2F5F0, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFA, 0xFFFFFFFF, 0xFFFFFDFD, 0xFFFFFFFF,
+  0xFFFFFDFD, 0xFFFFFFFF, 0xFFFFFDFD, 0xFFFFFFFF, 0xFFFFFDFD, 0xFFFFFFFF,
+  0xFFFFFDFD, 0xFFFFFFFF, 0xFFFAFDF8, 0xFFFFFFFF, 0xFFFAFDF8, 0xFFFFFFFF,
+  0xFFFAFDF8, 0xFFFFFFFF, 0xFFF2FDF8, 0xFFFFFFFF, 0xFFF2F5F0, 0xFFFFFFFF,
+  0xFFF2F5F0, 0xFFFFFFFF, 0xFFF2F5F0, 0xFFFFFFFF, 0xFFF2F5F0, 0xFFFFFFFF,
+  0xFFFDFBFB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFF7FBFB, 0xFFFFFFFF, 0xFFE5FBF1, 0xFFFFFFFF,
+  0xFFE4EAE0, 0xFFFFFFFF, 0xFFE4EAE0, 0xFFFFFFFF, 0xFFFFFBFB, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFBFB, 0xFFFFFFFF, 0xFFF5FBF1, 0xFFFFFFFF, 0xFFE4EAE0, 0xFFFFFFFF,
+  0xFFE4EAE0, 0xFFFFFFFF, 0xFFFFFBFB, 0xFFFFFFFF, 0xFFFFFFFD, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFF7, 0xFFFFFFFF, 0xFFFFFBFB, 0xFFFFFFFF,
+  0xFFFFFBFB, 0xFFFFFFFF, 0xFFFFFBFB, 0xFFFFFFFF, 0xFFFFFBFB, 0xFFFFFFFF,
+  0xFFF4FBF1, 0xFFFFFFFF, 0xFFF5FBF1, 0xFFFFFFFF, 0xFFF5FBF1, 0xFFFFFFFF,
+  0xFFF5FBF1, 0xFFFFFFFF, 0xFFE5FBF1, 0xFFFFFFFF, 0xFFE5FBF1, 0xFFFFFFFF,
+  0xFFE4EAE0, 0xFFFFFFFF, 0xFFE4EAE0, 0xFFFFFFFF, 0xFFE4EAE0, 0xFFFFFFFF,
+  0xFFE4EAE0, 0xFFFFFFFF, 0xFFE4EAE0, 0xFFFFFFFF, 0xFFE4EAE0, 0xFFFFFFFF,
+  0xFFE9F7E3, 0xFFFFFFFF, 0xFFFBF7F7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFEFF7F7, 0xFFFFFFFF,
+  0xFFCBF7E3, 0xFFFFFFFF, 0xFFC9D5C1, 0xFFFFFFFF, 0xFFEBF7E3, 0xFFFFFFFF,
+  0xFFFFF7F7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFF7F7, 0xFFFFFFFF, 0xFFEBF7E3, 0xFFFFFFFF,
+  0xFFC9D5C1, 0xFFFFFFFF, 0xFFEBF7E3, 0xFFFFFFFF, 0xFFFFF7F7, 0xFFFFFFFF,
+  0xFFFFFFFB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFEF, 0xFFFFFFFF,
+  0xFFFFF7F7, 0xFFFFFFFF, 0xFFEBF7E3, 0xFFFFFFFF, 0xFFC9D5C1, 0xFFFFFFFF,
+  0xFFEBF7E3, 0xFFFFFFFF, 0xFFFFF7F7, 0xFFFFFFFF, 0xFFFFF7F7, 0xFFFFFFFF,
+  0xFFFFF7F7, 0xFFFFFFFF, 0xFFFFF7F7, 0xFFFFFFFF, 0xFFFFF7F7, 0xFFFFFFFF,
+  0xFFEBF7E3, 0xFFFFFFFF, 0xFFC9D5C1, 0xFFFFFFFF, 0xFFE9F7E3, 0xFFFFFFFF,
+  0xFFE9F7E3, 0xFFFFFFFF, 0xFFEBF7E3, 0xFFFFFFFF, 0xFFEBF7E3, 0xFFFFFFFF,
+  0xFFEBF7E3, 0xFFFFFFFF, 0xFFCBF7E3, 0xFFFFFFFF, 0xFFCBF7E3, 0xFFFFFFFF,
+  0xFFC9D5C1, 0xFFFFFFFF, 0xFFC9D5C1, 0xFFFFFFFF, 0xFFC9D5C1, 0xFFFFFFFF,
+  0xFFC9D5C1, 0xFFFFFFFF, 0xFFC9D5C1, 0xFFFFFFFF, 0xFDFAFBFB, 0xFFFFFFFF,
+  0xFDFEFFFF, 0xFFFFFFFF, 0xFDFAFEFE, 0xFFFFFFFF, 0xF9F2FCFC, 0xFFFFFFFF,
+  0xF1F2F8F8, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF,
+  0xF1F2F0F0, 0xFFFFFFFF, 0xFFFBFBFB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFDFEFEFE, 0xFFFFFFFF, 0xF9FEFCFC, 0xFFFFFFFF, 0xF1FAF8F8, 0xFFFFFFFF,
+  0xF1F2F0F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF,
+  0xFFFBFBF8, 0xFFFFFFFF, 0xFFFFFFF8, 0xFFFFFFFF, 0xFFFEFEF8, 0xFFFFFFFF,
+  0xFDFEFCF0, 0xFFFFFFFF, 0xF9FAF8F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF,
+  0xF1F2F0F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFF0F0, 0xFFFFFFFF, 0xFFFEF0F0, 0xFFFFFFFF, 0xFDFEF0F0, 0xFFFFFFFF,
+  0xF9FAF0F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF,
+  0xF1F2F0F0, 0xFFFFFFFF, 0xFBF2F0F0, 0xFFFFFFFF, 0xFFF2F0F0, 0xFFFFFFFF,
+  0xFFF2F0F0, 0xFFFFFFFF, 0xFDF2F0F0, 0xFFFFFFFF, 0xF9F2F0F0, 0xFFFFFFFF,
+  0xF1F2F0F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF,
+  0xF1F2F0F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF, 0xF1F2F0F0, 0xFFFFFFFF,
+  0xF1F2F0F0, 0xFFFFFFFF, 0xFAFDFFFF, 0xFFFFFFFF, 0xFAFDFFFF, 0xFFFFFFFF,
+  0xFAFDFFFF, 0xFFFFFFFF, 0xFAF5FDFD, 0xFFFFFFFF, 0xF2E5F8F8, 0xFFFFFFFF,
+  0xE2E5F0F0, 0xFFFFFFFF, 0xE2E5E0E0, 0xFFFFFFFF, 0xE2E5E0E0, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFBFDFDFF, 0xFFFFFFFF, 0xF2FDF8F8, 0xFFFFFFFF, 0xE2F5F0F0, 0xFFFFFFFF,
+  0xE2E5E0E0, 0xFFFFFFFF, 0xE2E5E0E0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFDFDFF, 0xFFFFFFFF,
+  0xFAFDF8F8, 0xFFFFFFFF, 0xF2F5F0F0, 0xFFFFFFFF, 0xE2E5E0E0, 0xFFFFFFFF,
+  0xE2E5E0E0, 0xFFFFFFFF, 0xFFFFFCFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFF9FF, 0xFFFFFFFF, 0xFFFDF9FF, 0xFFFFFFFF, 0xFAFDF0F8, 0xFFFFFFFF,
+  0xF2F5E0F0, 0xFFFFFFFF, 0xE2E5E0E0, 0xFFFFFFFF, 0xE2E5E0E0, 0xFFFFFFFF,
+  0xFFFDF8F8, 0xFFFFFFFF, 0xFFFDF8F8, 0xFFFFFFFF, 0xFFF5F0F0, 0xFFFFFFFF,
+  0xFFF5F0F0, 0xFFFFFFFF, 0xFAE5F0F0, 0xFFFFFFFF, 0xF2E5E0E0, 0xFFFFFFFF,
+  0xE2E5E0E0, 0xFFFFFFFF, 0xE2E5E0E0, 0xFFFFFFFF, 0xFAF5F0F0, 0xFFFFFFFF,
+  0xFAF5F0F0, 0xFFFFFFFF, 0xFAF5F0F0, 0xFFFFFFFF, 0xE2E5E0E0, 0xFFFFFFFF,
+  0xE2E5E0E0, 0xFFFFFFFF, 0xE2E5E0E0, 0xFFFFFFFF, 0xE2E5E0E0, 0xFFFFFFFF,
+  0xE2E5E0E0, 0xFFFFFFFF, 0xF5FAFBFB, 0xFFFFFFFF, 0xF5FBFFFF, 0xFFFFFFFF,
+  0xF5FBFFFF, 0xFFFFFFFF, 0xF5FBFFFF, 0xFFFFFFFF, 0xF5EBFBFB, 0xFFFFFFFF,
+  0xE5CBF1F1, 0xFFFFFFFF, 0xC4CAE0E0, 0xFFFFFFFF, 0xC4CAC0C0, 0xFFFFFFFF,
+  0xFDFBFBFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF7FBFBFF, 0xFFFFFFFF, 0xE5FBF1F1, 0xFFFFFFFF,
+  0xC4EAE0E0, 0xFFFFFFFF, 0xC4CAC0C0, 0xFFFFFFFF, 0xFFFBFBFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFBFBFF, 0xFFFFFFFF, 0xF5FBF1F1, 0xFFFFFFFF, 0xE4EAE0E0, 0xFFFFFFFF,
+  0xC4CAC0C0, 0xFFFFFFFF, 0xFFFBF9FF, 0xFFFFFFFF, 0xFFFFF9FF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFF3FF, 0xFFFFFFFF, 0xFFFBF3FF, 0xFFFFFFFF,
+  0xF5FBE1F1, 0xFFFFFFFF, 0xE4EAC0E0, 0xFFFFFFFF, 0xC4CAC0C0, 0xFFFFFFFF,
+  0xFFFAF0F0, 0xFFFFFFFF, 0xFFFAF0F0, 0xFFFFFFFF, 0xFFFBF1F1, 0xFFFFFFFF,
+  0xFFEBE1E1, 0xFFFFFFFF, 0xFFEBE1E1, 0xFFFFFFFF, 0xF5CBE1E1, 0xFFFFFFFF,
+  0xE4CAC0C0, 0xFFFFFFFF, 0xC4CAC0C0, 0xFFFFFFFF, 0xF4EAE0E0, 0xFFFFFFFF,
+  0xF5EAE0E0, 0xFFFFFFFF, 0xF5EAE0E0, 0xFFFFFFFF, 0xF5EAE0E0, 0xFFFFFFFF,
+  0xC5CAC0C0, 0xFFFFFFFF, 0xC5CAC0C0, 0xFFFFFFFF, 0xC4CAC0C0, 0xFFFFFFFF,
+  0xC4CAC0C0, 0xFFFFFFFF, 0xC4CAC0C0, 0xFFFFFFFF, 0xC4CAC0C0, 0xFFFFFFFF,
+  0xC4CAC0C0, 0xFFFFFFFF, 0xC4CAC0C0, 0xFFFFFFFF, 0xE9F4E3E3, 0xFFFFFFFF,
+  0xEBF5F7F7, 0xFFFFFFFF, 0xEBF7FFFF, 0xFFFFFFFF, 0xEBF7FFFF, 0xFFFFFFFF,
+  0xEBF7FFFF, 0xFFFFFFFF, 0xEBD7F7F7, 0xFFFFFFFF, 0xCB97E3E3, 0xFFFFFFFF,
+  0x8995C1C1, 0xFFFFFFFF, 0xE9F7E3E3, 0xFFFFFFFF, 0xFBF7F7FF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xEFF7F7FF, 0xFFFFFFFF, 0xCBF7E3E3, 0xFFFFFFFF, 0x89D5C1C1, 0xFFFFFFFF,
+  0xEBF7E3E3, 0xFFFFFFFF, 0xFFF7F7FF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFF7F7FF, 0xFFFFFFFF,
+  0xEBF7E3E3, 0xFFFFFFFF, 0xC9D5C1C1, 0xFFFFFFFF, 0xEBF7E1E3, 0xFFFFFFFF,
+  0xFFF7F3FF, 0xFFFFFFFF, 0xFFFFF3FF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFE7FF, 0xFFFFFFFF, 0xFFF7E7FF, 0xFFFFFFFF, 0xEBF7C3E3, 0xFFFFFFFF,
+  0xC9D581C1, 0xFFFFFFFF, 0xEBF4E1E1, 0xFFFFFFFF, 0xFFF5E1E1, 0xFFFFFFFF,
+  0xFFF5E1E1, 0xFFFFFFFF, 0xFFF7E3E3, 0xFFFFFFFF, 0xFFD7C3C3, 0xFFFFFFFF,
+  0xFFD7C3C3, 0xFFFFFFFF, 0xEB97C3C3, 0xFFFFFFFF, 0xC9958181, 0xFFFFFFFF,
+  0xE8D4C0C0, 0xFFFFFFFF, 0xE8D4C0C0, 0xFFFFFFFF, 0xEBD5C1C1, 0xFFFFFFFF,
+  0xEBD5C1C1, 0xFFFFFFFF, 0xEBD5C1C1, 0xFFFFFFFF, 0x8B958181, 0xFFFFFFFF,
+  0x8B958181, 0xFFFFFFFF, 0x89958181, 0xFFFFFFFF, 0x88948080, 0xFFFFFFFF,
+  0x88948080, 0xFFFFFFFF, 0x88948080, 0xFFFFFFFF, 0x88948080, 0xFFFFFFFF,
+  0xFAF8FBFB, 0xFFFFFFF9, 0xFAF8FFFF, 0xFFFFFFF9, 0xFAF8FEFE, 0xFFFFFFF9,
+  0xF2F0FCFC, 0xFFFFFFF1, 0xE2E0F8F8, 0xFFFFFFE1, 0xE2E0F0F0, 0xFFFFFFE1,
+  0xE2E0E0E0, 0xFFFFFFE1, 0xE2E0E0E0, 0xFFFFFFE1, 0xFAFBFBFB, 0xFFFFFFFD,
+  0xFEFFFFFF, 0xFFFFFFFD, 0xFAFEFEFE, 0xFFFFFFFD, 0xF2FCFCFC, 0xFFFFFFF9,
+  0xE2F8F8F8, 0xFFFFFFF1, 0xE2F0F0F0, 0xFFFFFFE1, 0xE2E0E0E0, 0xFFFFFFE1,
+  0xE2E0E0E0, 0xFFFFFFE1, 0xFBFBFBF8, 0xFFFFFFFF, 0xFFFFFFF8, 0xFFFFFFFF,
+  0xFEFEFEF8, 0xFFFFFFFD, 0xFEFCFCF0, 0xFFFFFFF9, 0xFAF8F8E0, 0xFFFFFFF1,
+  0xF2F0F0E0, 0xFFFFFFE1, 0xE2E0E0E0, 0xFFFFFFE1, 0xE2E0E0E0, 0xFFFFFFE1,
+  0xFBFBF0F0, 0xFFFFFFFF, 0xFFFFF0F0, 0xFFFFFFFF, 0xFEFEF0F0, 0xFFFFFFFF,
+  0xFEFCF0F0, 0xFFFFFFFD, 0xFAF8E0E0, 0xFFFFFFF9, 0xF2F0E0E0, 0xFFFFFFF1,
+  0xE2E0E0E0, 0xFFFFFFE1, 0xE2E0E0E0, 0xFFFFFFE1, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFE0E0E0, 0xFFFFFFFF, 0xFEE0E0E0, 0xFFFFFFFF, 0xFEE0E0E0, 0xFFFFFFFD,
+  0xFAE0E0E0, 0xFFFFFFF9, 0xF2E0E0E0, 0xFFFFFFF1, 0xE2E0E0E0, 0xFFFFFFE1,
+  0xE2E0E0E0, 0xFFFFFFE1, 0xE2E0E0E0, 0xFFFFFFFB, 0xE2E0E0E0, 0xFFFFFFFF,
+  0xE2E0E0E0, 0xFFFFFFFF, 0xE2E0E0E0, 0xFFFFFFFD, 0xE2E0E0E0, 0xFFFFFFF9,
+  0xE2E0E0E0, 0xFFFFFFF1, 0xE2E0E0E0, 0xFFFFFFE1, 0xE2E0E0E0, 0xFFFFFFE1,
+  0xE2E0E0E0, 0xFFFFFFE1, 0xE2E0E0E0, 0xFFFFFFE1, 0xE2E0E0E0, 0xFFFFFFE1,
+  0xE2E0E0E0, 0xFFFFFFE1, 0xF5F8FFFF, 0xFFFFFFF2, 0xF5F8FFFF, 0xFFFFFFF2,
+  0xF5F8FFFF, 0xFFFFFFF2, 0xF5F0FDFD, 0xFFFFFFF2, 0xE5E0F8F8, 0xFFFFFFE2,
+  0xC5C0F0F0, 0xFFFFFFC2, 0xC5C0E0E0, 0xFFFFFFC2, 0xC5C0C0C0, 0xFFFFFFC2,
+  0xFDFFFFFF, 0xFFFFFFFA, 0xFDFFFFFF, 0xFFFFFFFA, 0xFDFFFFFF, 0xFFFFFFFA,
+  0xF5FDFDFF, 0xFFFFFFFA, 0xE5F8F8F8, 0xFFFFFFF2, 0xC5F0F0F0, 0xFFFFFFE2,
+  0xC5E0E0E0, 0xFFFFFFC2, 0xC5C0C0C0, 0xFFFFFFC2, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFDFDFDFF, 0xFFFFFFFB,
+  0xFDF8F8F8, 0xFFFFFFF2, 0xF5F0F0F0, 0xFFFFFFE2, 0xE5E0E0E0, 0xFFFFFFC2,
+  0xC5C0C0C0, 0xFFFFFFC2, 0xFFFFFEFF, 0xFFFFFFFF, 0xFFFFFDFF, 0xFFFFFFFF,
+  0xFFFFFBFF, 0xFFFFFFFF, 0xFDFDF5FF, 0xFFFFFFFF, 0xFDF8E8F8, 0xFFFFFFFA,
+  0xF5F0D0F0, 0xFFFFFFF2, 0xE5E0E0E0, 0xFFFFFFE2, 0xC5C0C0C0, 0xFFFFFFC2,
+  0xFFFCFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFF9FFF9, 0xFFFFFFFF,
+  0xFDF1FDF1, 0xFFFFFFFF, 0xFDE0F8E0, 0xFFFFFFFA, 0xF5C0F0C0, 0xFFFFFFF2,
+  0xE5C0E0C0, 0xFFFFFFE2, 0xC5C0C0C0, 0xFFFFFFC2, 0xFDF8F8F8, 0xFFFFFFFF,
+  0xFDF8F8F8, 0xFFFFFFFF, 0xF5F0F0F0, 0xFFFFFFFF, 0xF5F0F0F0, 0xFFFFFFFF,
+  0xE5E0E0E0, 0xFFFFFFFA, 0xC5C0C0C0, 0xFFFFFFF2, 0xC5C0C0C0, 0xFFFFFFE2,
+  0xC5C0C0C0, 0xFFFFFFC2, 0xF5F0F0F0, 0xFFFFFFFA, 0xF5F0F0F0, 0xFFFFFFFA,
+  0xF5F0F0F0, 0xFFFFFFFA, 0xE5E0E0E0, 0xFFFFFFE2, 0xE5E0E0E0, 0xFFFFFFE2,
+  0xC5C0C0C0, 0xFFFFFFC2, 0xC5C0C0C0, 0xFFFFFFC2, 0xC5C0C0C0, 0xFFFFFFC2,
+  0xE5E0E0E0, 0xFFFFFFE2, 0xE5E0E0E0, 0xFFFFFFE2, 0xE5E0E0E0, 0xFFFFFFE2,
+  0xE5E0E0E0, 0xFFFFFFE2, 0xC5C0C0C0, 0xFFFFFFC2, 0xC5C0C0C0, 0xFFFFFFC2,
+  0xC5C0C0C0, 0xFFFFFFC2, 0xC5C0C0C0, 0xFFFFFFC2, 0xEAF0FBFB, 0xFFFFFFE4,
+  0xEAF1FFFF, 0xFFFFFFE4, 0xEAF1FFFF, 0xFFFFFFE4, 0xEAF1FFFF, 0xFFFFFFE4,
+  0xEAE1FBFB, 0xFFFFFFE4, 0xCAC1F1F1, 0xFFFFFFC4, 0x8A80E0E0, 0xFFFFFF84,
+  0x8A80C0C0, 0xFFFFFF84, 0xFAFBFBFF, 0xFFFFFFF5, 0xFBFFFFFF, 0xFFFFFFF5,
+  0xFBFFFFFF, 0xFFFFFFF5, 0xFBFFFFFF, 0xFFFFFFF5, 0xEBFBFBFF, 0xFFFFFFF5,
+  0xCBF1F1F1, 0xFFFFFFE5, 0x8AE0E0E0, 0xFFFFFFC4, 0x8AC0C0C0, 0xFFFFFF84,
+  0xFBFBFBFF, 0xFFFFFFFD, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFBFBFBFF, 0xFFFFFFF7, 0xFBF1F1F1, 0xFFFFFFE5,
+  0xEAE0E0E0, 0xFFFFFFC4, 0xCAC0C0C0, 0xFFFFFF84, 0xFBFBFAFF, 0xFFFFFFFF,
+  0xFFFFFDFF, 0xFFFFFFFF, 0xFFFFFBFF, 0xFFFFFFFF, 0xFFFFF7FF, 0xFFFFFFFF,
+  0xFBFBEBFF, 0xFFFFFFFF, 0xFBF1D1F1, 0xFFFFFFF5, 0xEAE0A0E0, 0xFFFFFFE4,
+  0xCAC0C0C0, 0xFFFFFFC4, 0xFBF8FBF8, 0xFFFFFFFF, 0xFFF9FFF9, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFF3FFF3, 0xFFFFFFFF, 0xFBE3FBE3, 0xFFFFFFFF,
+  0xFBC1F1C1, 0xFFFFFFF5, 0xEA80E080, 0xFFFFFFE4, 0xCA80C080, 0xFFFFFFC4,
+  0xFAF0F0F0, 0xFFFFFFFF, 0xFAF0F0F0, 0xFFFFFFFF, 0xFBF1F1F1, 0xFFFFFFFF,
+  0xEBE1E1E1, 0xFFFFFFFF, 0xEBE1E1E1, 0xFFFFFFFF, 0xCBC1C1C1, 0xFFFFFFF5,
+  0x8A808080, 0xFFFFFFE4, 0x8A808080, 0xFFFFFFC4, 0xEAE0E0E0, 0xFFFFFFF4,
+  0xEAE0E0E0, 0xFFFFFFF5, 0xEAE0E0E0, 0xFFFFFFF5, 0xEAE0E0E0, 0xFFFFFFF5,
+  0xC0C0C0C0, 0xC7C7C7C1, 0xC0C0C0C0, 0x8F8F8FC1, 0x80808080, 0x1F1F1F80,
+  0x80808080, 0x3F3F3F80, 0xCAC0C0C0, 0xFFFFFFC4, 0xCAC0C0C0, 0xFFFFFFC4,
+  0xCAC0C0C0, 0xFFFFFFC4, 0xCAC0C0C0, 0xFFFFFFC4, 0xC0C0C0C0, 0xC7C7FFC0,
+  0x80808080, 0x8F8FFF80, 0x80808080, 0x1F1FFF80, 0x80808080, 0x3F3FFF80,
+  0xD4E0E3E3, 0xFFFFFFC8, 0xD5E1F7F7, 0xFFFFFFC9, 0xD5E3FFFF, 0xFFFFFFC9,
+  0xD5E3FFFF, 0xFFFFFFC9, 0xD5E3FFFF, 0xFFFFFFC9, 0xD5C3F7F7, 0xFFFFFFC9,
+  0x9583E3E3, 0xFFFFFF89, 0x1501C1C1, 0xFFFFFF09, 0xF4E3E3E3, 0xFFFFFFE9,
+  0xF5F7F7FF, 0xFFFFFFEB, 0xF7FFFFFF, 0xFFFFFFEB, 0xF7FFFFFF, 0xFFFFFFEB,
+  0xF7FFFFFF, 0xFFFFFFEB, 0xD7F7F7FF, 0xFFFFFFEB, 0x97E3E3E3, 0xFFFFFFCB,
+  0x15C1C1C1, 0xFFFFFF89, 0xF7E3E3E3, 0xFFFFFFE9, 0xF7F7F7FF, 0xFFFFFFFB,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xF7F7F7FF, 0xFFFFFFEF, 0xF7E3E3E3, 0xFFFFFFCB, 0xD5C1C1C1, 0xFFFFFF89,
+  0xF7E3E2E3, 0xFFFFFFEB, 0xF7F7F5FF, 0xFFFFFFFF, 0xFFFFFBFF, 0xFFFFFFFF,
+  0xFFFFF7FF, 0xFFFFFFFF, 0xFFFFEFFF, 0xFFFFFFFF, 0xF7F7D7FF, 0xFFFFFFFF,
+  0xF7E3A3E3, 0xFFFFFFEB, 0xD5C141C1, 0xFFFFFFC9, 0xF7E0E3E0, 0xFFFFFFEB,
+  0xF7F1F7F1, 0xFFFFFFFF, 0xFFF3FFF3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFE7FFE7, 0xFFFFFFFF, 0xF7C7F7C7, 0xFFFFFFFF, 0xF783E383, 0xFFFFFFEB,
+  0xD501C101, 0xFFFFFFC9, 0xF4E0E0E0, 0xFFFFFFEB, 0xF5E1E1E1, 0xFFFFFFFF,
+  0xF5E1E1E1, 0xFFFFFFFF, 0xF7E3E3E3, 0xFFFFFFFF, 0xD7C3C3C3, 0xFFFFFFFF,
+  0xD7C3C3C3, 0xFFFFFFFF, 0x97838383, 0xFFFFFFEB, 0x15010101, 0xFFFFFFC9,
+  0xD4C0C0C0, 0xFFFFFFE8, 0xD4C0C0C0, 0xFFFFFFE8, 0xD5C1C1C1, 0xFFFFFFEB,
+  0xD5C1C1C1, 0xFFFFFFEB, 0xD5C1C1C1, 0xFFFFFFEB, 0x95818181, 0xFFFFFF8B,
+  0x95818181, 0xFFFFFF8B, 0x15010101, 0xFFFFFF09, 0x80808080, 0xC7C7FF80,
+  0x80808080, 0x8F8FFF80, 0x00000000, 0x1F1FFF00, 0x00000000, 0x3F3FFF00,
+  0xF0F0FBFB, 0xFFFFF1F2, 0xF0F0FFFF, 0xFFFFF1F2, 0xF0F0FEFE, 0xFFFFF1F2,
+  0xF0F0FCFC, 0xFFFFF1F2, 0xE0E0C0C0, 0xFFFFE0E0, 0xC0C08080, 0xFFFFC0C0,
+  0xC0C00000, 0xFFFFC0C0, 0xC0C00000, 0xFFFFC0C0, 0xF8FBFBFB, 0xFFFFF9FA,
+  0xF8FFFFFF, 0xFFFFF9FA, 0xF8FEFEFE, 0xFFFFF9FA, 0xF0FCFCFC, 0xFFFFF1F2,
+  0xE0C0C0C0, 0xFFFFE0E0, 0xC0808080, 0xFFFFC0C0, 0xC0000000, 0xFFFFC0C0,
+  0xC0000000, 0xFFFFC0C0, 0xFBFBFBF8, 0xFFFFFDFA, 0xFFFFFFF8, 0xFFFFFDFE,
+  0xFEFEFEF8, 0xFFFFFDFA, 0xFCFCFCF0, 0xFFFFF9F2, 0xC0C0C0E0, 0xFFFFF0E0,
+  0x808080C0, 0xFFFFE0C0, 0x000000C0, 0xFFFFC0C0, 0x000000C0, 0xFFFFC0C0,
+  0xFBFBF0F0, 0xFFFFFFFB, 0xFFFFF0F0, 0xFFFFFFFF, 0xFEFEF0F0, 0xFFFFFDFE,
+  0xFCFCF0F0, 0xFFFFF9FE, 0xC0C0E0E0, 0xFFFFF0C0, 0x8080C0C0, 0xFFFFE080,
+  0x0000C0C0, 0xFFFFC000, 0x0000C0C0, 0xFFFFC000, 0xFBE0E0E0, 0xFFFFFFFB,
+  0xFFE0E0E0, 0xFFFFFFFF, 0xFEE0E0E0, 0xFFFFFFFE, 0xFCE0E0E0, 0xFFFFFDFE,
+  0xC0E0E0E0, 0xFFFFC0C0, 0x80C0C0C0, 0xFFFF8080, 0x00C0C0C0, 0xFFFF0000,
+  0x00C0C0C0, 0xFFFF0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xC0C0C0C0, 0xFFFFFFFF,
+  0xC0C0C0C0, 0xFFFFFFFE, 0xC0C0C0C0, 0xFFFFFDFE, 0xC0C0C0C0, 0xFCFCF8C0,
+  0xC0C0C0C0, 0xF8F8F8C0, 0xC0C0C0C0, 0xF1F1F0C0, 0xC0C0C0C0, 0xE3E3E0C0,
+  0xE0F0FFFF, 0xFFFFE2E5, 0xE0F0FFFF, 0xFFFFE2E5, 0xE0F0FFFF, 0xFFFFE2E5,
+  0xE0F0FDFD, 0xFFFFE2E5, 0xE0E0C0C0, 0xFFFFE0E0, 0xC0C08080, 0xFFFFC0C0,
+  0x80800000, 0xFFFF8080, 0x80800000, 0xFFFF8080, 0xF8FFFFFF, 0xFFFFF2F5,
+  0xF8FFFFFF, 0xFFFFF2F5, 0xF8FFFFFF, 0xFFFFF2F5, 0xF0FDFDFF, 0xFFFFF2F5,
+  0xE0C0C0C7, 0xFFFFE0E0, 0xC0808080, 0xFFFFC0C0, 0x80000000, 0xFFFF8080,
+  0x80000000, 0xFFFF8080, 0xFFFFFFFF, 0xFFFFFAFD, 0xFFFFFFFF, 0xFFFFFAFD,
+  0xFFFFFFFF, 0xFFFFFAFD, 0xFDFDFFFF, 0xFFFFFAF5, 0xF8F8F8FF, 0xFFFFF2E5,
+  0xF0F0F0F0, 0xFFFFE2C5, 0xE0E0E0E0, 0xFFFFC285, 0xC0C0C0C0, 0xFFFF8285,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFDFDFFFF, 0xFFFFFBFD, 0xF8F8F8FF, 0xFFFFF2FD, 0xF0F0F0F0, 0xFFFFE2F5,
+  0xE0E0E0E0, 0xFFFFC2E5, 0xC0C0C0C0, 0xFFFF82C5, 0xFFFEFFFF, 0xFFFFFFFF,
+  0xFFFDFFFF, 0xFFFFFFFF, 0xFFFBFFFF, 0xFFFFFFFF, 0xFDF5FFFF, 0xFFFFFFFD,
+  0xF8E8F8FF, 0xFFFFFAFD, 0xF0D0F0F0, 0xFFFFF2F5, 0xE0A0E0E0, 0xFFFFE2E5,
+  0xC0C0C0C0, 0xFFFFC2C5, 0xFCFFFCFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xF9FFF9FF, 0xFFFFFFFF, 0xF1FDF1FF, 0xFFFFFFFD, 0xE0F8E0FF, 0xFFC7C0C0,
+  0xC0F0C0F0, 0xFF8F8080, 0x80E080E0, 0xFF1F0000, 0x80C080C0, 0xFF3F0000,
+  0xF8F8F8F8, 0xFFFFFFFD, 0xF8F8F8F8, 0xFFFFFFFD, 0xF0F0F0F0, 0xFFFFFFF5,
+  0xF0F0F0F0, 0xFFFFFFF5, 0xE0E0E0E0, 0xC7C7C0E0, 0xC0C0C0C0, 0x8F8F80C0,
+  0x80808080, 0x1F1F0080, 0x80808080, 0x3F3F0080, 0xF0F0F0F0, 0xFFFFFAF5,
+  0xF0F0F0F0, 0xFFFFFAF5, 0xF0F0F0F0, 0xFFFFFAF5, 0xE0E0E0E0, 0xFFFFE2E5,
+  0xE0E0E0E0, 0xC7C7E0E0, 0xC0C0C0C0, 0x8F8FC0C0, 0x80808080, 0x1F1F8080,
+  0x80808080, 0x3F3F8080, 0xC0E0FBFB, 0xFFFFC4CA, 0xC0E0FFFF, 0xFFFFC4CA,
+  0xC0E0FFFF, 0xFFFFC4CA, 0xC0E0FFFF, 0xFFFFC4CA, 0xC0E0C3C3, 0xFFFFC0C0,
+  0xC0C08181, 0xFFFFC0C0, 0x80800000, 0xFFFF8080, 0x00000000, 0xFFFF0000,
+  0xF0FBFBFF, 0xFFFFE4EA, 0xF1FFFFFF, 0xFFFFE4EA, 0xF1FFFFFF, 0xFFFFE4EA,
+  0xF1FFFFFF, 0xFFFFE4EA, 0xE1FBFBFF, 0xFFFFE4EA, 0xC1F1F1FF, 0xFFFFC4CA,
+  0x80E0E0E0, 0xFFFF848A, 0x00C0C0C0, 0xFFFF040A, 0xFBFBFFFF, 0xFFFFF5FA,
+  0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFF5FB, 0xFFFFFFFF, 0xFFFFF5FB,
+  0xFBFBFFFF, 0xFFFFF5EB, 0xF1F1F1FF, 0xFFFFE5CB, 0xE0E0E0E0, 0xFFFFC48A,
+  0xC0C0C0C0, 0xFFFF840A, 0xFBFBFFFF, 0xFFFFFDFB, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFBFBFFFF, 0xFFFFF7FB,
+  0xF1F1F1FF, 0xFFFFE5FB, 0xE0E0E0E0, 0xFFFFC4EA, 0xC0C0C0C0, 0xFFFF84CA,
+  0xFBFAFFFF, 0xFFFFFFFB, 0xFFFDFFFF, 0xFFFFFFFF, 0xFFFBFFFF, 0xFFFFFFFF,
+  0xFFF7FFFF, 0xFFFFFFFF, 0xFBEBFFFF, 0xFFFFFFFB, 0xF1D1F1FF, 0xFFFFF5FB,
+  0xE0A0E0E0, 0xFFFFE4EA, 0xC040C0C0, 0xFFFFC4CA, 0xF8FBF8FF, 0xFFFFFFFB,
+  0xF9FFF9FF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xF3FFF3FF, 0xFFFFFFFF,
+  0xE3FBE3FF, 0xFFFFFFFB, 0xC1F1C1FF, 0xFFFFF5FB, 0x80E080E0, 0xFFFFE4EA,
+  0x00C000C0, 0xFFFFC4CA, 0xF0F0F0F0, 0xFFFFFFFA, 0xF0F0F0F0, 0xFFFFFFFA,
+  0xF1F1F1F1, 0xFFFFFFFB, 0xE1E1E1E1, 0xFFFFFFEB, 0xE1E1E1E1, 0xC7C7C3E1,
+  0xC1C1C1C1, 0x8F8F81C1, 0x80808080, 0x1F1F0080, 0x00000000, 0x3F3F0000,
+  0xE0E0E0E0, 0xFFFFF4EA, 0xE0E0E0E0, 0xFFFFF5EA, 0xE0E0E0E0, 0xFFFFF5EA,
+  0xE0E0E0E0, 0xFFFFF5EA, 0xC0C0C0C0, 0xC7C7C1C0, 0xC0C0C0C0, 0x8F8FC1C0,
+  0x80808080, 0x1F1F8080, 0x00000000, 0x3F3F0000, 0x80C0E3E3, 0xFFFF8894,
+  0x80C1F7F7, 0xFFFF8894, 0x80C1FFFF, 0xFFFF8894, 0x80C1FFFF, 0xFFFF8894,
+  0x80C1C7C7, 0xFFFF8080, 0x80C18787, 0xFFFF8080, 0x80810303, 0xFFFF8080,
+  0x00010101, 0xFFFF0000, 0xE0E3E3FF, 0xFFFFC8D4, 0xE1F7F7FF, 0xFFFFC9D5,
+  0xE3FFFFFF, 0xFFFFC9D5, 0xE3FFFFFF, 0xFFFFC9D5, 0xE3FFFFFF, 0xFFFFC9D5,
+  0xC3F7F7FF, 0xFFFFC9D5, 0x83E3E3FF, 0xFFFF8995, 0x01C1C1C1, 0xFFFF0915,
+  0xE3E3E3FF, 0xFFFFE9F4, 0xF7F7FFFF, 0xFFFFEBF5, 0xFFFFFFFF, 0xFFFFEBF7,
+  0xFFFFFFFF, 0xFFFFEBF7, 0xFFFFFFFF, 0xFFFFEBF7, 0xF7F7FFFF, 0xFFFFEBD7,
+  0xE3E3E3FF, 0xFFFFCB97, 0xC1C1C1C1, 0xFFFF8915, 0xE3E3E3FF, 0xFFFFE9F7,
+  0xF7F7FFFF, 0xFFFFFBF7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xF7F7FFFF, 0xFFFFEFF7, 0xE3E3E3FF, 0xFFFFCBF7,
+  0xC1C1C1C1, 0xFFFF89D5, 0xE3E2E3FF, 0xFFFFEBF7, 0xF7F5FFFF, 0xFFFFFFF7,
+  0xFFFBFFFF, 0xFFFFFFFF, 0xFFF7FFFF, 0xFFFFFFFF, 0xFFEFFFFF, 0xFFFFFFFF,
+  0xF7D7FFFF, 0xFFFFFFF7, 0xE3A3E3FF, 0xFFFFEBF7, 0xC141C1C1, 0xFFFFC9D5,
+  0xE0E3E0FF, 0xFFFFEBF7, 0xF1F7F1FF, 0xFFFFFFF7, 0xF3FFF3FF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xE7FFE7FF, 0xFFFFFFFF, 0xC7F7C7FF, 0xFFFFFFF7,
+  0x83E383FF, 0xFFFFEBF7, 0x01C101C1, 0xFFFFC9D5, 0xE0E0E0E0, 0xFFFFEBF4,
+  0xE1E1E1E1, 0xFFFFFFF5, 0xE1E1E1E1, 0xFFFFFFF5, 0xE3E3E3E3, 0xFFFFFFF7,
+  0xC3C3C3C3, 0xFFFFFFD7, 0xC3C3C3C3, 0xFFFFFFD7, 0x83838383, 0xFFFFEB97,
+  0x01010101, 0xFFFFC915, 0xC0C0C0C0, 0xFCFCE0C0, 0xC0C0C0C0, 0xF8F8E0C0,
+  0xC1C1C1C1, 0xF1F1E3C1, 0xC1C1C1C1, 0xE3E3E3C1, 0xC1C1C1C1, 0xC7C7E3C1,
+  0x81818181, 0x8F8F8381, 0x81818181, 0x1F1F8381, 0x01010101, 0x3F3F0101,
+  0xF0F0FBFB, 0xFFFFF2F0, 0xF0F0FFFF, 0xFFFFF2F0, 0xF0F0FEFE, 0xFFFFF2F0,
+  0xF0F0FCFC, 0xFFFFF2F0, 0xE0E0C0C0, 0xFFFEE0E0, 0xC0C08080, 0xFFFEC0C0,
+  0xC0C00000, 0xFFFEC0C0, 0xC0C00000, 0xFFFEC0C0, 0xF8FBFBFB, 0xFFFFFAF8,
+  0xF8FFFFFF, 0xFFFFFAF8, 0xF8FEFEFE, 0xFFFFFAF8, 0xF0FCFCFC, 0xFFFFF2F0,
+  0xE0C0C0C0, 0xFFFEE0E0, 0xC0808080, 0xFFFEC0C0, 0xC0000000, 0xFFFEC0C0,
+  0xC0000000, 0xFFFEC0C0, 0xFBFBFBF8, 0xFFFFFEF8, 0xFFFFFFF8, 0xFFFFFEFC,
+  0xFEFEFEF8, 0xFFFFFEF8, 0xFCFCFCF0, 0xFFFFFEF0, 0xC0C0C0E0, 0xFFFEF8E0,
+  0x808080C0, 0xFFFEF0C0, 0x000000C0, 0xFFFEE0C0, 0x000000C0, 0xFFFEC0C0,
+  0xFBFBF0F0, 0xFFFFFEFB, 0xFFFFF0F0, 0xFFFFFEFF, 0xFEFEF0F0, 0xFFFFFEFE,
+  0xFCFCF0F0, 0xFFFFFEFC, 0xC0C0E0E0, 0xFFFEF8C0, 0x8080C0C0, 0xFFFEF080,
+  0x0000C0C0, 0xFFFEE000, 0x0000C0C0, 0xFFFEC000, 0xFBE0E0E0, 0xFFFFFFFB,
+  0xFFE0E0E0, 0xFFFFFFFF, 0xFEE0E0E0, 0xFFFFFEFE, 0xFCE0E0E0, 0xFFFFFEFC,
+  0xC0E0E0E0, 0xFFFEC0C0, 0x80C0C0C0, 0xFFFE8080, 0x00C0C0C0, 0xFFFE0000,
+  0x00C0C0C0, 0xFFFE0000, 0xC0C0C0C0, 0xFFFFFBFB, 0xC0C0C0C0, 0xFFFFFFFF,
+  0xC0C0C0C0, 0xFFFFFEFE, 0xC0C0C0C0, 0xFFFFFEFC, 0xC0C0C0C0, 0xFFC6C0C0,
+  0xC0C0C0C0, 0xFF8E8080, 0xC0C0C0C0, 0xFF1E0000, 0xC0C0C0C0, 0xFF3E0000,
+  0x00000000, 0x00000000, 0xC0C0C0C0, 0xF8F8F8C0, 0xC0C0C0C0, 0xF1F0F0C0,
+  0xC0C0C0C0, 0xE3E2E0C0, 0xC0C0C0C0, 0xC7C6C0C0, 0xC0C0C0C0, 0x8F8E80C0,
+  0xC0C0C0C0, 0x1F1E00C0, 0xC0C0C0C0, 0x3F3E00C0, 0xC0C0C0C0, 0xFCFCC0C0,
+  0xC0C0C0C0, 0xF8F8C0C0, 0xC0C0C0C0, 0xF1F0C0C0, 0xC0C0C0C0, 0xE3E2C0C0,
+  0xC0C0C0C0, 0xC7C6C0C0, 0xC0C0C0C0, 0x8F8EC0C0, 0xC0C0C0C0, 0x1F1EC0C0,
+  0xC0C0C0C0, 0x3F3EC0C0, 0xE0E0FFFF, 0xFFFFE5E0, 0xE0E0FFFF, 0xFFFFE5E0,
+  0xE0E0FFFF, 0xFFFFE5E0, 0xE0E0FDFD, 0xFFFFE5E0, 0xE0E0C0C0, 0xFFFDE0E0,
+  0xC0C08080, 0xFFFDC0C0, 0x80800000, 0xFFFD8080, 0x80800000, 0xFFFD8080,
+  0xF0FFFFFF, 0xFFFFF5F0, 0xF0FFFFFF, 0xFFFFF5F0, 0xF0FFFFFF, 0xFFFFF5F0,
+  0xF0FDFDFF, 0xFFFFF5F0, 0xE0C0C0C7, 0xFFFDE0E0, 0xC080808F, 0xFFFDC0C0,
+  0x80000000, 0xFFFD8080, 0x80000000, 0xFFFD8080, 0xFFFFFFFF, 0xFFFFFDF8,
+  0xFFFFFFFF, 0xFFFFFDF8, 0xFFFFFFFF, 0xFFFFFDF8, 0xFDFDFFFF, 0xFFFFFDF0,
+  0xF8F8FFFF, 0xFFFFFDE0, 0xF0F0F0FF, 0xFFFFF5C0, 0xE0E0E0E0, 0xFFFFE580,
+  0xC0C0C0C0, 0xFFFFC580, 0xFFFFFFFF, 0xFFFFFDFF, 0xFFFFFFFF, 0xFFFFFDFF,
+  0xFFFFFFFF, 0xFFFFFDFF, 0xFDFFFFFF, 0xFFFFFDFD, 0xF8F8FFFF, 0xFFFFFDF8,
+  0xF0F0F0FF, 0xFFFFF5F0, 0xE0E0E0E0, 0xFFFFE5E0, 0xC0C0C0C0, 0xFFFFC5C0,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFDFFFFFF, 0xFFFFFDFD, 0xFEFFFFFF, 0xFFFFFFFF, 0xFDFFFFFF, 0xFFFFFFFF,
+  0xFBFFFFFF, 0xFFFFFFFF, 0xF5FFFFFF, 0xFFFFFDFD, 0xE8F8FFFF, 0xFFFFFDF8,
+  0xD0F0F0FF, 0xFFFFF5F0, 0xA0E0E0E0, 0xFFFFE5E0, 0xC0C0C0C0, 0xFFFFC5C0,
+  0xFFFCFFFF, 0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFF9FFFF, 0xFFFFFFF9,
+  0xFDF1FFFF, 0xFFFFFDF1, 0xF8E0FFFF, 0xFFFFFDE0, 0xF0C0F0FF, 0xFFFFF5C0,
+  0xE080E0E0, 0xFFFFE580, 0xC080C0C0, 0xFFFFC580, 0xF8F8F8FF, 0xFFFFFDF8,
+  0xF8F8F8FF, 0xFFFFFDF8, 0xF0F0F0FF, 0xFFFFF5F0, 0xF0F0F0FF, 0xFFFFF5F0,
+  0xE0E0E0FF, 0xC7C5E0E0, 0xC0C0C0FF, 0x8F8DC0C0, 0x808080E0, 0x1F1D8080,
+  0x808080C0, 0x3F3D8080, 0xC0C0FBFB, 0xFFFFCAC0, 0xC0C0FFFF, 0xFFFFCAC0,
+  0xC0C0FFFF, 0xFFFFCAC0, 0xC0C0FFFF, 0xFFFFCAC0, 0xC0C0C3C3, 0xFFFBC0C0,
+  0xC0C08181, 0xFFFBC0C0, 0x80800000, 0xFFFB8080, 0x00000000, 0xFFFB0000,
+  0xE0FBFBFF, 0xFFFFEAE0, 0xE0FFFFFF, 0xFFFFEAE0, 0xE0FFFFFF, 0xFFFFEAE0,
+  0xE0FFFFFF, 0xFFFFEAE0, 0xE0C3C3C7, 0xFFFBE0E0, 0xC081818F, 0xFFFBC0C0,
+  0x8000001F, 0xFFFB8080, 0x00000000, 0xFFFB0000, 0xFBFBFFFF, 0xFFFFFBF0,
+  0xFFFFFFFF, 0xFFFFFBF1, 0xFFFFFFFF, 0xFFFFFBF1, 0xFFFFFFFF, 0xFFFFFBF1,
+  0xFBFBFFFF, 0xFFFFFBE1, 0xF1F1FFFF, 0xFFFFFBC1, 0xE0E0E0FF, 0xFFFFEA80,
+  0xC0C0C0C0, 0xFFFFCA00, 0xFBFFFFFF, 0xFFFFFBFB, 0xFFFFFFFF, 0xFFFFFBFF,
+  0xFFFFFFFF, 0xFFFFFBFF, 0xFFFFFFFF, 0xFFFFFBFF, 0xFBFFFFFF, 0xFFFFFBFB,
+  0xF1F1FFFF, 0xFFFFFBF1, 0xE0E0E0FF, 0xFFFFEAE0, 0xC0C0C0C0, 0xFFFFCAC0,
+  0xFBFFFFFF, 0xFFFFFBFB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFAFFFFFF, 0xFFFFFBFB, 0xFDFFFFFF, 0xFFFFFFFF,
+  0xFBFFFFFF, 0xFFFFFFFF, 0xF7FFFFFF, 0xFFFFFFFF, 0xEBFFFFFF, 0xFFFFFBFB,
+  0xD1F1FFFF, 0xFFFFFBF1, 0xA0E0E0FF, 0xFFFFEAE0, 0x40C0C0C0, 0xFFFFCAC0,
+  0xFBF8FFFF, 0xFFFFFBF8, 0xFFF9FFFF, 0xFFFFFFF9, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFF3FFFF, 0xFFFFFFF3, 0xFBE3FFFF, 0xFFFFFBE3, 0xF1C1FFFF, 0xFFFFFBC1,
+  0xE080E0FF, 0xFFFFEA80, 0xC000C0C0, 0xFFFFCA00, 0xF0F0F0FF, 0xFFFFFAF0,
+  0xF0F0F0FF, 0xFFFFFAF0, 0xF1F1F1FF, 0xFFFFFBF1, 0xE1E1E1FF, 0xFFFFEBE1,
+  0xE1E1E1FF, 0xC7C3E1E1, 0xC1C1C1FF, 0x8F8BC1C1, 0x808080FF, 0x1F1B8080,
+  0x000000C0, 0x3F3B0000, 0x8080E0E0, 0xFFF78080, 0x8080F0F0, 0xFFF78080,
+  0x8080F1F1, 0xFFF78080, 0x8080E3E3, 0xFFF78080, 0x8080C7C7, 0xFFF78080,
+  0x80808787, 0xFFF78080, 0x80800303, 0xFFF78080, 0x00000101, 0xFFF70000,
+  0xC0E3E3FF, 0xFFFFD4C0, 0xC1F7F7FF, 0xFFFFD5C1, 0xC1FFFFFF, 0xFFFFD5C1,
+  0xC1FFFFFF, 0xFFFFD5C1, 0xC1FFFFFF, 0xFFFFD5C1, 0xC1F7F7FF, 0xFFFFD5C1,
+  0x81E3E3FF, 0xFFFF9581, 0x01C1C1FF, 0xFFFF1501, 0xE3E3FFFF, 0xFFFFF7E0,
+  0xF7F7FFFF, 0xFFFFF7E1, 0xFFFFFFFF, 0xFFFFF7E3, 0xFFFFFFFF, 0xFFFFF7E3,
+  0xFFFFFFFF, 0xFFFFF7E3, 0xF7F7FFFF, 0xFFFFF7C3, 0xE3E3FFFF, 0xFFFFF783,
+  0xC1C1C1FF, 0xFFFFD501, 0xE3E3FFFF, 0xFFFFF7E3, 0xF7FFFFFF, 0xFFFFF7F7,
+  0xFFFFFFFF, 0xFFFFF7FF, 0xFFFFFFFF, 0xFFFFF7FF, 0xFFFFFFFF, 0xFFFFF7FF,
+  0xF7FFFFFF, 0xFFFFF7F7, 0xE3E3FFFF, 0xFFFFF7E3, 0xC1C1C1FF, 0xFFFFD5C1,
+  0xE3E3FFFF, 0xFFFFF7E3, 0xF7FFFFFF, 0xFFFFF7F7, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xF7FFFFFF, 0xFFFFF7F7,
+  0xE3E3FFFF, 0xFFFFF7E3, 0xC1C1C1FF, 0xFFFFD5C1, 0xE2E3FFFF, 0xFFFFF7E3,
+  0xF5FFFFFF, 0xFFFFF7F7, 0xFBFFFFFF, 0xFFFFFFFF, 0xF7FFFFFF, 0xFFFFFFFF,
+  0xEFFFFFFF, 0xFFFFFFFF, 0xD7FFFFFF, 0xFFFFF7F7, 0xA3E3FFFF, 0xFFFFF7E3,
+  0x41C1C1FF, 0xFFFFD5C1, 0xE3E0FFFF, 0xFFFFF7E0, 0xF7F1FFFF, 0xFFFFF7F1,
+  0xFFF3FFFF, 0xFFFFFFF3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFE7FFFF, 0xFFFFFFE7,
+  0xF7C7FFFF, 0xFFFFF7C7, 0xE383FFFF, 0xFFFFF783, 0xC101C1FF, 0xFFFFD501,
+  0xE0E0E0FF, 0xFFFFF4E0, 0xE1E1E1FF, 0xFFFFF5E1, 0xE1E1E1FF, 0xFFFFF5E1,
+  0xE3E3E3FF, 0xFFFFF7E3, 0xC3C3C3FF, 0xFFFFD7C3, 0xC3C3C3FF, 0xFFFFD7C3,
+  0x838383FF, 0xFFFF9783, 0x010101FF, 0xFFFF1501,
+};
+
+static const u16 KRK_BLOCKS[320] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009,
+  0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0001, 0x0011, 0x0003,
+  0x0012, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D,
+  0x000E, 0x000F, 0x0010, 0x0001, 0x0013, 0x0003, 0x0014, 0x0005, 0x0015, 0x0007,
+  0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0016, 0x0017,
+  0x0018, 0x0019, 0x001A, 0x001B, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B,
+  0x000C, 0x000D, 0x000E, 0x000F, 0x0016, 0x0017, 0x001C, 0x001D, 0x001E, 0x001F,
+  0x0020, 0x0021, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+  0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B,
+  0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x002C, 0x002D, 0x002E, 0x002F,
+  0x0030, 0x0031, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D,
+  0x000E, 0x000F, 0x002C, 0x002D, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+  0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0038, 0x0039,
+  0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x000A, 0x000B,
+  0x000C, 0x000D, 0x000E, 0x000F, 0x0042, 0x0001, 0x0043, 0x0044, 0x0045, 0x0046,
+  0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x000C, 0x000D, 0x000E, 0x000F,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+};
+
+static const u32 KRK_WORDS[616] = {
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFF3F7, 0xFFFFFFFF,
+  0xFFFFE3EB, 0xFFFFFFFF, 0xFFFFC7D7, 0xFFFFFFFF, 0xFFFF8FAF, 0xFFFFFFFF,
+  0xFFFF1F5F, 0xFFFFFFFF, 0xFFFF3FBF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFF1F7F3, 0xFFFFFFFF, 0xFFE3EBE3, 0xFFFFFFFF,
+  0xFFC7D7C7, 0xFFFFFFFF, 0xFF8FAF8F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF,
+  0xFF3FBF3F, 0xFFFFFFFF, 0xFCFDFFFF, 0xFFFFFFFF, 0xF8FAFBFF, 0xFFFFFFFF,
+  0xF1F5F3FF, 0xFFFFFFFF, 0xE3EBE3FF, 0xFFFFFFFF, 0xC7D7C7FF, 0xFFFFFFFF,
+  0x8FAF8FFF, 0xFFFFFFFF, 0x1F5F1FFF, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF,
+  0xFDFCFFFF, 0xFFFFFFFC, 0xFAF8FFFF, 0xFFFFFFF8, 0xF5F1FFFF, 0xFFFFFFF1,
+  0xEBE3FFFF, 0xFFFFFFE3, 0xD7C7FFFF, 0xFFFFFFC7, 0xAF8FFFFF, 0xFFFFFF8F,
+  0x5F1FFFFF, 0xFFFFFF1F, 0xBF3FFFFF, 0xFFFFFF3F, 0xFCFFFFFF, 0xFFFFFCFD,
+  0xF8FFFFFF, 0xFFFFF8FA, 0xF1FFFFFF, 0xFFFFF1F5, 0xE3FFFFFF, 0xFFFFE3EB,
+  0xC7FFFFFF, 0xFFFFC7D7, 0x8FFFFFFF, 0xFFFF8FAF, 0x1FFFFFFF, 0xFFFF1F5F,
+  0x3FFFFFFF, 0xFFFF3FBF, 0xFFFFFFFF, 0xFFFCFDFC, 0xFFFFFFFF, 0xFFF8FAF8,
+  0xFFFFFFFF, 0xFFF1F5F1, 0xFFFFFFFF, 0xFFE3EBE3, 0xFFFFFFFF, 0xFFC7D7C7,
+  0xFFFFFFFF, 0xFF8FAF8F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F,
+  0xFFFFFFFF, 0xFCFDFCFF, 0xFFFFFFFF, 0xF8FAF8FF, 0xFFFFFFFF, 0xF1F5F1FF,
+  0xFFFFFFFF, 0xE3EBE3FF, 0xFFFFFFFF, 0xC7D7C7FF, 0xFFFFFFFF, 0x8FAF8FFF,
+  0xFFFFFFFF, 0x1F5F1FFF, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF, 0xFDFCFFFF,
+  0xFFFFFFFF, 0xFAF8FFFF, 0xFFFFFFFF, 0xF5F1FFFF, 0xFFFFFFFF, 0xEBE3FFFF,
+  0xFFFFFFFF, 0xD7C7FFFF, 0xFFFFFFFF, 0xAF8FFFFF, 0xFFFFFFFF, 0x5F1FFFFF,
+  0xFFFFFFFF, 0xBF3FFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFE7EF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFE3EFE7, 0xFFFFFFFF,
+  0xFCFDFFFF, 0xFFFFFFFF, 0xF8FAFFFF, 0xFFFFFFFF, 0xF1F5F7FF, 0xFFFFFFFF,
+  0xE3EBE7FF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFE7EFE7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xE3EFE7FF, 0xFFFFFFFF,
+  0xFDFFFFFF, 0xFFFFFFFC, 0xFAFFFFFF, 0xFFFFFFF8, 0xF5F7FFFF, 0xFFFFFFF1,
+  0xEBE7FFFF, 0xFFFFFFE3, 0xFFFFFEFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFCFDF, 0xFFFFFFFF,
+  0xFFFF8FAF, 0xFFFFFFFF, 0xFFFF1F5F, 0xFFFFFFFF, 0xFFFF3FBF, 0xFFFFFFFF,
+  0xFFFCFFFE, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF,
+  0xFFFFFFFE, 0xFFFFFFFF, 0xFFC7DFCE, 0xFFFFFFFF, 0xFF8FAF8E, 0xFFFFFFFF,
+  0xFF1F5F1E, 0xFFFFFFFF, 0xFF3FBF3E, 0xFFFFFFFF, 0xFCFDFEFF, 0xFFFFFFFF,
+  0xF8FAFEFF, 0xFFFFFFFF, 0xF1F5FFFF, 0xFFFFFFFF, 0xE3EBEFFF, 0xFFFFFFFF,
+  0xC7D7CFFF, 0xFFFFFFFF, 0x8FAF8FFF, 0xFFFFFFFF, 0x1F5F1FFF, 0xFFFFFFFF,
+  0x3FBF3FFF, 0xFFFFFFFF, 0xFFFEFFFE, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFCFDFCF, 0xFFFFFFFF,
+  0xFF8FAF8F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F, 0xFFFFFFFF,
+  0xFCFFFEFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xC7DFCFFF, 0xFFFFFFFF, 0x8FAF8FFF, 0xFFFFFFFF,
+  0x1F5F1FFF, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF, 0xFDFEFFFF, 0xFFFFFFFC,
+  0xFAFEFFFF, 0xFFFFFFF8, 0xF5FFFFFF, 0xFFFFFFF1, 0xEBEFFFFF, 0xFFFFFFE3,
+  0xD7CFFFFF, 0xFFFFFFC7, 0xAF8FFFFF, 0xFFFFFF8F, 0x5F1FFFFF, 0xFFFFFF1F,
+  0xBF3FFFFF, 0xFFFFFF3F, 0xFFFFFEFD, 0xFFFFFFFF, 0xFFFFFEFA, 0xFFFFFFFF,
+  0xFFFFFFF5, 0xFFFFFFFF, 0xFFFFEFEB, 0xFFFFFFFF, 0xFFFFCFD7, 0xFFFFFFFF,
+  0xFFFF8FAF, 0xFFFFFFFF, 0xFFFF1F5F, 0xFFFFFFFF, 0xFFFF3FBF, 0xFFFFFFFF,
+  0xFFFEFFFC, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFCFDFC7, 0xFFFFFFFF, 0xFF8FAF8F, 0xFFFFFFFF,
+  0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F, 0xFFFFFFFF, 0xFEFFFEFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xCFDFCFFF, 0xFFFFFFFF, 0x8FAF8FFF, 0xFFFFFFFF, 0x1F5F1FFF, 0xFFFFFFFF,
+  0x3FBF3FFF, 0xFFFFFFFF, 0xFFFEFFFF, 0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xDFCFFFFF, 0xFFFFFFC7,
+  0xAF8FFFFF, 0xFFFFFF8F, 0x5F1FFFFF, 0xFFFFFF1F, 0xBF3FFFFF, 0xFFFFFF3F,
+  0xFEFFFFFF, 0xFFFFFCFD, 0xFEFFFFFF, 0xFFFFF8FA, 0xFFFFFFFF, 0xFFFFF1F5,
+  0xEFFFFFFF, 0xFFFFE3EB, 0xCFFFFFFF, 0xFFFFC7D7, 0x8FFFFFFF, 0xFFFF8FAF,
+  0x1FFFFFFF, 0xFFFF1F5F, 0x3FFFFFFF, 0xFFFF3FBF, 0xFFFFFCFD, 0xFFFFFFFF,
+  0xFFFFFCFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFF9FBF, 0xFFFFFFFF, 0xFFFF1F5F, 0xFFFFFFFF,
+  0xFFFF3FBF, 0xFFFFFFFF, 0xFFFCFDFC, 0xFFFFFFFF, 0xFFF8FEFC, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFF8FBF9F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F, 0xFFFFFFFF,
+  0xFCFDFCFF, 0xFFFFFFFF, 0xF8FAFCFF, 0xFFFFFFFF, 0xF1F5FDFF, 0xFFFFFFFF,
+  0xE3EBFFFF, 0xFFFFFFFF, 0xC7D7DFFF, 0xFFFFFFFF, 0x8FAF9FFF, 0xFFFFFFFF,
+  0x1F5F1FFF, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF, 0xFFFCFDFC, 0xFFFFFFFF,
+  0xFFFCFEFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFF9FBF9F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF,
+  0xFF3FBF3F, 0xFFFFFFFF, 0xFCFDFCFF, 0xFFFFFFFF, 0xF8FEFCFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0x8FBF9FFF, 0xFFFFFFFF, 0x1F5F1FFF, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF,
+  0xFDFCFFFF, 0xFFFFFFFC, 0xFAFCFFFF, 0xFFFFFFF8, 0xF5FDFFFF, 0xFFFFFFF1,
+  0xEBFFFFFF, 0xFFFFFFE3, 0xD7DFFFFF, 0xFFFFFFC7, 0xAF9FFFFF, 0xFFFFFF8F,
+  0x5F1FFFFF, 0xFFFFFF1F, 0xBF3FFFFF, 0xFFFFFF3F, 0xFFFFFCFD, 0xFFFFFFFF,
+  0xFFFFFCFA, 0xFFFFFFFF, 0xFFFFFDF5, 0xFFFFFFFF, 0xFFFFFFEB, 0xFFFFFFFF,
+  0xFFFFDFD7, 0xFFFFFFFF, 0xFFFF9FAF, 0xFFFFFFFF, 0xFFFF1F5F, 0xFFFFFFFF,
+  0xFFFF3FBF, 0xFFFFFFFF, 0xFFFCFDFC, 0xFFFFFFFF, 0xFFFCFEF8, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFF9FBF8F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F, 0xFFFFFFFF,
+  0xFCFDFCFF, 0xFFFFFFFF, 0xFCFEFCFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x9FBF9FFF, 0xFFFFFFFF,
+  0x1F5F1FFF, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF, 0xFDFCFFFF, 0xFFFFFFFC,
+  0xFEFCFFFF, 0xFFFFFFF8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xBF9FFFFF, 0xFFFFFF8F, 0x5F1FFFFF, 0xFFFFFF1F,
+  0xBF3FFFFF, 0xFFFFFF3F, 0xFCFFFFFF, 0xFFFFFCFD, 0xFCFFFFFF, 0xFFFFF8FA,
+  0xFDFFFFFF, 0xFFFFF1F5, 0xFFFFFFFF, 0xFFFFE3EB, 0xDFFFFFFF, 0xFFFFC7D7,
+  0x9FFFFFFF, 0xFFFF8FAF, 0x1FFFFFFF, 0xFFFF1F5F, 0x3FFFFFFF, 0xFFFF3FBF,
+  0xFFFFFCFD, 0xFFFFFFFF, 0xFFFFF8FA, 0xFFFFFFFF, 0xFFFFF1F5, 0xFFFFFFFF,
+  0xFFFFE3EB, 0xFFFFFFFF, 0xFFFCFDFC, 0xFFFFFFFF, 0xFFFCFAF8, 0xFFFFFFFF,
+  0xFFFDF5F1, 0xFFFFFFFF, 0xFFFFEBE3, 0xFFFFFFFF, 0xFFDFD7C7, 0xFFFFFFFF,
+  0xFF9FAF8F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F, 0xFFFFFFFF,
+  0xFCFDFCFF, 0xFFFFFFFF, 0xFCFEF8FF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x9FBF8FFF, 0xFFFFFFFF,
+  0x1F5F1FFF, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF, 0xFDFCFFFF, 0xFFFFFFFC,
+  0xFEFCFFFF, 0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xBF9FFFFF, 0xFFFFFF9F, 0x5F1FFFFF, 0xFFFFFF1F,
+  0xBF3FFFFF, 0xFFFFFF3F, 0xFCFFFFFF, 0xFFFFFCFD, 0xFCFFFFFF, 0xFFFFF8FE,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0x9FFFFFFF, 0xFFFF8FBF, 0x1FFFFFFF, 0xFFFF1F5F, 0x3FFFFFFF, 0xFFFF3FBF,
+  0xFFFFFFFF, 0xFFFCFDFC, 0xFFFFFFFF, 0xFFF8FAFC, 0xFFFFFFFF, 0xFFF1F5FD,
+  0xFFFFFFFF, 0xFFE3EBFF, 0xFFFFFFFF, 0xFFC7D7DF, 0xFFFFFFFF, 0xFF8FAF9F,
+  0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F,
+};
+
+static const u16 KQK_BLOCKS[320] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009,
+  0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0001, 0x0011, 0x0012,
+  0x0013, 0x0014, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D,
+  0x000E, 0x000F, 0x0010, 0x0001, 0x0015, 0x0012, 0x0016, 0x0014, 0x0017, 0x0007,
+  0x0018, 0x0009, 0x0019, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x001A, 0x001B,
+  0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0007, 0x0021, 0x0009, 0x000A, 0x0022,
+  0x000C, 0x0023, 0x000E, 0x0024, 0x0025, 0x001B, 0x0026, 0x0027, 0x0028, 0x0029,
+  0x002A, 0x002B, 0x002C, 0x0009, 0x000A, 0x0022, 0x000C, 0x0023, 0x000E, 0x0024,
+  0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
+  0x0037, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0038, 0x0039, 0x003A, 0x003B,
+  0x003C, 0x003D, 0x003E, 0x0007, 0x003F, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D,
+  0x000E, 0x000F, 0x0038, 0x0039, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+  0x003F, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x000A, 0x000B,
+  0x000C, 0x000D, 0x000E, 0x000F, 0x0050, 0x0001, 0x0051, 0x0052, 0x0053, 0x0054,
+  0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x000C, 0x000D, 0x000E, 0x000F,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+};
+
+static const u32 KQK_WORDS[728] = {
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFF3F7, 0xFFFFFFFF,
+  0xFFFFE3EB, 0xFFFFFFFF, 0xFFFFC7D7, 0xFFFFFFFF, 0xFFFF8FAF, 0xFFFFFFFF,
+  0xFFFF1F5F, 0xFFFFFFFF, 0xFFFF3FBF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFF1F7F3, 0xFFFFFFFF, 0xFFE3EBE3, 0xFFFFFFFF,
+  0xFFC7D7C3, 0xFFFFFFFF, 0xFF8FAF0F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF,
+  0xFF3FBF3F, 0xFFFFFFFF, 0xFCFDFFFF, 0xFFFFFFFF, 0xF8FAFBFF, 0xFFFFFFFF,
+  0xF1F5F3FF, 0xFFFFFFFF, 0xE3EBE3FB, 0xFFFFFFFF, 0xC7D7C7FF, 0xFFFFFFFF,
+  0x8FAF8FFF, 0xFFFFFFFF, 0x1F5F1F7F, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF,
+  0xFDFCFFFF, 0xFFFFFFFC, 0xFAF8FFFF, 0xFFFFFFF8, 0xF5F0FFFF, 0xFFFFFFF1,
+  0xEBE3FFFF, 0xFFFFFFE3, 0xD7C7FFFF, 0xFFFFFFC7, 0xAF8FFFFF, 0xFFFFFF8F,
+  0x5F1FFFFF, 0xFFFFFF1F, 0xBF3FFFFF, 0xFFFFFF3F, 0xFCFFFFFF, 0xFFFFFCFD,
+  0xF8FEFFFF, 0xFFFFF8FA, 0xF1FFFFFF, 0xFFFFF1F5, 0xE3FFFFFF, 0xFFFFE3EB,
+  0xC7FFFFFF, 0xFFFFC7D7, 0x8FFFFFFF, 0xFFFF8FAF, 0x1FFFFFFF, 0xFFFF1F5F,
+  0x3FFFFFFF, 0xFFFF3FBF, 0xFFFFFFFF, 0xFFFCFDFC, 0xFFFFFFFF, 0xFEF8FAF8,
+  0xFFFFFFFF, 0xFFF1F5F1, 0xFFFFFFFF, 0xFFE3EBE3, 0xFFFFFFFF, 0xFFC7D7C7,
+  0xFFFFFFFF, 0xFF8FAF8F, 0xFFFFFFFF, 0x7F1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F,
+  0xFFFFFFFF, 0xFCFDFCFF, 0xFFFFFFFF, 0xF8FAF8FF, 0xFFFFFFFF, 0xF0F5F1FF,
+  0xFFFFFFFF, 0xE3EBE3FF, 0xFFFFFFFF, 0xC7D7C7FF, 0xFFFFFFFF, 0x0FAF8FFF,
+  0xFFFFFFFF, 0x1F5F1FFF, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF, 0xFDFCFFFF,
+  0xFFFFFFFF, 0xFAF8FFFF, 0xFFFFFFFF, 0xF5F1FFFF, 0xFFFFFFFF, 0xEBE3FFFF,
+  0xFFFFFFFF, 0xD7C7FFFF, 0xFFFFFFFF, 0xAF8FFFFF, 0xFFFFFFFF, 0x5F1FFFFF,
+  0xFFFFFFFF, 0xBF3FFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFE7EF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFE3EFE7, 0xFFFFFFFF,
+  0xFFC7D7C7, 0xFFFFFFFF, 0xFF8FAF07, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF,
+  0xFF3FBF3F, 0xFFFFFFFF, 0xFCFDFFFF, 0xFFFFFFFF, 0xF8FAFFFF, 0xFFFFFFFF,
+  0xF1F5F7FF, 0xFFFFFFFF, 0xE3EBE7FF, 0xFFFFFFFF, 0xC7D7C7F7, 0xFFFFFFFF,
+  0x8FAF8FFF, 0xFFFFFFFF, 0x1F5F1F7F, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFE7EFE7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xE3EFE7FF, 0xFFFFFFFF, 0xFDFFFFFF, 0xFFFFFFFC,
+  0xFAFFFFFF, 0xFFFFFFF8, 0xF5F7FFFF, 0xFFFFFFF1, 0xEBE7FFFF, 0xFFFFFFE3,
+  0xFCFFFFFF, 0xFFFFFCFD, 0xF8FFFFFF, 0xFFFFF8FA, 0xF0FFFFFF, 0xFFFFF1F5,
+  0xE3FFFFFF, 0xFFFFE3EB, 0xFFFFFFFF, 0xFFFCFDFC, 0xFEFFFFFF, 0xFEF8FAF8,
+  0xFFFFFFFF, 0xFFF1F5F1, 0xFFFFFFFF, 0xFFE3EBE3, 0xFFFFFEFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFCFDF, 0xFFFFFFFF, 0xFFFF8FAF, 0xFFFFFFFF, 0xFFFF1F5F, 0xFFFFFFFF,
+  0xFFFF3FBF, 0xFFFFFFFF, 0xFFFCFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFC7DFCE, 0xFFFFFFFF,
+  0xFF8FAF0E, 0xFFFFFFFF, 0xFF1F5F0E, 0xFFFFFFFF, 0xFF3FBF3E, 0xFFFFFFFF,
+  0xFCFDFEFF, 0xFFFFFFFF, 0xF8FAFEFE, 0xFFFFFFFF, 0xF1F5FEFF, 0xFFFFFFFF,
+  0xE3EBEFFF, 0xFFFFFFFF, 0xC7D7CFFF, 0xFFFFFFFF, 0x8FAF8FEF, 0xFFFFFFFF,
+  0x1F5F1F7F, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF, 0xFDFCFFFF, 0xFFFFFFFC,
+  0xFAF8FFFF, 0xFFFFFFF8, 0xF5F0FFFE, 0xFFFFFFF1, 0xEBE3FFFF, 0xFFFFFFE3,
+  0xFCFFFFFF, 0xFFFFFCFD, 0xF8FFFFFF, 0xFFFFF8FA, 0xF1FFFFFF, 0xFFFFF1F5,
+  0xE3FFFFFE, 0xFFFFE3EB, 0xFFFFFFFE, 0xFFC7D7C7, 0xFFFFFFFF, 0xFF8FAF8F,
+  0xFFFFFFFF, 0x7F1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F, 0xFFFFFFFF, 0xC7D7C7FF,
+  0xFFFFFFFE, 0x0FAF8FFF, 0xFFFFFFFF, 0x1F5F1FFF, 0xFFFFFFFF, 0x3FBF3FFF,
+  0xFFFFFFFF, 0xD7C7FFFF, 0xFFFFFFFF, 0xAF8FFFFF, 0xFFFFFFFE, 0x5F1FFFFF,
+  0xFFFFFFFF, 0xBF3FFFFF, 0xFFFFFEFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFEFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFEFFFE, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFCFDFCF, 0xFFFFFFFF, 0xFF8FAF0F, 0xFFFFFFFF, 0xFF1F5F0F, 0xFFFFFFFF,
+  0xFF3FBF3F, 0xFFFFFFFF, 0xFCFFFEFF, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF,
+  0xFFFFFEFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xC7DFCFFF, 0xFFFFFFFF,
+  0x8FAF8FEF, 0xFFFFFFFF, 0x1F5F1F7F, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF,
+  0xFDFEFFFF, 0xFFFFFFFC, 0xFAFEFFFF, 0xFFFFFFF8, 0xF5FEFFFE, 0xFFFFFFF1,
+  0xEBEFFFFF, 0xFFFFFFE3, 0xD7CFFFFF, 0xFFFFFFC7, 0xAF8FFFFF, 0xFFFFFF8F,
+  0x5F1FFFFF, 0xFFFFFF1F, 0xBF3FFFFF, 0xFFFFFF3F, 0xFCFFFFFF, 0xFFFFFCFD,
+  0xF8FFFFFF, 0xFFFFF8FA, 0xF0FFFFFF, 0xFFFFF1F5, 0xE3FFFFFE, 0xFFFFE3EB,
+  0xFFFFFEFD, 0xFFFFFFFF, 0xFFFFFEFA, 0xFFFFFFFF, 0xFFFFFEF5, 0xFFFFFFFF,
+  0xFFFFEFEB, 0xFFFFFFFF, 0xFFFFCFD7, 0xFFFFFFFF, 0xFFFF8FAF, 0xFFFFFFFF,
+  0xFFFF1F5F, 0xFFFFFFFF, 0xFFFF3FBF, 0xFFFFFFFF, 0xFFFEFFFC, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFEFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFCFDFC7, 0xFFFFFFFF, 0xFF8FAF0F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF,
+  0xFF3FBF3F, 0xFFFFFFFF, 0xFEFFFEFD, 0xFFFFFFFF, 0xFFFFFFFA, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFB, 0xFFFFFFFF, 0xCFDFCFF7, 0xFFFFFFFF,
+  0x8FAF8FEF, 0xFFFFFFFF, 0x1F5F1F7F, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF,
+  0xFFFEFFFF, 0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFEFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xDFCFFFFF, 0xFFFFFFC7, 0xAF8FFFFF, 0xFFFFFF8F,
+  0x5F1FFFFF, 0xFFFFFF1F, 0xBF3FFFFF, 0xFFFFFF3F, 0xFEFFFFFF, 0xFFFFFCFD,
+  0xFEFFFFFF, 0xFFFFF8FA, 0xFEFFFFFF, 0xFFFFF1F5, 0xEFFFFFFF, 0xFFFFE3EB,
+  0xCFFFFFFF, 0xFFFFC7D7, 0x8FFFFFFF, 0xFFFF8FAF, 0x1FFFFFFF, 0xFFFF1F5F,
+  0x3FFFFFFF, 0xFFFF3FBF, 0xFFFFFFFF, 0xFFFCFDFC, 0xFFFFFFFF, 0xFEF8FAF8,
+  0xFFFFFFFF, 0xFFF1F5F0, 0xFFFFFFFF, 0xFFE3EBE3, 0xFFFFFCFD, 0xFFFFFFFF,
+  0xFFFFFCFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFF9FBF, 0xFFFFFFFF, 0xFFFF1F5F, 0xFFFFFFFF,
+  0xFFFF3FBF, 0xFFFFFFFF, 0xFFFCFDFC, 0xFFFFFFFF, 0xFFF8FEFC, 0xFFFFFFFF,
+  0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFF8FBF1F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF1F, 0xFFFFFFFF,
+  0xFCFDFCFD, 0xFFFFFFFF, 0xF8FAFCFE, 0xFFFFFFFF, 0xF1F5FDFF, 0xFFFFFFFF,
+  0xE3EBFFFF, 0xFFFFFFFF, 0xC7D7DFFF, 0xFFFFFFFF, 0x8FAF9FFF, 0xFFFFFFFF,
+  0x1F5F1F5F, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF, 0xFDFCFFFF, 0xFFFFFFFC,
+  0xFAF8FFFF, 0xFFFFFFF8, 0xF5F1FFFF, 0xFFFFFFF1, 0xEBE3FFFF, 0xFFFFFFE3,
+  0xFCFFFFFF, 0xFFFFFCFD, 0xF8FFFFFF, 0xFFFFF8FA, 0xF1FFFFFF, 0xFFFFF1F5,
+  0xE3FFFFFF, 0xFFFFE3EB, 0xFFFCFDFC, 0xFFFFFFFF, 0xFFFCFEFC, 0xFFFFFFFF,
+  0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFF9FBF1F, 0xFFFFFFFF, 0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF1F, 0xFFFFFFFF,
+  0xFCFDFCFD, 0xFFFFFFFF, 0xF8FEFCFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x8FBF9FFF, 0xFFFFFFFF,
+  0x1F5F1F5F, 0xFFFFFFFF, 0x3FBF3FFF, 0xFFFFFFFF, 0xFDFCFFFF, 0xFFFFFFFC,
+  0xFAFCFFFF, 0xFFFFFFF8, 0xF5FDFFFF, 0xFFFFFFF1, 0xEBFFFFFF, 0xFFFFFFE3,
+  0xD7DFFFFF, 0xFFFFFFC7, 0xAF9FFFFF, 0xFFFFFF8F, 0x5F1FFFFF, 0xFFFFFF1F,
+  0xBF3FFFFF, 0xFFFFFF3F, 0xFFFFFCFD, 0xFFFFFFFF, 0xFFFFFCFA, 0xFFFFFFFF,
+  0xFFFFFDF5, 0xFFFFFFFF, 0xFFFFFFEB, 0xFFFFFFFF, 0xFFFFDFD7, 0xFFFFFFFF,
+  0xFFFF9FAF, 0xFFFFFFFF, 0xFFFF1F5F, 0xFFFFFFFF, 0xFFFF3FBF, 0xFFFFFFFF,
+  0xFFFCFDFC, 0xFFFFFFFF, 0xFFFCFEF8, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFF9FBF0F, 0xFFFFFFFF,
+  0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F, 0xFFFFFFFF, 0xFCFDFCFD, 0xFFFFFFFF,
+  0xFCFEFCFA, 0xFFFFFFFF, 0xFFFFFFF7, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFF7, 0xFFFFFFFF, 0x9FBF9FEF, 0xFFFFFFFF, 0x1F5F1F5F, 0xFFFFFFFF,
+  0x3FBF3FFF, 0xFFFFFFFF, 0xFDFCFFFF, 0xFFFFFFFC, 0xFEFCFFFF, 0xFFFFFFF8,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xBF9FFFFF, 0xFFFFFF8F, 0x5F1FFFFF, 0xFFFFFF1F, 0xBF3FFFFF, 0xFFFFFF3F,
+  0xFCFFFFFF, 0xFFFFFCFD, 0xFCFFFFFF, 0xFFFFF8FA, 0xFDFFFFFF, 0xFFFFF1F5,
+  0xFFFFFFFF, 0xFFFFE3EB, 0xDFFFFFFF, 0xFFFFC7D7, 0x9FFFFFFF, 0xFFFF8FAF,
+  0x1FFFFFFF, 0xFFFF1F5F, 0x3FFFFFFF, 0xFFFF3FBF, 0xFFFFFCFD, 0xFFFFFFFF,
+  0xFFFFF8FA, 0xFFFFFFFF, 0xFFFFF1F5, 0xFFFFFFFF, 0xFFFFE3EB, 0xFFFFFFFF,
+  0xFFFCFDFC, 0xFFFFFFFF, 0xFFFCFAF8, 0xFFFFFFFF, 0xFFFDF5F0, 0xFFFFFFFF,
+  0xFFFFEBE3, 0xFFFFFFFF, 0xFFDFD7C7, 0xFFFFFFFF, 0xFF9FAF0F, 0xFFFFFFFF,
+  0xFF1F5F1F, 0xFFFFFFFF, 0xFF3FBF3F, 0xFFFFFFFF, 0xFCFDFCFF, 0xFFFFFFFF,
+  0xFCFEF8FE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0x9FBF8FFF, 0xFFFFFFFF, 0x1F5F1F7F, 0xFFFFFFFF,
+  0x3FBF3FFF, 0xFFFFFFFF, 0xFDFCFFFF, 0xFFFFFFFC, 0xFEFCFFFF, 0xFFFFFFFC,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xBF9FFFFF, 0xFFFFFF9F, 0x5F1FFFFF, 0xFFFFFF1F, 0xBF3FFFFF, 0xFFFFFF3F,
+  0xFCFFFFFF, 0xFFFFFCFD, 0xFCFFFFFF, 0xFFFFF8FE, 0xFFFFFFFF, 0xFFFFFFFF,
+  0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x9FFFFFFF, 0xFFFF8FBF,
+  0x1FFFFFFF, 0xFFFF1F5F, 0x3FFFFFFF, 0xFFFF3FBF, 0xFFFFFFFF, 0xFFFCFDFC,
+  0xFFFFFFFF, 0xFEF8FAFC, 0xFFFFFFFF, 0xFFF1F5FD, 0xFFFFFFFF, 0xFFE3EBFF,
+  0xFFFFFFFF, 0xFFC7D7DF, 0xFFFFFFFF, 0xFF8FAF9F, 0xFFFFFFFF, 0x7F1F5F1F,
+  0xFFFFFFFF, 0xFF3FBF3F,
+};
+
+const ChessBitbase_t CHESS_BITBASES[CHESS_BITBASE_COUNT] = {
+  [CHESS_BITBASE_KPK] = {KPK_BLOCKS, KPK_WORDS},
+  [CHESS_BITBASE_KRK] = {KRK_BLOCKS, KRK_WORDS},
+  [CHESS_BITBASE_KQK] = {KQK_BLOCKS, KQK_WORDS},
+};
@@ -0,0 +1,124 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* ROM attack tables for chess_bitboard.h. Every entry is a constant
+ * expression of its indices, so the tables are laid out by the compiler
+ * instead of being filled in at boot or pasted in from a generator. */
+#include "chess_bitboard.h"
+
+#define REP8(M, a)\
+  M(a, 0), M(a, 1), M(a, 2), M(a, 3), M(a, 4), M(a, 5), M(a, 6), M(a, 7)
+#define SQ(r, f) ((r)*8+(f))
+
+/* Leapers. b is the single-bit set of the origin square. */
+#define KNIGHT_SPAN(b)\
+  ((((b)<<17)&BB_NOT_FILE_A)|(((b)<<15)&BB_NOT_FILE_H)\
+  |(((b)<<10)&BB_NOT_FILE_AB)|(((b)<<6)&BB_NOT_FILE_GH)\
+  |(((b)>>17)&BB_NOT_FILE_H)|(((b)>>15)&BB_NOT_FILE_A)\
+  |(((b)>>10)&BB_NOT_FILE_GH)|(((b)>>6)&BB_NOT_FILE_AB))
+#define KING_SPAN(b)\
+  ((((b)<<1)&BB_NOT_FILE_A)|(((b)>>1)&BB_NOT_FILE_H)|((b)<<8)|((b)>>8)\
+  |(((b)<<9)&BB_NOT_FILE_A)|(((b)<<7)&BB_NOT_FILE_H)\
+  |(((b)>>7)&BB_NOT_FILE_A)|(((b)>>9)&BB_NOT_FILE_H))
+#define WHITE_PAWN_SPAN(b)\
+  ((((b)>>7)&BB_NOT_FILE_A)|(((b)>>9)&BB_NOT_FILE_H))
+#define BLACK_PAWN_SPAN(b)\
+  ((((b)<<9)&BB_NOT_FILE_A)|(((b)<<7)&BB_NOT_FILE_H))
+
+#define KNIGHT_ENT(r, f) KNIGHT_SPAN(BB_SQ_BIT(SQ(r, f)))
+#define KING_ENT(r, f) KING_SPAN(BB_SQ_BIT(SQ(r, f)))
+#define WHITE_PAWN_ENT(r, f) WHITE_PAWN_SPAN(BB_SQ_BIT(SQ(r, f)))
+#define BLACK_PAWN_ENT(r, f) BLACK_PAWN_SPAN(BB_SQ_BIT(SQ(r, f)))
+
+const Bitboard_t BB_KNIGHT_ATTACKS[BB_SQUARE_COUNT] = {
+  REP8(KNIGHT_ENT, 0), REP8(KNIGHT_ENT, 1), REP8(KNIGHT_ENT, 2),
+  REP8(KNIGHT_ENT, 3), REP8(KNIGHT_ENT, 4), REP8(KNIGHT_ENT, 5),
+  REP8(KNIGHT_ENT, 6), REP8(KNIGHT_ENT, 7),
+};
+
+const Bitboard_t BB_KING_ATTACKS[BB_SQUARE_COUNT] = {
+  REP8(KING_ENT, 0), REP8(KING_ENT, 1), REP8(KING_ENT, 2), REP8(KING_ENT, 3),
+  REP8(KING_ENT, 4), REP8(KING_ENT, 5), REP8(KING_ENT, 6), REP8(KING_ENT, 7),
+};
+
+const Bitboard_t BB_PAWN_ATTACKS[BB_TEAM_COUNT][BB_SQUARE_COUNT] = {
+  [BB_WHITE_TEAM_IDX] = {
+    REP8(WHITE_PAWN_ENT, 0), REP8(WHITE_PAWN_ENT, 1), REP8(WHITE_PAWN_ENT, 2),
+    REP8(WHITE_PAWN_ENT, 3), REP8(WHITE_PAWN_ENT, 4), REP8(WHITE_PAWN_ENT, 5),
+    REP8(WHITE_PAWN_ENT, 6), REP8(WHITE_PAWN_ENT, 7),
+  },
+  [BB_BLACK_TEAM_IDX] = {
+    REP8(BLACK_PAWN_ENT, 0), REP8(BLACK_PAWN_ENT, 1), REP8(BLACK_PAWN_ENT, 2),
+    REP8(BLACK_PAWN_ENT, 3), REP8(BLACK_PAWN_ENT, 4), REP8(BLACK_PAWN_ENT, 5),
+    REP8(BLACK_PAWN_ENT, 6), REP8(BLACK_PAWN_ENT, 7),
+  },
+};
+
+/* Attacks along an 8-square line for a slider on bit f, given the line's
+ * occupancy o. Toward the high bits, everything up to and including the
+ * lowest blocker. Toward the low bits, everything down to and including the
+ * highest blocker, found by smearing the blockers downward. */
+#define ABOVE(f) ((0xFEU<<(f))&0xFFU)
+#define BELOW(f) ((1U<<(f))-1U)
+#define LSB(x) ((x)&(0U-(x)))
+#define SMEAR1(x) ((x)|((x)>>1))
+#define SMEAR2(x) (SMEAR1(x)|(SMEAR1(x)>>2))
+#define SMEAR_DOWN(x) (SMEAR2(x)|(SMEAR2(x)>>4))
+#define RAY_UP(f, o) (ABOVE(f)&((LSB((o)&ABOVE(f))<<1)-1U))
+#define RAY_DOWN(f, o) (BELOW(f)&~(SMEAR_DOWN((o)&BELOW(f))>>1))
+#define LINE_ATTACKS(f, o) ((RAY_UP(f, o)|RAY_DOWN(f, o))&0xFFU)
+
+/* occ6 holds the inner six squares of the line, so it sits one bit up. */
+#define FIRST_ROW_ENT(f, occ6) ((u8)LINE_ATTACKS(f, (u32)(occ6)<<1))
+
+/* Transposes bit k of a row byte onto row k of FILE_A. */
+#define ROW_BYTE_TO_FILE_A(x)\
+  ((((Bitboard_t)((x)>>0)&1)<<0)|(((Bitboard_t)((x)>>1)&1)<<8)\
+  |(((Bitboard_t)((x)>>2)&1)<<16)|(((Bitboard_t)((x)>>3)&1)<<24)\
+  |(((Bitboard_t)((x)>>4)&1)<<32)|(((Bitboard_t)((x)>>5)&1)<<40)\
+  |(((Bitboard_t)((x)>>6)&1)<<48)|(((Bitboard_t)((x)>>7)&1)<<56))
+#define FILE_A_ENT(r, occ6)\
+  ROW_BYTE_TO_FILE_A(LINE_ATTACKS(r, (u32)(occ6)<<1))
+
+#define OCC6_ROW(M, f, hi)\
+  M(f, hi*8+0), M(f, hi*8+1), M(f, hi*8+2), M(f, hi*8+3),\
+  M(f, hi*8+4), M(f, hi*8+5), M(f, hi*8+6), M(f, hi*8+7)
+#define OCC6_ALL(M, f) {\
+  OCC6_ROW(M, f, 0), OCC6_ROW(M, f, 1), OCC6_ROW(M, f, 2), OCC6_ROW(M, f, 3),\
+  OCC6_ROW(M, f, 4), OCC6_ROW(M, f, 5), OCC6_ROW(M, f, 6), OCC6_ROW(M, f, 7)\
+}
+
+const u8 BB_FIRST_ROW_ATTACKS[CHESS_BOARD_FILE_COUNT][64] = {
+  OCC6_ALL(FIRST_ROW_ENT, 0), OCC6_ALL(FIRST_ROW_ENT, 1),
+  OCC6_ALL(FIRST_ROW_ENT, 2), OCC6_ALL(FIRST_ROW_ENT, 3),
+  OCC6_ALL(FIRST_ROW_ENT, 4), OCC6_ALL(FIRST_ROW_ENT, 5),
+  OCC6_ALL(FIRST_ROW_ENT, 6), OCC6_ALL(FIRST_ROW_ENT, 7),
+};
+
+const Bitboard_t BB_FILE_A_ATTACKS[CHESS_BOARD_ROW_COUNT][64] = {
+  OCC6_ALL(FILE_A_ENT, 0), OCC6_ALL(FILE_A_ENT, 1),
+  OCC6_ALL(FILE_A_ENT, 2), OCC6_ALL(FILE_A_ENT, 3),
+  OCC6_ALL(FILE_A_ENT, 4), OCC6_ALL(FILE_A_ENT, 5),
+  OCC6_ALL(FILE_A_ENT, 6), OCC6_ALL(FILE_A_ENT, 7),
+};
+
+/* a8-h1 runs along file==row, h8-a1 along file+row==7. Every other line is
+ * one of those two shifted up or down whole rows. */
+#define MAIN_DIAG 0x8040201008040201ULL
+#define MAIN_ANTIDIAG 0x0102040810204080ULL
+#define DIAG_ENT(r, f)\
+  ((f)>=(r) ? MAIN_DIAG>>(((f)-(r))*8) : MAIN_DIAG<<(((r)-(f))*8))
+#define ANTIDIAG_ENT(r, f)\
+  ((f)+(r)<=7 ? MAIN_ANTIDIAG>>((7-(f)-(r))*8)\
+              : MAIN_ANTIDIAG<<(((f)+(r)-7)*8))
+
+const Bitboard_t BB_DIAG_MASKS[BB_SQUARE_COUNT] = {
+  REP8(DIAG_ENT, 0), REP8(DIAG_ENT, 1), REP8(DIAG_ENT, 2), REP8(DIAG_ENT, 3),
+  REP8(DIAG_ENT, 4), REP8(DIAG_ENT, 5), REP8(DIAG_ENT, 6), REP8(DIAG_ENT, 7),
+};
+
+const Bitboard_t BB_ANTIDIAG_MASKS[BB_SQUARE_COUNT] = {
+  REP8(ANTIDIAG_ENT, 0), REP8(ANTIDIAG_ENT, 1), REP8(ANTIDIAG_ENT, 2),
+  REP8(ANTIDIAG_ENT, 3), REP8(ANTIDIAG_ENT, 4), REP8(ANTIDIAG_ENT, 5),
+  REP8(ANTIDIAG_ENT, 6), REP8(ANTIDIAG_ENT, 7),
+};
@@ -0,0 +1,71 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+#include <GBAdev_types.h>
+#include <GBAdev_memdef.h>
+#include "chess_clock.h"
+
+#ifndef _HOST_BUILD_
+void ChessClock_Start(void) {
+  const Timer_Handle_t LO = {
+    .cnt_reg = {
+      .fields = {
+        .freq = TIMER_FREQ_1024HZ,
+        .cascade_mode = FALSE,
+        .interrupt_upon_completion = FALSE,
+        .enable = TRUE,
+      }
+    },
+    .data = 0,
+  }, HI = {
+    .cnt_reg = {
+      .fields = {
+        .cascade_mode = TRUE,
+        .interrupt_upon_completion = FALSE,
+        .enable = TRUE,
+      }
+    },
+    .data = 0,
+  };
+  // Stop both before reloading, so the high half starts counting from the
+  // first overflow of the fresh low half. Enable the cascade stage first.
+  REG_TM[CHESS_CLOCK_LO_TIMER].cnt_reg.raw = 0;
+  REG_TM[CHESS_CLOCK_HI_TIMER].cnt_reg.raw = 0;
+  REG_TM[CHESS_CLOCK_HI_TIMER] = HI;
+  REG_TM[CHESS_CLOCK_LO_TIMER] = LO;
+}
+#endif  /* _HOST_BUILD_ */
+
+void ChessGameClock_Init(ChessGameClock_t *clock,
+                         u32 base_seconds,
+                         u32 increment_seconds) {
+  clock->remaining[0] = clock->remaining[1]
+                      = CHESS_CLOCK_SEC_TO_TICKS(base_seconds);
+  clock->increment = CHESS_CLOCK_SEC_TO_TICKS(increment_seconds);
+  clock->turn_start = ChessClock_Ticks();
+}
+
+void ChessGameClock_StartTurn(ChessGameClock_t *clock) {
+  clock->turn_start = ChessClock_Ticks();
+}
+
+BOOL ChessGameClock_EndTurn(ChessGameClock_t *clock, u32 team_idx) {
+  const u32 ELAPSED = ChessClock_Ticks()-clock->turn_start;
+  u32 *const remaining = &clock->remaining[team_idx&1];
+  if (ELAPSED>=*remaining) {
+    *remaining = 0;
+    return FALSE;
+  }
+  *remaining += clock->increment-ELAPSED;
+  return TRUE;
+}
+
+u32 ChessGameClock_MoveBudget(const ChessGameClock_t *clock, u32 team_idx) {
+  const u32 REMAINING = clock->remaining[team_idx&1];
+  u32 budget = REMAINING/CHESS_GAME_CLOCK_MOVES_TO_GO
+              + (clock->increment*3)/4;
+  if (budget>REMAINING/2)
+    budget = REMAINING/2;
+  // A zero budget tells the search to ignore the clock, so never hand one out.
+  return budget ? budget : 1;
+}
@@ -0,0 +1,152 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+
+/* ROM tables for chess_eval.h. Piece-square tables are written the way white
+ * sees the board, a8 first and h1 last, which is also the order squares are
+ * numbered in. Black reads the same tables flipped top to bottom, so there's
+ * only the one copy of each. */
+#include "chess_eval.h"
+
+const i16 EVAL_PIECE_VALUES[EVAL_STAGE_COUNT][EVAL_PIECE_TYPE_COUNT] = {
+  [EVAL_MG] = {
+    [PAWN_IDX] = 100, [KNIGHT_IDX] = 320, [BISHOP_IDX] = 330,
+    [ROOK_IDX] = 500, [QUEEN_IDX] = 900, [KING_IDX] = 0, [EMPTY_IDX] = 0,
+  },
+  [EVAL_EG] = {
+    [PAWN_IDX] = 120, [KNIGHT_IDX] = 300, [BISHOP_IDX] = 320,
+    [ROOK_IDX] = 530, [QUEEN_IDX] = 950, [KING_IDX] = 0, [EMPTY_IDX] = 0,
+  },
+};
+
+/* Knights, bishops, rooks and queens are what make a position a middlegame.
+ * With all of them on the board the weights add up to EVAL_PHASE_MAX. */
+const u8 EVAL_PHASE_WEIGHTS[EVAL_PIECE_TYPE_COUNT] = {
+  [KNIGHT_IDX] = 1, [BISHOP_IDX] = 1, [ROOK_IDX] = 2, [QUEEN_IDX] = 4,
+};
+
+const i16 EVAL_PST[EVAL_STAGE_COUNT][BB_PIECE_TYPE_COUNT][BB_SQUARE_COUNT] = {
+  [EVAL_MG] = {
+    [PAWN_IDX] = {
+        0,   0,   0,   0,   0,   0,   0,   0,
+       50,  50,  50,  50,  50,  50,  50,  50,
+       10,  10,  20,  30,  30,  20,  10,  10,
+        5,   5,  10,  25,  25,  10,   5,   5,
+        0,   0,   0,  20,  20,   0,   0,   0,
+        5,  -5, -10,   0,   0, -10,  -5,   5,
+        5,  10,  10, -20, -20,  10,  10,   5,
+        0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    [KNIGHT_IDX] = {
+      -50, -40, -30, -30, -30, -30, -40, -50,
+      -40, -20,   0,   0,   0,   0, -20, -40,
+      -30,   0,  10,  15,  15,  10,   0, -30,
+      -30,   5,  15,  20,  20,  15,   5, -30,
+      -30,   0,  15,  20,  20,  15,   0, -30,
+      -30,   5,  10,  15,  15,  10,   5, -30,
+      -40, -20,   0,   5,   5,   0, -20, -40,
+      -50, -40, -30, -30, -30, -30, -40, -50,
+    },
+    [BISHOP_IDX] = {
+      -20, -10, -10, -10, -10, -10, -10, -20,
+      -10,   0,   0,   0,   0,   0,   0, -10,
+      -10,   0,   5,  10,  10,   5,   0, -10,
+      -10,   5,   5,  10,  10,   5,   5, -10,
+      -10,   0,  10,  10,  10,  10,   0, -10,
+      -10,  10,  10,  10,  10,  10,  10, -10,
+      -10,   5,   0,   0,   0,   0,   5, -10,
+      -20, -10, -10, -10, -10, -10, -10, -20,
+    },
+    [ROOK_IDX] = {
+        0,   0,   0,   0,   0,   0,   0,   0,
+        5,  10,  10,  10,  10,  10,  10,   5,
+       -5,   0,   0,   0,   0,   0,   0,  -5,
+       -5,   0,   0,   0,   0,   0,   0,  -5,
+       -5,   0,   0,   0,   0,   0,   0,  -5,
+       -5,   0,   0,   0,   0,   0,   0,  -5,
+       -5,   0,   0,   0,   0,   0,   0,  -5,
+        0,   0,   0,   5,   5,   0,   0,   0,
+    },
+    [QUEEN_IDX] = {
+      -20, -10, -10,  -5,  -5, -10, -10, -20,
+      -10,   0,   0,   0,   0,   0,   0, -10,
+      -10,   0,   5,   5,   5,   5,   0, -10,
+       -5,   0,   5,   5,   5,   5,   0,  -5,
+        0,   0,   5,   5,   5,   5,   0,  -5,
+      -10,   5,   5,   5,   5,   5,   0, -10,
+      -10,   0,   5,   0,   0,   0,   0, -10,
+      -20, -10, -10,  -5,  -5, -10, -10, -20,
+    },
+    [KING_IDX] = {
+      -30, -40, -40, -50, -50, -40, -40, -30,
+      -30, -40, -40, -50, -50, -40, -40, -30,
+      -30, -40, -40, -50, -50, -40, -40, -30,
+      -30, -40, -40, -50, -50, -40, -40, -30,
+      -20, -30, -30, -40, -40, -30, -30, -20,
+      -10, -20, -20, -20, -20, -20, -20, -10,
+       20,  20,   0,   0,   0,   0,  20,  20,
+       20,  30,  10,   0,   0,  10,  30,  20,
+    },
+  },
+  [EVAL_EG] = {
+    [PAWN_IDX] = {
+        0,   0,   0,   0,   0,   0,   0,   0,
+       80,  80,  80,  80,  80,  80,  80,  80,
+       50,  50,  50,  50,  50,  50,  50,  50,
+       30,  30,  30,  30,  30,  30,  30,  30,
+       20,  20,  20,  20,  20,  20,  20,  20,
+       10,  10,  10,  10,  10,  10,  10,  10,
+        0,   0,   0,   0,   0,   0,   0,   0,
+        0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    [KNIGHT_IDX] = {
+      -50, -40, -30, -30, -30, -30, -40, -50,
+      -40, -20,   0,   0,   0,   0, -20, -40,
+      -30,   0,  10,  15,  15,  10,   0, -30,
+      -30,   0,  15,  20,  20,  15,   0, -30,
+      -30,   0,  15,  20,  20,  15,   0, -30,
+      -30,   0,  10,  15,  15,  10,   0, -30,
+      -40, -20,   0,   0,   0,   0, -20, -40,
+      -50, -40, -30, -30, -30, -30, -40, -50,
+    },
+    [BISHOP_IDX] = {
+      -20, -10, -10, -10, -10, -10, -10, -20,
+      -10,   0,   0,   0,   0,   0,   0, -10,
+      -10,   0,   5,   5,   5,   5,   0, -10,
+      -10,   0,   5,  10,  10,   5,   0, -10,
+      -10,   0,   5,  10,  10,   5,   0, -10,
+      -10,   0,   5,   5,   5,   5,   0, -10,
+      -10,   0,   0,   0,   0,   0,   0, -10,
+      -20, -10, -10, -10, -10, -10, -10, -20,
+    },
+    [ROOK_IDX] = {
+        0,   0,   0,   0,   0,   0,   0,   0,
+       10,  10,  10,  10,  10,  10,  10,  10,
+        0,   0,   0,   0,   0,   0,   0,   0,
+        0,   0,   0,   0,   0,   0,   0,   0,
+        0,   0,   0,   0,   0,   0,   0,   0,
+        0,   0,   0,   0,   0,   0,   0,   0,
+        0,   0,   0,   0,   0,   0,   0,   0,
+        0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    [QUEEN_IDX] = {
+      -20, -10, -10, -10, -10, -10, -10, -20,
+      -10,   0,   0,   0,   0,   0,   0, -10,
+      -10,   0,  10,  10,  10,  10,   0, -10,
+      -10,   0,  10,  20,  20,  10,   0, -10,
+      -10,   0,  10,  20,  20,  10,   0, -10,
+      -10,   0,  10,  10,  10,  10,   0, -10,
+      -10,   0,   0,   0,   0,   0,   0, -10,
+      -20, -10, -10, -10, -10, -10, -10, -20,
+    },
+    [KING_IDX] = {
+      -50, -40, -30, -20, -20, -30, -40, -50,
+      -30, -20, -10,   0,   0, -10, -20, -30,
+      -30, -10,  20,  30,  30,  20, -10, -30,
+      -30, -10,  30,  40,  40,  30, -10, -30,
+      -30, -10,  30,  40,  40,  30, -10, -30,
+      -30, -10,  20,  30,  30,  20, -10, -30,
+      -30, -30,   0,   0,   0,   0, -30, -30,
+      -50, -30, -30, -30, -30, -30, -30, -50,
+    },
+  },
+};
@@ -5,7 +5,9 @@
 #include <GBAdev_util_macros.h>
 #include <stdlib.h>
 #include "chess_ai.h"
+#include "chess_ai_platform.h"
 #include "chess_board_state.h"
+#include "chess_clock.h"
 #include "debug_io.h"
 #include "graph.h"
 #include "key_status.h"
@@ -22,9 +24,11 @@
 static void ChessGame_AIXHuman_PromotionPrompt(ChessGameCtx_t *ctx,
                                           ChessPiece_Data_t *pawn,
                                           const ChessMoveIteration_t *ai_move);
-static ChessMoveIteration_t ChessGame_AIXHuman_GetMove(ChessGameCtx_t *ctx,
-                                                       ChessAI_Params_t *ai,
-                                                       BOOL retry);
+static ChessMoveIteration_t ChessGame_AIXHuman_GetMove(
+                                                    ChessGameCtx_t *ctx,
+                                                    ChessAI_Params_t *ai,
+                                                    ChessAI_Params_t *ponderer,
+                                                    BOOL retry);
 
 static void ChessGame_AIXHuman_UpdateBoardAndGraph(ChessGameCtx_t *ctx, 
                                          BOOL *promotion_occurred,
@@ -39,8 +43,18 @@ static void ChessGame_RestoreSpritesToCtxLayout(const ChessGameCtx_t *ctx);
 
 #ifdef _AI_VISUALIZE_MOVE_SEARCH_TRAVERSAL_
 extern IWRAM_CODE void ChessAI_SpriteDataFromCtx(const ChessGameCtx_t *ctx);
+/* The traversal visualizer steps the search on keypresses, so it can't
+ * ponder while the human picks a move. */
+#define PONDERER(ai) NULL
+#define ChessGame_AIXHuman_Think(ai, result) ChessAI_Move(ai, result)
 #else
 #define ChessAI_SpriteDataFromCtx(dummy_field)
+#define PONDERER(ai) (ai)
+/* How long the AI searches between VBlanks, leaving the frame's tail to the
+ * rest of the game. */
+#define AI_THINK_SLICE CHESS_CLOCK_MS_TO_TICKS(15)
+static void ChessGame_AIXHuman_Think(ChessAI_Params_t *ai,
+                                     ChessAI_MoveSearch_Result_t *result);
 #endif  /* defined(_AI_VISUALIZE_MOVE_SEARCH_TRAVERSAL_) */
 
 #define PROMOTION_SEL_MASK 3
@@ -112,8 +126,33 @@ void ChessGame_AIXHuman_PromotionPrompt(ChessGameCtx_t *ctx,
                     = (ctx->whose_turn|PROMOTION_SEL[promotion_id]);
 }
 
+#ifndef _AI_VISUALIZE_MOVE_SEARCH_TRAVERSAL_
+void ChessGame_AIXHuman_Think(ChessAI_Params_t *ai,
+                              ChessAI_MoveSearch_Result_t *result) {
+  u16 depth = 0;
+  // Whatever keypress stopped the pondering is old news.
+  ChessAI_Platform_Input_Clear();
+  ChessAI_MoveBegin(ai);
+  while (!ChessAI_MoveStep(ai, AI_THINK_SLICE)) {
+    // Any key hurries the AI along to the best move it has so far.
+    if (ChessAI_Platform_Input_Pending()) {
+      ChessAI_Platform_Input_Clear();
+      ChessAI_MoveAbort(ai);
+    }
+    // A step cut short by a finished iteration didn't use up its slice.
+    if (depth!=ai->completed_depth) {
+      depth = ai->completed_depth;
+      continue;
+    }
+    Vsync();
+  }
+  ChessAI_MoveEnd(ai, result);
+}
+#endif  /* !defined(_AI_VISUALIZE_MOVE_SEARCH_TRAVERSAL_) */
+
 ChessMoveIteration_t ChessGame_AIXHuman_GetMove(ChessGameCtx_t *ctx,
                                                 ChessAI_Params_t *ai,
+                                                ChessAI_Params_t *ponderer,
                                                 BOOL retry) {
   Obj_Attr_t *sels = ctx->obj_data.sels;
   ChessBoard_Idx_t curmove={0}, *move = ctx->move_selections;
@@ -122,7 +161,7 @@ ChessMoveIteration_t ChessGame_AIXHuman_GetMove(ChessGameCtx_t *ctx,
   if (NULL!=ai) {
     ChessAI_MoveSearch_Result_t result;
     ChessAI_SpriteDataFromCtx(ctx);
-    ChessAI_Move(ai, &result);
+    ChessGame_AIXHuman_Think(ai, &result);
     move[0] = BOARD_IDX_CONVERT(result.start, NORMAL_IDX_TYPE);
     move[1] = BOARD_IDX_CONVERT(result.dst, NORMAL_IDX_TYPE);
     ChessGame_RestoreSpritesToCtxLayout(ctx);
@@ -197,7 +236,10 @@ ChessMoveIteration_t ChessGame_AIXHuman_GetMove(ChessGameCtx_t *ctx,
          !sel; 
          OAM_Copy(&OAM_ATTR[SEL_OAM_IDX_OFS + i], &sels[i], 1),
          Vsync()) {
-      IRQ_Sync(IRQ_FLAG(KEYPAD));
+      // Between keypresses, the AI thinks on the human's time. A keypress
+      // that stops it has already been latched into KEY_CURR.
+      if (NULL==ponderer || !ChessAI_Ponder(ponderer))
+        IRQ_Sync(IRQ_FLAG(KEYPAD));
       if ((sel=KEY_STROKE(A))) {
         continue;
       } else if (KEY_STROKE(B)) {
@@ -444,20 +486,44 @@ u32 ChessGame_AIXHuman_Loop(ChessGameCtx_t *ctx,
   int checking_pcs_ct;
   ChessMoveIteration_t move;
   BOOL promotion_occurred, ais_turn;
+#ifdef _CHESS_GAME_CLOCK_
+  ChessGameClock_t clock;
+  ChessGameClock_Init(&clock,
+                      CHESS_GAME_CLOCK_BASE_SECONDS,
+                      CHESS_GAME_CLOCK_INCREMENT_SECONDS);
+#endif  /* _CHESS_GAME_CLOCK_ */
   while (Vsync(), !ret) {
     ais_turn = AI_TEAM_FLAG&ctx->whose_turn;
+#ifdef _CHESS_GAME_CLOCK_
+    ChessGameClock_StartTurn(&clock);
+    if (ais_turn)
+      ai->time_budget
+        = ChessGameClock_MoveBudget(&clock, BB_TEAM_IDX(ctx->whose_turn));
+#endif  /* _CHESS_GAME_CLOCK_ */
     if (ais_turn) {
-      move = ChessGame_AIXHuman_GetMove(ctx, ai, FALSE);
+      move = ChessGame_AIXHuman_GetMove(ctx, ai, NULL, FALSE);
       assert(MOVE_SUCCESSFUL&move.special_flags);
     } else {
-      for (move = ChessGame_AIXHuman_GetMove(ctx, NULL, FALSE)
+      for (move = ChessGame_AIXHuman_GetMove(ctx, NULL, PONDERER(ai),
+                                             FALSE)
             ; ;
-           move = ChessGame_AIXHuman_GetMove(ctx, NULL, TRUE)) {
+           move = ChessGame_AIXHuman_GetMove(ctx, NULL, PONDERER(ai),
+                                             TRUE)) {
         if (MOVE_SUCCESSFUL&move.special_flags)
           break;
         ChessGame_NotifyInvalidDest(ctx->obj_data.sels);
       }
+      // root_state gets rebuilt from the board below, so pondering has to
+      // let go of it first.
+      ChessAI_PonderEnd(ai);
+    }
+#ifdef _CHESS_GAME_CLOCK_
+    // Flagging loses on the spot, before the move ever lands on the board.
+    if (!ChessGameClock_EndTurn(&clock, BB_TEAM_IDX(ctx->whose_turn))) {
+      ret = ctx->whose_turn^PIECE_TEAM_MASK;
+      continue;
     }
+#endif  /* _CHESS_GAME_CLOCK_ */
     ChessGame_AIXHuman_UpdateBoardAndGraph(ctx,
                                            &promotion_occurred,
                                            &move,
@@ -488,6 +554,7 @@ u32 ChessGame_AIXHuman_Loop(ChessGameCtx_t *ctx,
     assert(0==checking_pcs_ct && NULL==checking_pcs);
     ctx->whose_turn ^= PIECE_TEAM_MASK;
     ai->root_state =BoardState_FromCtx(ai->root_state, ctx);
+    ChessAI_RecordGamePosition(ai);
   }
   return ret;
 }
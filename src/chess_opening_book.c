@@ -0,0 +1,76 @@
+/** (C) 17 of October, 2026 Burt Sumner */
+/** Free to use, but this copyright message must remain here */
+#define __TRANSPARENT_BOARD_STATE__
+
+#include <GBAdev_types.h>
+#include <GBAdev_util_macros.h>
+#include "chess_ai_types.h"
+#include "chess_bitboard.h"
+#include "chess_board_state.h"
+#include "chess_board_state_analysis.h"
+#include "chess_move_gen.h"
+#include "chess_opening_book.h"
+#include "debug_io.h"
+
+/* Only needed once a move, so one list does. */
+static EWRAM_BSS ChessMoveList_t g_book_moves;
+
+/* Index of the first entry whose key isn't below (hi, lo). */
+static u32 ChessBook_LowerBound(u32 hi, u32 lo) {
+  u32 first = 0, count = CHESS_OPENING_BOOK_SIZE, half;
+  while (count) {
+    const ChessBook_Entry_t *ent = &CHESS_OPENING_BOOK[first+(half=count>>1)];
+    if (ent->key_hi<hi || (ent->key_hi==hi && ent->key_lo<lo)) {
+      first += half+1;
+      count -= half+1;
+    } else {
+      count = half;
+    }
+  }
+  return first;
+}
+
+BOOL ChessBook_Probe(BoardState_t *state, u32 seed, ChessMove_t *move) {
+  const u32 HI = (u32)(state->zobrist>>32), LO = (u32)state->zobrist;
+  const u32 FIRST = ChessBook_LowerBound(HI, LO),
+            ALLIED_KING = (state->state.side_to_move&WHITE_TO_MOVE_FLAGBIT
+                              ?PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT
+                              :0)|KING,
+            OPP_IDX_OFS = PIECE_ROSTER_ID_WHITE_TEAM_FLAGBIT&~ALLIED_KING;
+  BoardState_Undo_t undo;
+  u32 end, total = 0, pick;
+  TTable_Move_t book_move;
+  for (end = FIRST;
+       CHESS_OPENING_BOOK_SIZE>end
+         && HI==CHESS_OPENING_BOOK[end].key_hi
+         && LO==CHESS_OPENING_BOOK[end].key_lo;
+       ++end)
+    total += CHESS_OPENING_BOOK[end].weight;
+  if (0==total)
+    return FALSE;
+  pick = seed%total;
+  for (end = FIRST; CHESS_OPENING_BOOK[end].weight<=pick; ++end)
+    pick -= CHESS_OPENING_BOOK[end].weight;
+  book_move = CHESS_OPENING_BOOK[end].move;
+
+  // The book keeps no move flags, so take them from the generated move it
+  // matches. No match, or a match that isn't legal, means the key collided
+  // with some other position's.
+  ChessMoveGen_Generate(state, &g_book_moves);
+  for (u32 i = 0; g_book_moves.count>i; ++i) {
+    const ChessMove_t *MV = &g_book_moves.moves[i];
+    BOOL legal;
+    if (book_move!=TTABLE_MOVE_PACK(BB_SQ_FROM_COMPACT(MV->start),
+                                    BB_SQ_FROM_COMPACT(MV->dst),
+                                    MV->promotion))
+      continue;
+    BoardState_MakeMove(state, MV, &undo);
+    legal = !BoardState_KingInCheck(state, ALLIED_KING, OPP_IDX_OFS);
+    BoardState_UnmakeMove(state, &undo);
+    if (!legal)
+      return FALSE;
+    *move = *MV;
+    return TRUE;
+  }
+  return FALSE;
+}
@@ -0,0 +1,772 @@
+//---------------------------------------------------------------
+// Auto-gen'd opening book by bin/host/book_builder. Regenerate with
+// make book instead of editing by hand.
+// ==============================================================
+// Built from: ./host/data/openings.pgn
+// 	Games: 46, Max plies: 20, Min games per move: 1
+//---------------------------------------------------------------
+#include "chess_opening_book.h"
+
+/* {key_lo, key_hi, move, weight} */
+const ChessBook_Entry_t CHESS_OPENING_BOOK[] = {
+  {0x1331BCAAUL, 0x00657353UL, 0x054C,     1},
+  {0x1F1207F2UL, 0x00849687UL, 0x0401,     1},
+  {0x6C4F138AUL, 0x00FB651BUL, 0x08B2,     1},
+  {0x0C48866BUL, 0x01174A2FUL, 0x058E,     1},
+  {0xE9B7E4BDUL, 0x0180BCA8UL, 0x0EC3,     1},
+  {0x8A6CB30FUL, 0x022AF5DFUL, 0x0AB2,     1},
+  {0x155C85B5UL, 0x02AAEE45UL, 0x0AFD,     1},
+  {0x338985C2UL, 0x02B72D45UL, 0x0105,     1},
+  {0xD9080D2EUL, 0x03626DC0UL, 0x06E3,     1},
+  {0xC7D9787AUL, 0x0388C9B7UL, 0x0BB6,     1},
+  {0xA8B8F733UL, 0x03D0D273UL, 0x0B3A,     1},
+  {0x08D65B37UL, 0x03FB22CAUL, 0x0BF7,     1},
+  {0x1607F48BUL, 0x040D01EAUL, 0x0A3A,     1},
+  {0xC6E552DEUL, 0x059AEDE8UL, 0x0EFD,     1},
+  {0xE69A1066UL, 0x05B06B1AUL, 0x0385,     1},
+  {0x3B5B07CEUL, 0x05DF1BA2UL, 0x0FBC,     1},
+  {0xA36746A5UL, 0x06F9694AUL, 0x04CB,     1},
+  {0xCDB4A9A8UL, 0x073C063DUL, 0x0AFD,     1},
+  {0xAA88DC0AUL, 0x081F62F8UL, 0x04E4,     1},
+  {0x1E2BAA12UL, 0x084265D3UL, 0x0BB6,     1},
+  {0x3CA7A1BFUL, 0x086591C1UL, 0x0305,     1},
+  {0x2CA254DAUL, 0x08688D51UL, 0x0FBC,     1},
+  {0x33EB8DFFUL, 0x08763463UL, 0x0AB3,     1},
+  {0x0855F382UL, 0x08DDE27FUL, 0x0184,     1},
+  {0xC32F8D40UL, 0x09DD49A1UL, 0x0E78,     1},
+  {0xC0935CF8UL, 0x0A217BDAUL, 0x0B34,     1},
+  {0xEC5B0452UL, 0x0A9FD294UL, 0x02C1,     1},
+  {0x7A045CE0UL, 0x0AC0A884UL, 0x0184,     1},
+  {0xE299332CUL, 0x0AD4BDB0UL, 0x06D2,     1},
+  {0xF81B4286UL, 0x0B73A452UL, 0x0B7E,     1},
+  {0xB8F5FDE5UL, 0x0B860EFDUL, 0x0546,     1},
+  {0x384C3689UL, 0x0B89A5C6UL, 0x0D3E,     1},
+  {0xB872274AUL, 0x0C5C1AE7UL, 0x0481,     2},
+  {0xB872274AUL, 0x0C5C1AE7UL, 0x04CB,     3},
+  {0xB872274AUL, 0x0C5C1AE7UL, 0x050C,     1},
+  {0x4B80E6A2UL, 0x0C9E8BBEUL, 0x06D4,     1},
+  {0x1DB7DCCDUL, 0x0D5D070CUL, 0x0975,     1},
+  {0xB09A2F73UL, 0x0D628C9FUL, 0x04C3,     1},
+  {0x1AC1974EUL, 0x0D780B34UL, 0x0184,     2},
+  {0xD1E81021UL, 0x0DF9E6E8UL, 0x045B,     1},
+  {0x543A5FB1UL, 0x0E215E9BUL, 0x0F3B,     1},
+  {0x67AFB0D9UL, 0x0E398AEEUL, 0x0F3B,     1},
+  {0xFBAA23B7UL, 0x0ECF1EDAUL, 0x054D,     1},
+  {0x13730C58UL, 0x0EE4DE9DUL, 0x050C,     1},
+  {0xC960B6B7UL, 0x0F45CA29UL, 0x0408,     1},
+  {0xB7A74CD8UL, 0x100675AFUL, 0x0546,     1},
+  {0x4F8A0EDDUL, 0x10814235UL, 0x0FBC,     1},
+  {0x679CF420UL, 0x10A91325UL, 0x0692,     1},
+  {0xAAFC06BEUL, 0x10DEBA8AUL, 0x0242,     1},
+  {0x264E302EUL, 0x11050A9BUL, 0x0CBB,     1},
+  {0xEF59E9FAUL, 0x1119614CUL, 0x048A,     1},
+  {0xCF5F263FUL, 0x1135E0D2UL, 0x050C,     1},
+  {0xADD98654UL, 0x1161C532UL, 0x058E,     1},
+  {0x1DAC0003UL, 0x123C580FUL, 0x0481,     1},
+  {0xC382A66FUL, 0x13CBF8D4UL, 0x07E6,     1},
+  {0x3D51D5C4UL, 0x141EA5E0UL, 0x0CED,     1},
+  {0x653D830CUL, 0x148970C5UL, 0x0ACF,     1},
+  {0x1CAD71F7UL, 0x14DEF050UL, 0x08F3,     1},
+  {0x30A8BE32UL, 0x1566C307UL, 0x068A,     1},
+  {0x50493144UL, 0x15D7B0D5UL, 0x0184,     1},
+  {0x954C8CE8UL, 0x15E0884EUL, 0x0982,     1},
+  {0x13A47C9FUL, 0x1655A497UL, 0x0B7E,     1},
+  {0xA70B62CDUL, 0x16AEC6D0UL, 0x06D3,     1},
+  {0x22197375UL, 0x16DC11D7UL, 0x0FBC,     1},
+  {0x8204FE8CUL, 0x175C491BUL, 0x0449,     1},
+  {0xAA431005UL, 0x176748B9UL, 0x04CB,     1},
+  {0xB01DBE2BUL, 0x1787E5EDUL, 0x092B,     1},
+  {0x5E505B00UL, 0x17C250ACUL, 0x0F6E,     1},
+  {0x21BAE8DAUL, 0x18234BAFUL, 0x048A,     2},
+  {0x21BAE8DAUL, 0x18234BAFUL, 0x04CB,     1},
+  {0x21BAE8DAUL, 0x18234BAFUL, 0x050C,     3},
+  {0x21BAE8DAUL, 0x18234BAFUL, 0x0546,     1},
+  {0x21BAE8DAUL, 0x18234BAFUL, 0x068A,     7},
+  {0x21BAE8DAUL, 0x18234BAFUL, 0x06CB,     1},
+  {0x21BAE8DAUL, 0x18234BAFUL, 0x070C,    12},
+  {0x6AA3C762UL, 0x186C370FUL, 0x0B7E,     1},
+  {0x627402B4UL, 0x18D23CD8UL, 0x08AB,     1},
+  {0x466209A3UL, 0x19036C5DUL, 0x02C1,     1},
+  {0x32764CE1UL, 0x1917E82CUL, 0x0BF7,     1},
+  {0x520FD3ACUL, 0x194D5465UL, 0x0305,     1},
+  {0x2CE6360EUL, 0x19841CA7UL, 0x0481,     1},
+  {0x1F73D966UL, 0x199CC8D2UL, 0x0F27,     1},
+  {0x2203443EUL, 0x1A976E32UL, 0x0AB9,     1},
+  {0x19D6744DUL, 0x1AAD9C61UL, 0x08B2,     7},
+  {0x20B81CE6UL, 0x1ABD015EUL, 0x0385,     1},
+  {0x25E5D504UL, 0x1B669BB4UL, 0x0408,     1},
+  {0x9210C258UL, 0x1B9B1344UL, 0x0AB9,     1},
+  {0x9210C258UL, 0x1B9B1344UL, 0x0B7E,     1},
+  {0x9210C258UL, 0x1B9B1344UL, 0x0BB6,     1},
+  {0x7DEC82ECUL, 0x1BA9953CUL, 0x07BA,     1},
+  {0xB7B49066UL, 0x1BB5A97FUL, 0x0649,     1},
+  {0xBD0C40CEUL, 0x1BD0792FUL, 0x058E,     1},
+  {0x707D964EUL, 0x1C891402UL, 0x0A30,     1},
+  {0x57F53965UL, 0x1CAD9F46UL, 0x054E,     1},
+  {0x8192BF6AUL, 0x1CEECB81UL, 0x048A,     1},
+  {0x8AB0D5F5UL, 0x1CFBCE50UL, 0x08F3,     1},
+  {0x9C2FF6AAUL, 0x1D408F0CUL, 0x0A30,     1},
+  {0x3AC72F0CUL, 0x1D475C61UL, 0x0481,     1},
+  {0x1BCA5568UL, 0x1D7D70D5UL, 0x054C,     1},
+  {0xCCC38FCBUL, 0x1DF2AF7FUL, 0x05CF,     1},
+  {0x4FBAE735UL, 0x1EF3ED10UL, 0x0AB9,     2},
+  {0x84F8C9F2UL, 0x1EF8425EUL, 0x0663,     1},
+  {0x06E1E521UL, 0x1F688445UL, 0x00C4,     1},
+  {0x6551868BUL, 0x1F70E1F1UL, 0x08F3,     1},
+  {0xA7FDB630UL, 0x201086BEUL, 0x0242,     1},
+  {0x0F30B8E9UL, 0x20A032EAUL, 0x02C2,     1},
+  {0x15030950UL, 0x20D22C3DUL, 0x0FBC,     1},
+  {0x8DBDBDA8UL, 0x219C4A8BUL, 0x0B7E,     1},
+  {0x35B69EDCUL, 0x2207DF74UL, 0x0BF7,     1},
+  {0xA02BB26FUL, 0x228B358AUL, 0x06E3,     1},
+  {0xBEE680B9UL, 0x22AE8876UL, 0x045B,     1},
+  {0x133F96AEUL, 0x22B471A7UL, 0x04C5,     1},
+  {0xD8C3FD57UL, 0x22C9DBA7UL, 0x08B2,     6},
+  {0xD8C3FD57UL, 0x22C9DBA7UL, 0x097A,     1},
+  {0x24689FFEUL, 0x238A8C19UL, 0x0306,     1},
+  {0xC3219B96UL, 0x23AC616FUL, 0x0546,     1},
+  {0x38700802UL, 0x23DDCFC3UL, 0x0305,     1},
+  {0x53054B42UL, 0x23FF5482UL, 0x0AB9,     2},
+  {0x53054B42UL, 0x23FF5482UL, 0x0B7E,     1},
+  {0xE760DA0FUL, 0x244F6D90UL, 0x0303,     1},
+  {0x1710AC65UL, 0x24EC22D3UL, 0x06CB,     1},
+  {0xB6DCE26FUL, 0x250B0CE5UL, 0x0CFA,     1},
+  {0xC873A04AUL, 0x2563984DUL, 0x0845,     1},
+  {0x577BB6B7UL, 0x264D47C4UL, 0x0402,     1},
+  {0x6FBF743AUL, 0x26A6332EUL, 0x014B,     1},
+  {0x1E8A1042UL, 0x26F09590UL, 0x0845,     1},
+  {0x8CD7D684UL, 0x2828FF21UL, 0x0546,     1},
+  {0xF8E4CA81UL, 0x28997B6CUL, 0x0242,     1},
+  {0x76A3475DUL, 0x292D60C9UL, 0x04CB,     1},
+  {0xD1C03B55UL, 0x2A12886AUL, 0x0305,     1},
+  {0x649ACB09UL, 0x2A30305EUL, 0x0184,     1},
+  {0x5A7AAAC0UL, 0x2A4C1C70UL, 0x0283,     1},
+  {0x151A6235UL, 0x2A62AC44UL, 0x0449,     1},
+  {0x8B139ADCUL, 0x2AA5BBE3UL, 0x0CF9,     1},
+  {0xC3860081UL, 0x2AE11B48UL, 0x0A60,     2},
+  {0x83A1AE4BUL, 0x2B295CB3UL, 0x00FB,     1},
+  {0x4209BED6UL, 0x2B371BA4UL, 0x0BA5,     1},
+  {0x3161486BUL, 0x2B71D2F2UL, 0x08ED,     1},
+  {0xEA8E7113UL, 0x2BE7220AUL, 0x0D3D,     1},
+  {0x8E8964DFUL, 0x2D87EBA0UL, 0x0845,     1},
+  {0xF0BD7CB5UL, 0x2E0CF74EUL, 0x0AFD,     1},
+  {0x2394398FUL, 0x2E30067AUL, 0x0FBC,     1},
+  {0x41E5CE18UL, 0x2E6B96F0UL, 0x0D73,     1},
+  {0x2ABEAEFAUL, 0x2EE12E3EUL, 0x091B,     1},
+  {0xE600070FUL, 0x2F058CD5UL, 0x049C,     1},
+  {0x62603399UL, 0x2F1F0DF3UL, 0x0502,     1},
+  {0x2AEAE879UL, 0x3010845DUL, 0x0402,     1},
+  {0x9C570A0DUL, 0x3025E5FDUL, 0x068A,     1},
+  {0xBEA85B7CUL, 0x304CFFE4UL, 0x02D5,     1},
+  {0xFD0A4FF4UL, 0x30AE3596UL, 0x0CF9,     1},
+  {0x79F6CF30UL, 0x30CAC77BUL, 0x02C1,     1},
+  {0xB51B152FUL, 0x317EC71CUL, 0x0649,     1},
+  {0x6536479EUL, 0x31B21B3CUL, 0x0909,     1},
+  {0x88FE91BCUL, 0x32399AD5UL, 0x0184,     1},
+  {0xDBDDD12EUL, 0x3250C423UL, 0x0934,     1},
+  {0xE5D9E210UL, 0x3277CF84UL, 0x0546,     2},
+  {0xE575F495UL, 0x32A002E0UL, 0x0AB9,     1},
+  {0xD2A90A87UL, 0x32E3255BUL, 0x0724,     1},
+  {0x35A9C3E5UL, 0x32EEDB9CUL, 0x0CFB,     1},
+  {0x676C2AB2UL, 0x338A4EE1UL, 0x0DBD,     1},
+  {0x278D2632UL, 0x33D1065EUL, 0x0B34,     1},
+  {0x99E2ED6DUL, 0x33D2108EUL, 0x091B,     1},
+  {0xEDF940E5UL, 0x34568A8EUL, 0x0B3A,     1},
+  {0xA99B537DUL, 0x345CDFE8UL, 0x0A30,     1},
+  {0x4416A378UL, 0x346A6A0EUL, 0x0B75,     1},
+  {0xB4522ED2UL, 0x3530D5F9UL, 0x0242,     1},
+  {0xBC3F0EE3UL, 0x353FF05CUL, 0x02C1,     1},
+  {0x02940665UL, 0x354EDC41UL, 0x0B7E,     2},
+  {0x176205B5UL, 0x3634ECEDUL, 0x089B,     1},
+  {0xEDF2CF27UL, 0x36D54E9BUL, 0x0184,     1},
+  {0xD694D5FFUL, 0x3757DAE0UL, 0x07BA,     1},
+  {0x0A4AAE0FUL, 0x3800DBFDUL, 0x0481,     1},
+  {0x1A9AFDBCUL, 0x38544A7AUL, 0x0EBC,     1},
+  {0x1E3A7CDBUL, 0x38B1AD8BUL, 0x0934,     1},
+  {0xCB95BA9BUL, 0x38FE9F11UL, 0x07E7,     1},
+  {0x8C9F9A78UL, 0x3980BAF2UL, 0x08BD,     1},
+  {0x131D9E8CUL, 0x39882678UL, 0x08F3,     1},
+  {0xDDAE6A6BUL, 0x39AEFAD7UL, 0x0CFB,     1},
+  {0x2AA2C1FFUL, 0x3B563ECDUL, 0x055C,     1},
+  {0xECEA60F2UL, 0x3BA73513UL, 0x07BA,     1},
+  {0xECEA60F2UL, 0x3BA73513UL, 0x0B3A,     1},
+  {0xBAA9A380UL, 0x3C216ADBUL, 0x0915,     1},
+  {0xF223D774UL, 0x3C9133D4UL, 0x0502,     1},
+  {0x01E8EF68UL, 0x3CC9F2F0UL, 0x08F3,     1},
+  {0x10945D74UL, 0x3CE06BAEUL, 0x050C,     1},
+  {0xB1DF2FB6UL, 0x3D1E44DEUL, 0x0A30,     1},
+  {0x7E0A6941UL, 0x3D704D18UL, 0x0FBC,     1},
+  {0x569E2320UL, 0x3DA8E3E2UL, 0x021A,     1},
+  {0x62711D1DUL, 0x3DB5FB3CUL, 0x0F3D,     2},
+  {0x4D1FCB96UL, 0x3DD87E97UL, 0x0B7E,     1},
+  {0x2DAE8E03UL, 0x3E15F75CUL, 0x0BB6,     1},
+  {0x02B20C95UL, 0x3E5E9D37UL, 0x06CB,     1},
+  {0x43E2BE79UL, 0x3E8D004EUL, 0x0B75,     1},
+  {0x9C02E366UL, 0x3E909603UL, 0x0385,     2},
+  {0x9C02E366UL, 0x3E909603UL, 0x06CB,     1},
+  {0x3F4E64F4UL, 0x3FC5346CUL, 0x0A30,     1},
+  {0xF58FA07EUL, 0x40CF8846UL, 0x072D,     1},
+  {0xEE267254UL, 0x40DB2548UL, 0x0AF3,     1},
+  {0x1A476CA6UL, 0x41060366UL, 0x08A8,     1},
+  {0x0C614EE2UL, 0x4159EB05UL, 0x02C1,     1},
+  {0x66E64D14UL, 0x41D87AB4UL, 0x00FB,     1},
+  {0x3A64A027UL, 0x42128A9FUL, 0x08BD,     1},
+  {0xECBA7378UL, 0x42C73A3EUL, 0x0546,     2},
+  {0x651286F5UL, 0x43197ED1UL, 0x0CBB,     1},
+  {0xF0039D87UL, 0x4362D6EAUL, 0x0AFD,     1},
+  {0x7E67A674UL, 0x43F0EC11UL, 0x0B7E,     1},
+  {0x5D54131FUL, 0x44111F56UL, 0x0AFD,     1},
+  {0x425AFB65UL, 0x4425D722UL, 0x0A63,     1},
+  {0x77CC9870UL, 0x445BF6F1UL, 0x0724,     1},
+  {0x77CC9870UL, 0x445BF6F1UL, 0x0AB9,     1},
+  {0x77CC9870UL, 0x445BF6F1UL, 0x0CF9,     1},
+  {0x5856B8F8UL, 0x450443FDUL, 0x058E,     1},
+  {0xA4BDDC65UL, 0x451A9421UL, 0x0EBC,     1},
+  {0x336F8803UL, 0x45BA683EUL, 0x0F3D,     1},
+  {0x11CAD8B2UL, 0x45CF451CUL, 0x0621,     1},
+  {0x8F5F9D81UL, 0x45EF0759UL, 0x0052,     1},
+  {0x8F5F9D81UL, 0x45EF0759UL, 0x0612,     1},
+  {0xEC4CB34EUL, 0x461EEB1CUL, 0x0CA2,     1},
+  {0x36697CC5UL, 0x466C977FUL, 0x0CF9,     1},
+  {0x1BCDC98BUL, 0x46F42C4EUL, 0x068A,     1},
+  {0x4C6B0A26UL, 0x47B0A0A8UL, 0x0FBC,     1},
+  {0xEF2605A7UL, 0x47D858E1UL, 0x0481,     9},
+  {0xEF2605A7UL, 0x47D858E1UL, 0x0546,     1},
+  {0x90258A77UL, 0x47DAA234UL, 0x04A3,     1},
+  {0x90901782UL, 0x47F8DA58UL, 0x0B34,     1},
+  {0xF2EA24D7UL, 0x486C0C2CUL, 0x0BB6,     1},
+  {0x0562393EUL, 0x49CA23EAUL, 0x0A63,     1},
+  {0x4B97AC57UL, 0x4A0A2ACBUL, 0x0184,     1},
+  {0xAB2A978EUL, 0x4A40DAC5UL, 0x058C,     1},
+  {0x3CD427EBUL, 0x4A619BA1UL, 0x0B3A,     1},
+  {0xCBE1AD33UL, 0x4AB10953UL, 0x0DBD,     1},
+  {0x81B7AFCCUL, 0x4AC879ACUL, 0x0845,     1},
+  {0xF75A8FFAUL, 0x4B508CD0UL, 0x0AF3,     1},
+  {0x0409976AUL, 0x4B5A9D2EUL, 0x04CB,     1},
+  {0x0B741757UL, 0x4BEC5D8BUL, 0x0AF3,     1},
+  {0x4C1C2809UL, 0x4D294E74UL, 0x09F7,     1},
+  {0x74F1758DUL, 0x4E7FD8CAUL, 0x0DBD,     1},
+  {0xD8F64410UL, 0x4EAA9C66UL, 0x0B3A,     1},
+  {0x8DD06D89UL, 0x4ED1124EUL, 0x0481,     1},
+  {0x4A5C84ACUL, 0x5045A48DUL, 0x0742,     1},
+  {0x53621CD8UL, 0x50E6E1BFUL, 0x0FBC,     1},
+  {0x02B1B188UL, 0x50ED9C52UL, 0x05CF,     1},
+  {0xDB77C954UL, 0x50F7F08FUL, 0x0AB1,     1},
+  {0x3B97DFF7UL, 0x528988F8UL, 0x0AF3,     1},
+  {0x265DD557UL, 0x52EA7E32UL, 0x0724,     1},
+  {0x265DD557UL, 0x52EA7E32UL, 0x0AB9,     1},
+  {0x5ACACCAFUL, 0x53986C5CUL, 0x058E,     1},
+  {0x14D52B0BUL, 0x53D0FDDFUL, 0x072D,     1},
+  {0x2546325AUL, 0x53DE117FUL, 0x06CB,     1},
+  {0xCA5079FEUL, 0x549DC330UL, 0x0B75,     1},
+  {0xCA5079FEUL, 0x549DC330UL, 0x0B7E,     1},
+  {0xEC3295F3UL, 0x550CF81AUL, 0x08AA,     1},
+  {0x5343E315UL, 0x552BD5DDUL, 0x068A,     1},
+  {0x2F0587B7UL, 0x557F37B4UL, 0x0A71,     1},
+  {0x59C1C09CUL, 0x56036CEFUL, 0x048A,     1},
+  {0x63B415A1UL, 0x5622E7A5UL, 0x0649,     1},
+  {0xC7F85D4CUL, 0x562BA07CUL, 0x050C,     1},
+  {0x48FE7A55UL, 0x574613D2UL, 0x09BB,     1},
+  {0x70820784UL, 0x579DD9EEUL, 0x0489,     1},
+  {0xDE433723UL, 0x582CDE3FUL, 0x0B5C,     1},
+  {0x8A4906A6UL, 0x58BDCAECUL, 0x0CFB,     1},
+  {0xB9D10B37UL, 0x58C01CF5UL, 0x0852,     1},
+  {0x46FF169FUL, 0x58D3F810UL, 0x07BA,     1},
+  {0x055C88A3UL, 0x58F22C37UL, 0x050C,     1},
+  {0x8D021DC9UL, 0x58F9B3F7UL, 0x06E4,     1},
+  {0x8AE605CDUL, 0x5979363AUL, 0x08EA,     1},
+  {0x52DDBD47UL, 0x59D1BEC1UL, 0x0B7B,     1},
+  {0xD12E15DCUL, 0x5AB30BF3UL, 0x0184,     1},
+  {0x1D5CF499UL, 0x5AE14FCBUL, 0x0AA1,     1},
+  {0xFA8DA4B9UL, 0x5AE58734UL, 0x0408,     3},
+  {0xFA8DA4B9UL, 0x5AE58734UL, 0x0546,     1},
+  {0xB473D6F5UL, 0x5AFB0BD3UL, 0x02DC,     1},
+  {0x988756A1UL, 0x5B17239EUL, 0x0385,     1},
+  {0xD85B4084UL, 0x5B24DDACUL, 0x0B7E,     1},
+  {0xF10E947DUL, 0x5B28D4C5UL, 0x0449,     1},
+  {0x62A339CBUL, 0x5B469A37UL, 0x08DC,     1},
+  {0x4E00E5FCUL, 0x5CA3EBD8UL, 0x0546,     3},
+  {0x644008A0UL, 0x5CC58DE5UL, 0x0526,     1},
+  {0x549EBAA9UL, 0x5D5C6BDCUL, 0x0305,     1},
+  {0x504C2EB1UL, 0x5D98EAAEUL, 0x0F3D,     1},
+  {0xE34BC9BEUL, 0x5DDF2520UL, 0x0AFC,     1},
+  {0x7056482FUL, 0x5E074EBFUL, 0x08DC,     1},
+  {0x579AC23FUL, 0x5E10D8F5UL, 0x0B34,     1},
+  {0x37D44DBEUL, 0x5E2C840BUL, 0x0BB6,     1},
+  {0x54B4384DUL, 0x5EC7BC90UL, 0x0934,     1},
+  {0x38F9C584UL, 0x5EF3BE52UL, 0x059D,     1},
+  {0x296A2518UL, 0x5F0430A2UL, 0x02C1,     1},
+  {0xBA812B19UL, 0x5F94A6ADUL, 0x048A,     1},
+  {0x6DBCC668UL, 0x5FA2DA67UL, 0x0546,     1},
+  {0x23BDDB5CUL, 0x5FA8F8BFUL, 0x0AB9,     3},
+  {0x6226B737UL, 0x5FF98B79UL, 0x0A39,     1},
+  {0x22F97CE7UL, 0x601B7B03UL, 0x0A19,     1},
+  {0x9F720F3FUL, 0x61578DC7UL, 0x0A71,     1},
+  {0x32F2F70FUL, 0x6200525FUL, 0x0B7E,     1},
+  {0xFA6FCC04UL, 0x633564ACUL, 0x0CFA,     1},
+  {0x7D43D2AAUL, 0x6372EDC5UL, 0x0819,     1},
+  {0x98FEE7B8UL, 0x64EFDC55UL, 0x0742,     1},
+  {0xD0468D02UL, 0x655C67D1UL, 0x08B2,     1},
+  {0x0DBE1BE9UL, 0x659457F7UL, 0x09B6,     1},
+  {0xFA93EC76UL, 0x65C38AC4UL, 0x0B73,     1},
+  {0xBB5A457DUL, 0x65FE8848UL, 0x074D,     1},
+  {0xC4DF57EEUL, 0x66FD578DUL, 0x072D,     1},
+  {0xBA0F51EEUL, 0x670B6C7AUL, 0x0B3A,     1},
+  {0x31BC2C26UL, 0x6787D42EUL, 0x0408,     1},
+  {0xC8B22773UL, 0x678C96D5UL, 0x054B,     1},
+  {0xE31331AAUL, 0x68BECD34UL, 0x0A30,     1},
+  {0x5DC921CFUL, 0x68CDE3A0UL, 0x0612,     1},
+  {0x40651062UL, 0x69825AE8UL, 0x06E3,     1},
+  {0xB9D86FF3UL, 0x69E1C27FUL, 0x0F2D,     1},
+  {0x36408A57UL, 0x6A3D5E4DUL, 0x0FBC,     1},
+  {0xDB367B4DUL, 0x6AD1DEB7UL, 0x08F3,     1},
+  {0x397E0FFFUL, 0x6AF9A57FUL, 0x0B7E,     1},
+  {0x058B5194UL, 0x6B785F24UL, 0x02C2,     1},
+  {0x9F253F55UL, 0x6BF167CDUL, 0x0B7E,     1},
+  {0x39773B75UL, 0x6CC62A6FUL, 0x06CB,     1},
+  {0xFCC4B6C5UL, 0x6CECF767UL, 0x058E,     1},
+  {0x4A2624EFUL, 0x6D88197AUL, 0x06EA,     1},
+  {0xF43FDE98UL, 0x6DA6E502UL, 0x0AB9,     1},
+  {0x7DDF2AABUL, 0x6DA7DFE7UL, 0x02C1,     1},
+  {0x6248EA1AUL, 0x6DA9825FUL, 0x0B9F,     1},
+  {0x844C478CUL, 0x6DAC174EUL, 0x0B7E,     1},
+  {0x29359E54UL, 0x6F11712FUL, 0x0321,     1},
+  {0x5DD1324AUL, 0x6FA2E11DUL, 0x0FBC,     1},
+  {0x960B605AUL, 0x6FEA9766UL, 0x050C,     1},
+  {0xCA0707E8UL, 0x7054DF28UL, 0x0105,     1},
+  {0x7CA4B84BUL, 0x70997FE0UL, 0x06E4,     1},
+  {0xF5F224DDUL, 0x70AAFE07UL, 0x0CF9,     1},
+  {0x7415B913UL, 0x7107A65AUL, 0x0AFB,     1},
+  {0xD8D03E40UL, 0x7159B9A3UL, 0x04C5,     1},
+  {0xED4BA684UL, 0x72D2A02DUL, 0x04CB,     2},
+  {0x9E3C851DUL, 0x72DA800BUL, 0x0742,     1},
+  {0xB2CE1FF0UL, 0x731D1439UL, 0x09C3,     1},
+  {0x28E8514EUL, 0x73FD1F2FUL, 0x0AA1,     1},
+  {0xB45FB67CUL, 0x74039D13UL, 0x0692,     1},
+  {0x28D251ACUL, 0x743EF8DAUL, 0x074D,     1},
+  {0xD6B5C58AUL, 0x74607A9FUL, 0x08F3,     1},
+  {0x83E3D657UL, 0x74F487C4UL, 0x0713,     1},
+  {0x42708A34UL, 0x7548E6B6UL, 0x0B3A,     1},
+  {0xA803F703UL, 0x75942716UL, 0x068A,     1},
+  {0xE3A6067EUL, 0x7599A242UL, 0x00C4,     1},
+  {0x6D13D6B0UL, 0x76104C1FUL, 0x04CB,     1},
+  {0x2D84A36CUL, 0x76B85DDAUL, 0x0662,     1},
+  {0xED1388D8UL, 0x76C0B7EAUL, 0x0CFB,     1},
+  {0x987E23A9UL, 0x774A592BUL, 0x0649,     2},
+  {0xBE3D66C7UL, 0x7864F4ABUL, 0x0AA1,     1},
+  {0x02F6C8A5UL, 0x78A07760UL, 0x0D3B,     1},
+  {0x59CEC8ACUL, 0x7934585EUL, 0x0A63,     1},
+  {0x837A2FC8UL, 0x7A04333AUL, 0x0443,     1},
+  {0xF6D9EFCEUL, 0x7A268F81UL, 0x0242,     1},
+  {0xDAD19242UL, 0x7A3F366AUL, 0x0546,     1},
+  {0xDAD19242UL, 0x7A3F366AUL, 0x0685,     2},
+  {0x2DAFFA62UL, 0x7AA37DF8UL, 0x0845,     1},
+  {0xA2F615AFUL, 0x7AB97D66UL, 0x0755,     1},
+  {0x30AC2D85UL, 0x7ABF8419UL, 0x089A,     1},
+  {0x9DBC7C04UL, 0x7BAF008EUL, 0x0184,     1},
+  {0xA7768373UL, 0x7BE90A78UL, 0x06CB,     1},
+  {0xCB5331B9UL, 0x7C41CEE8UL, 0x092A,     1},
+  {0x06086CA4UL, 0x7C523042UL, 0x06E3,     1},
+  {0x0F0D6031UL, 0x7C5A8642UL, 0x0CFB,     1},
+  {0x4A16446EUL, 0x7C667A3DUL, 0x0B7E,     1},
+  {0x36F3F926UL, 0x7C905DB1UL, 0x0934,     2},
+  {0xBF48C232UL, 0x7CF43E79UL, 0x050C,     1},
+  {0x14EF21CCUL, 0x7DBE5DBEUL, 0x0546,     1},
+  {0x254E1CCEUL, 0x7DC831F0UL, 0x0DBD,     1},
+  {0x17B232FBUL, 0x7E32FB03UL, 0x05EC,     1},
+  {0xFB0E72B2UL, 0x7E35721FUL, 0x08DA,     1},
+  {0x7309583BUL, 0x7E58B12CUL, 0x0408,     1},
+  {0xB532B981UL, 0x7EA79E5AUL, 0x0FBC,     1},
+  {0xA6CF9A35UL, 0x7F7A2848UL, 0x0B3A,     1},
+  {0x05733BE8UL, 0x7F87E9DCUL, 0x068A,     1},
+  {0x05733BE8UL, 0x7F87E9DCUL, 0x070C,     1},
+  {0xF005DF0FUL, 0x7FCB83ACUL, 0x050C,     1},
+  {0xF005DF0FUL, 0x7FCB83ACUL, 0x089B,     1},
+  {0x7FA0C673UL, 0x800A857BUL, 0x0CFA,     1},
+  {0xE1148F9CUL, 0x801B5EF7UL, 0x0D3D,     1},
+  {0xEA61EB05UL, 0x8025F3EEUL, 0x092A,     1},
+  {0xBBFF8E7FUL, 0x815F89E2UL, 0x0283,     1},
+  {0xAB0C267CUL, 0x81805EDBUL, 0x05CF,     1},
+  {0x74A1855CUL, 0x81C4025CUL, 0x08BD,     1},
+  {0x28BB98D5UL, 0x824D75B6UL, 0x0A71,     1},
+  {0xDA5C5F32UL, 0x82DE4149UL, 0x0385,     1},
+  {0x91E463D3UL, 0x83CB7509UL, 0x06D5,     1},
+  {0x52EE615BUL, 0x83F77CDAUL, 0x0D22,     1},
+  {0xCE7B5FDBUL, 0x8403B8FCUL, 0x05CE,     1},
+  {0x078523B0UL, 0x84161947UL, 0x0EBC,     1},
+  {0x02A000CDUL, 0x8448B22AUL, 0x0AB2,     1},
+  {0x25F0F693UL, 0x85124344UL, 0x0B66,     1},
+  {0xE9CE3471UL, 0x85B84A9DUL, 0x048B,     1},
+  {0xC4E4F369UL, 0x86F945D2UL, 0x0184,     1},
+  {0xA5454B0AUL, 0x877F1892UL, 0x0FBC,     1},
+  {0x6C6C09BEUL, 0x878E8365UL, 0x0AB9,     1},
+  {0xDBD971A1UL, 0x879A1FA2UL, 0x08DA,     1},
+  {0x687F73CDUL, 0x87ADE6DDUL, 0x04CB,     1},
+  {0x20B9BAC2UL, 0x888378A9UL, 0x0A30,     1},
+  {0x3EE34F33UL, 0x88EC8FB7UL, 0x0401,     1},
+  {0x7D08203DUL, 0x890570C6UL, 0x048B,     1},
+  {0xD6EFCA13UL, 0x89405B4EUL, 0x0184,     1},
+  {0x90858104UL, 0x898D7930UL, 0x0CBB,     1},
+  {0xC6D113AEUL, 0x89A48CFDUL, 0x0753,     1},
+  {0x34F1AFC7UL, 0x89C1BF39UL, 0x0AFD,     1},
+  {0xE74843D7UL, 0x8A5F1818UL, 0x06CB,     3},
+  {0xF4BFEC5BUL, 0x8AE115C0UL, 0x048B,     1},
+  {0x228F5019UL, 0x8BC4F4CAUL, 0x02C1,     1},
+  {0x457E7371UL, 0x8BDEF491UL, 0x0B7E,     1},
+  {0x0804CE78UL, 0x8C46D181UL, 0x08BD,     1},
+  {0x8B40C0FFUL, 0x8C5F9F45UL, 0x0AF3,     1},
+  {0x58611F42UL, 0x8D3F80ADUL, 0x0EBC,     1},
+  {0x01C2B979UL, 0x8DB92C01UL, 0x08ED,     1},
+  {0xEEE37DD3UL, 0x8DF402F8UL, 0x06CB,     1},
+  {0x39F981B7UL, 0x8E038901UL, 0x08B2,     2},
+  {0x39F981B7UL, 0x8E038901UL, 0x08F3,    15},
+  {0x39F981B7UL, 0x8E038901UL, 0x0934,    27},
+  {0x39F981B7UL, 0x8E038901UL, 0x0975,     1},
+  {0x39F981B7UL, 0x8E038901UL, 0x0B7E,     1},
+  {0xA81AA042UL, 0x8E03D570UL, 0x0481,     1},
+  {0x3FCDB7B2UL, 0x8E04A874UL, 0x08B2,     1},
+  {0x650B7BD9UL, 0x8ECB66AFUL, 0x06CB,     1},
+  {0x991F3FCEUL, 0x8EF46DFFUL, 0x0306,     1},
+  {0x9EBAB5F6UL, 0x8F56E578UL, 0x0AB2,     1},
+  {0x4749D345UL, 0x8F796C54UL, 0x0B34,     1},
+  {0x46EEA7C8UL, 0x8FC1D1D1UL, 0x0982,     1},
+  {0x6E3D936EUL, 0x9047625BUL, 0x0408,     1},
+  {0x9A0B5DE8UL, 0x9053C05FUL, 0x0385,     1},
+  {0x19A9FCA5UL, 0x90A50E6AUL, 0x06CC,     1},
+  {0x9FE04818UL, 0x91622E83UL, 0x0662,     1},
+  {0xCCCFEDCAUL, 0x9248DB2FUL, 0x0184,     1},
+  {0xB1E8FF9CUL, 0x928FED39UL, 0x099E,     1},
+  {0x26BBCA61UL, 0x92E2F2FDUL, 0x0306,     1},
+  {0x31873D23UL, 0x932EF49DUL, 0x0408,     1},
+  {0x2D368AEAUL, 0x93B5ED5CUL, 0x06E2,     1},
+  {0xA49B449FUL, 0x94037AF3UL, 0x08ED,     1},
+  {0x552AC61BUL, 0x9410B62FUL, 0x0CA2,     1},
+  {0xAC4A6382UL, 0x94B392A2UL, 0x0321,     1},
+  {0xECCC375DUL, 0x94D8070CUL, 0x089B,     1},
+  {0xD946C015UL, 0x954977E2UL, 0x0481,     1},
+  {0x57114F7CUL, 0x962ED641UL, 0x0AB9,     1},
+  {0x9AB0E1EBUL, 0x96E61C0BUL, 0x06CC,     1},
+  {0x1D86C66EUL, 0x96FD5D1EUL, 0x06CB,     1},
+  {0x9243AEE8UL, 0x97003CE6UL, 0x07BA,     1},
+  {0xB0E09BA4UL, 0x97471302UL, 0x0AB9,     1},
+  {0x1245CBBFUL, 0x97939BB8UL, 0x0CFB,     1},
+  {0x7D78C3AFUL, 0x97DBCD76UL, 0x06A3,     1},
+  {0xF4BECAC9UL, 0x98EF2667UL, 0x02C2,     1},
+  {0xF399B64AUL, 0x9A05C09FUL, 0x0975,     1},
+  {0xF399B64AUL, 0x9A05C09FUL, 0x0AB9,     1},
+  {0xF399B64AUL, 0x9A05C09FUL, 0x0B7E,    10},
+  {0xB006C995UL, 0x9A0C8FB9UL, 0x0283,     1},
+  {0xC69C94E9UL, 0x9AAF057BUL, 0x0184,     1},
+  {0xFBF37EA6UL, 0x9BB1A1D8UL, 0x08DC,     1},
+  {0xD6349F68UL, 0x9C891CEBUL, 0x0D3E,     1},
+  {0x68EF5D42UL, 0x9C990C50UL, 0x0546,     1},
+  {0x56DB9762UL, 0x9CDEC96EUL, 0x070C,     1},
+  {0xB6D90EF0UL, 0x9CEE90DBUL, 0x06CB,     2},
+  {0x4373D2D2UL, 0x9D140AFAUL, 0x050C,     1},
+  {0x33162220UL, 0x9DA32BEEUL, 0x0975,     1},
+  {0xB5C2E9FDUL, 0x9DDAFF96UL, 0x0BB6,     1},
+  {0x7E808C47UL, 0x9E204950UL, 0x08DA,     1},
+  {0x62D81599UL, 0x9E2D746FUL, 0x089B,     1},
+  {0x1309BB7BUL, 0x9E6A4826UL, 0x0608,     1},
+  {0xB8789DB2UL, 0x9EE69648UL, 0x0E78,     1},
+  {0x21476C10UL, 0x9F58789EUL, 0x0FBC,     1},
+  {0x42E0336BUL, 0xA044EA75UL, 0x0385,     1},
+  {0xDD9766A4UL, 0xA04978DAUL, 0x02D5,     1},
+  {0x22F697E8UL, 0xA090B418UL, 0x0AB9,     1},
+  {0xDF93DB71UL, 0xA1209A3AUL, 0x092C,     1},
+  {0xACE05075UL, 0xA13FA478UL, 0x0915,     1},
+  {0x56A9F783UL, 0xA1BBE243UL, 0x0385,     1},
+  {0x570FF3ABUL, 0xA2960750UL, 0x0184,     1},
+  {0x693EEB44UL, 0xA29A856AUL, 0x0F3B,     1},
+  {0x55F9E01FUL, 0xA2A059A3UL, 0x0B3A,     1},
+  {0xA9F3E0D2UL, 0xA2C2C486UL, 0x0725,     1},
+  {0xF973BAF2UL, 0xA36E06F9UL, 0x0FBC,     1},
+  {0xB337F62AUL, 0xA39F977BUL, 0x068A,     1},
+  {0x2ED172EEUL, 0xA3FEAB65UL, 0x08F3,     1},
+  {0xC39EB843UL, 0xA470068DUL, 0x091B,     1},
+  {0xEAD5E87FUL, 0xA498B176UL, 0x0D2B,     1},
+  {0x90409559UL, 0xA4AC59D1UL, 0x0D3D,     1},
+  {0xC3CE7EFDUL, 0xA4BE41C3UL, 0x0B75,     1},
+  {0x4355EBEAUL, 0xA50DB363UL, 0x0BF7,     1},
+  {0x83CFC798UL, 0xA51A19EAUL, 0x048A,     1},
+  {0xAB38931AUL, 0xA5E0C131UL, 0x0499,     1},
+  {0xC55A016FUL, 0xA60E1780UL, 0x08F3,     1},
+  {0x752B58A2UL, 0xA617FE4EUL, 0x0CA0,     1},
+  {0x70B45106UL, 0xA6994F84UL, 0x0D3B,     1},
+  {0xA996D241UL, 0xA6DEB660UL, 0x0184,     1},
+  {0x8985D5DEUL, 0xA74D47C7UL, 0x0D3E,     1},
+  {0x8AAF79EFUL, 0xA76D5629UL, 0x02D5,     1},
+  {0x9FC59C25UL, 0xA7D9AB44UL, 0x0B7E,     1},
+  {0x855BB168UL, 0xA9447C28UL, 0x08B2,     1},
+  {0x4EA3F9B0UL, 0xA94A1496UL, 0x0AB2,     1},
+  {0x3FFE8756UL, 0xA95DFB6AUL, 0x0499,     1},
+  {0x3C2D94D5UL, 0xA9C27348UL, 0x0B34,     1},
+  {0x261ACBF1UL, 0xA9ED39E3UL, 0x0649,     1},
+  {0x7FE75A96UL, 0xAA7DC166UL, 0x04C5,     1},
+  {0x68D7D959UL, 0xAAA4F5B9UL, 0x0502,     1},
+  {0xB6494B30UL, 0xAAB99E6CUL, 0x0499,     1},
+  {0xB6494B30UL, 0xAAB99E6CUL, 0x0819,     2},
+  {0x1F91B741UL, 0xAAC342F7UL, 0x0AB9,     3},
+  {0xAE6A7430UL, 0xAB643C03UL, 0x0FBC,     1},
+  {0x2F03B81AUL, 0xAC6A6716UL, 0x06C3,     1},
+  {0xAB1CF604UL, 0xAC852E1BUL, 0x0FBC,     1},
+  {0x9D4A6C2DUL, 0xACE7BE53UL, 0x08F3,     1},
+  {0x8318B686UL, 0xADC9A935UL, 0x0305,     1},
+  {0xFFEDA867UL, 0xADFAFBF1UL, 0x072D,     1},
+  {0x067915B6UL, 0xAE916F25UL, 0x0A9B,     1},
+  {0xFD33F40BUL, 0xAED0E1EBUL, 0x067D,     4},
+  {0xFD33F40BUL, 0xAED0E1EBUL, 0x08BD,     3},
+  {0xFD33F40BUL, 0xAED0E1EBUL, 0x08F3,     1},
+  {0xFD33F40BUL, 0xAED0E1EBUL, 0x0AB9,     1},
+  {0x099E4B45UL, 0xAF3CCA58UL, 0x0305,     1},
+  {0xBBED5580UL, 0xAF517D2CUL, 0x0DBD,     1},
+  {0xB8689ECFUL, 0xAF979CEEUL, 0x0692,     1},
+  {0x83D6ACFDUL, 0xAFAA9993UL, 0x0FBC,     1},
+  {0xBF1C81F1UL, 0xB0000BD4UL, 0x08BD,     1},
+  {0xCEBBC7E3UL, 0xB00F2868UL, 0x0BF7,     2},
+  {0x98F3F461UL, 0xB0718F30UL, 0x0481,     1},
+  {0x09FE8FBEUL, 0xB0764F13UL, 0x070C,     1},
+  {0x4E9E50E5UL, 0xB113EADEUL, 0x0DBD,     1},
+  {0x065B6EE8UL, 0xB154939FUL, 0x0FBC,     1},
+  {0x70DA0265UL, 0xB197E109UL, 0x0685,     1},
+  {0xBEB7571AUL, 0xB1B8F1CEUL, 0x072D,     1},
+  {0x42D7B4FDUL, 0xB213CB8DUL, 0x0649,     1},
+  {0x3D4379AAUL, 0xB220E087UL, 0x05F3,     1},
+  {0x8AB4D3B7UL, 0xB2370F18UL, 0x0B7E,     1},
+  {0x5C92CEFFUL, 0xB27146C8UL, 0x08F3,     3},
+  {0xE00F731EUL, 0xB27A847AUL, 0x0184,     1},
+  {0xAB7636FCUL, 0xB2FA6A1CUL, 0x059D,     1},
+  {0xA4658117UL, 0xB30EF567UL, 0x0449,     1},
+  {0xF52C8ED8UL, 0xB37A3D0EUL, 0x0546,     1},
+  {0x41551C43UL, 0xB3E0CDACUL, 0x0305,     1},
+  {0x81AECB7DUL, 0xB3FCD93AUL, 0x0FBC,     1},
+  {0x6BF5F29AUL, 0xB47223B0UL, 0x0546,     1},
+  {0xBD2B21C5UL, 0xB4A79311UL, 0x06E2,     1},
+  {0xBD2B21C5UL, 0xB4A79311UL, 0x07BA,     1},
+  {0x3FE37995UL, 0xB4C332BCUL, 0x0305,     1},
+  {0x7EEF5F65UL, 0xB4EA0FD9UL, 0x0830,     1},
+  {0x2D0FF111UL, 0xB4F4A6FCUL, 0x0845,     1},
+  {0x22776D93UL, 0xB5271323UL, 0x0184,     1},
+  {0x0AA99325UL, 0xB5964E2CUL, 0x0BB6,     1},
+  {0xF7ABEAF4UL, 0xB5C78E5CUL, 0x0105,     1},
+  {0x10A7A465UL, 0xB5C914E2UL, 0x0AE2,     1},
+  {0x37F258D4UL, 0xB5EDE491UL, 0x06E2,     1},
+  {0x80044795UL, 0xB62520EAUL, 0x0AB9,     1},
+  {0x839A8CB8UL, 0xB62CFFB3UL, 0x0283,     1},
+  {0x25C1BC12UL, 0xB7243D01UL, 0x0481,     1},
+  {0x538D9A10UL, 0xB7307FE4UL, 0x0871,     1},
+  {0x4047E2ECUL, 0xB7C5F2A0UL, 0x06D3,     1},
+  {0x25602730UL, 0xB81F71E5UL, 0x0546,     1},
+  {0x1D2B2756UL, 0xB83A1C45UL, 0x0184,     1},
+  {0x4787AF10UL, 0xB8D43565UL, 0x0AB9,     1},
+  {0x381FDFE4UL, 0xB979B8DFUL, 0x0FBC,     1},
+  {0xA96ED3E5UL, 0xB99120EAUL, 0x06E2,     1},
+  {0x5C5C6A74UL, 0xB997C196UL, 0x0B34,     1},
+  {0xCA1697EAUL, 0xB9A6D196UL, 0x03D6,     1},
+  {0x3C9DD4AAUL, 0xB9E67D64UL, 0x0B75,     1},
+  {0x4177ED74UL, 0xB9EE58B5UL, 0x0481,     1},
+  {0xDF4F22ECUL, 0xBC291561UL, 0x08ED,     1},
+  {0x4D76F456UL, 0xBC40CA7AUL, 0x0CA9,     1},
+  {0x93A5F207UL, 0xBC45C7A6UL, 0x0D3D,     1},
+  {0x71BB97D3UL, 0xBCC423D1UL, 0x0184,     1},
+  {0x01A7C899UL, 0xBCEE19FCUL, 0x0306,     1},
+  {0x3A506D93UL, 0xBCFD52B0UL, 0x0312,     1},
+  {0xA55D7F87UL, 0xBE4FEFC0UL, 0x0242,     1},
+  {0xEC2063ECUL, 0xBE9D9109UL, 0x06CB,     1},
+  {0xA163EEB2UL, 0xBF8E0050UL, 0x0915,     1},
+  {0x2E4D44E2UL, 0xBFDDCA21UL, 0x078E,     1},
+  {0xAEA0E6ACUL, 0xBFF41843UL, 0x0080,     1},
+  {0xEA70851FUL, 0xC00B791FUL, 0x02C3,     1},
+  {0x8F935B11UL, 0xC054AF65UL, 0x0449,     1},
+  {0xDF8C3745UL, 0xC05C5473UL, 0x02C1,     1},
+  {0x70AD4572UL, 0xC0DE8AFBUL, 0x0B75,     1},
+  {0xDF392F90UL, 0xC0F53FD5UL, 0x085A,     1},
+  {0x79E7968BUL, 0xC1069B02UL, 0x0AB2,     1},
+  {0x5F6FD5A9UL, 0xC130172AUL, 0x07D5,     1},
+  {0x5CB99DD8UL, 0xC15CB7E3UL, 0x0FBC,     1},
+  {0x9D49AFD2UL, 0xC1A8DAA4UL, 0x061B,     1},
+  {0x3137585EUL, 0xC2540C32UL, 0x09F7,     1},
+  {0xD50E51BEUL, 0xC2B8D2E5UL, 0x0723,     1},
+  {0x526E5C86UL, 0xC3269FD6UL, 0x08ED,     3},
+  {0x1D43AF10UL, 0xC3283670UL, 0x055C,     1},
+  {0x66716089UL, 0xC382AB6CUL, 0x08DA,     1},
+  {0x99066B70UL, 0xC3AD02E9UL, 0x0481,     1},
+  {0xDE509F1CUL, 0xC3C4C9EEUL, 0x0385,     1},
+  {0xE5500C19UL, 0xC3CD0F32UL, 0x07D5,     1},
+  {0xB448B0ADUL, 0xC41766ABUL, 0x0FBC,     2},
+  {0x8338583AUL, 0xC4838C74UL, 0x0546,     1},
+  {0xB4E4A628UL, 0xC4C0ABCFUL, 0x0546,     1},
+  {0xE0B2215DUL, 0xC557BFB5UL, 0x0402,     1},
+  {0x721744D8UL, 0xC58BB39AUL, 0x0489,     1},
+  {0x761C748FUL, 0xC5B1AF71UL, 0x0546,     1},
+  {0x36FD780FUL, 0xC5EAE7CEUL, 0x0546,     1},
+  {0x9079A5F5UL, 0xC6035C12UL, 0x070C,     1},
+  {0x8EAF71B5UL, 0xC6468B3AUL, 0x0449,     1},
+  {0xAA9003C6UL, 0xC6B2E972UL, 0x06D5,     1},
+  {0xC29DBC8FUL, 0xC6B4EDFAUL, 0x0105,     1},
+  {0xE46CC824UL, 0xC6F6CC68UL, 0x0305,     1},
+  {0xE2D8CCA4UL, 0xC79B43D8UL, 0x068A,     1},
+  {0x20497AD7UL, 0xC7F89EF2UL, 0x06D4,     1},
+  {0x89F33F05UL, 0xC83D1030UL, 0x0B7E,     1},
+  {0x4CF75120UL, 0xC8E77E3EUL, 0x058E,     1},
+  {0xB3B416DCUL, 0xC9ADECC8UL, 0x0305,     2},
+  {0x916A85E2UL, 0xC9F2E38FUL, 0x0408,     1},
+  {0x340C88F7UL, 0xCACE2D09UL, 0x06D4,     1},
+  {0x0F1BCF72UL, 0xCB883CE9UL, 0x068A,     1},
+  {0xA02E8F7BUL, 0xCBFB2C4BUL, 0x0408,     2},
+  {0xA02E8F7BUL, 0xCBFB2C4BUL, 0x058E,     1},
+  {0x8C8D534CUL, 0xCC1E5DA4UL, 0x08DC,     1},
+  {0xA7D8513EUL, 0xCC528456UL, 0x0975,     1},
+  {0x5B453BA9UL, 0xCCE63D80UL, 0x054D,     1},
+  {0x09AB4F31UL, 0xCCFFFC02UL, 0x0AB2,     2},
+  {0x8074F466UL, 0xCDDAA21EUL, 0x0AFD,     1},
+  {0x41C845F2UL, 0xCE05E8BEUL, 0x0AF3,     1},
+  {0xECF4CB6AUL, 0xCE29021CUL, 0x02C1,     1},
+  {0xC3201227UL, 0xCE5E49D0UL, 0x0845,     1},
+  {0xA1CAB8F1UL, 0xCF22B86EUL, 0x070C,     1},
+  {0x428CCC31UL, 0xCFE88F57UL, 0x0546,     1},
+  {0x193355B7UL, 0xD01BCE3DUL, 0x08EA,     1},
+  {0x2D2C69B8UL, 0xD0BFFA87UL, 0x08DA,     3},
+  {0x185F5FA3UL, 0xD10862F7UL, 0x0D3E,     1},
+  {0x4CCED77EUL, 0xD14464BDUL, 0x0EFD,     1},
+  {0xF296DEDBUL, 0xD174BC9EUL, 0x0724,     1},
+  {0xA4CD94A7UL, 0xD1818299UL, 0x0AB2,     1},
+  {0xA4CD94A7UL, 0xD1818299UL, 0x0B7E,     6},
+  {0xFD431141UL, 0xD1DAF37CUL, 0x0306,     1},
+  {0xA2CBE215UL, 0xD2690D35UL, 0x048A,     1},
+  {0xE0F94DE9UL, 0xD28DFAEBUL, 0x06CB,     1},
+  {0xCB72F743UL, 0xD2920B96UL, 0x072D,     1},
+  {0x719DE33CUL, 0xD2B57196UL, 0x0567,     1},
+  {0x0FCCBFB5UL, 0xD33946E3UL, 0x0B7E,     1},
+  {0xE4494708UL, 0xD34DBB7AUL, 0x048A,     2},
+  {0xE4494708UL, 0xD34DBB7AUL, 0x050C,     3},
+  {0xE4494708UL, 0xD34DBB7AUL, 0x089B,     1},
+  {0x9E978F20UL, 0xD3DB6621UL, 0x0303,     1},
+  {0xEC9E82DEUL, 0xD3F3B0ADUL, 0x089B,     1},
+  {0xB2912102UL, 0xD4BCC394UL, 0x0685,     1},
+  {0x19588AD7UL, 0xD4E2463AUL, 0x068A,     1},
+  {0x37696107UL, 0xD5C9EE68UL, 0x0184,     1},
+  {0x92B0C92BUL, 0xD5CCC840UL, 0x04A3,     1},
+  {0xA3A06B24UL, 0xD5DE9158UL, 0x0EBC,     1},
+  {0xA33D70DFUL, 0xD61D6598UL, 0x0608,     1},
+  {0x0BF69909UL, 0xD625082DUL, 0x0845,     1},
+  {0xB13E337DUL, 0xD627A546UL, 0x06E4,     1},
+  {0x7559DB2CUL, 0xD64D9C85UL, 0x0724,     1},
+  {0xE4A4F16BUL, 0xD6AE3C2CUL, 0x02C1,     1},
+  {0x3FBB7FAFUL, 0xD71D4E56UL, 0x0481,     1},
+  {0x7452C4BEUL, 0xD7E7F045UL, 0x07E6,     1},
+  {0xFA25A38BUL, 0xD86DF364UL, 0x0B7E,     1},
+  {0xF838972AUL, 0xD9EC5BD9UL, 0x0103,     1},
+  {0x86AA188DUL, 0xDA0C7CD5UL, 0x02C1,     1},
+  {0x1B3F6273UL, 0xDBAEF0CFUL, 0x0712,     1},
+  {0x120AF926UL, 0xDD6C3A9BUL, 0x0742,     1},
+  {0x00053094UL, 0xDE0A9F9EUL, 0x08F3,     1},
+  {0x2E159CA9UL, 0xDE4247F0UL, 0x0184,     1},
+  {0xDD468439UL, 0xDE48560EUL, 0x0AF3,     1},
+  {0x56C784C0UL, 0xDE9A6446UL, 0x0D3B,     1},
+  {0x33A31FB9UL, 0xDEA9EF68UL, 0x0CFA,     1},
+  {0xD23B0404UL, 0xDEFE96ABUL, 0x02C1,     1},
+  {0xDB6D38F3UL, 0xDFA69210UL, 0x0184,     1},
+  {0x51A0787BUL, 0xE005E6E9UL, 0x05CF,     1},
+  {0xA65FB6C2UL, 0xE02F69BDUL, 0x0BB6,     1},
+  {0xB054D1F8UL, 0xE0EAE0BFUL, 0x04CB,     1},
+  {0x84367E1CUL, 0xE0EFC9F2UL, 0x0184,     1},
+  {0x78132A75UL, 0xE1870F2AUL, 0x08BD,     1},
+  {0x2D09B527UL, 0xE1AC98FDUL, 0x0CFB,     1},
+  {0xE811292BUL, 0xE24421C7UL, 0x0FBC,     1},
+  {0x6E5364BEUL, 0xE2B7F0BFUL, 0x02DC,     1},
+  {0xDA8604D5UL, 0xE3832062UL, 0x0AB1,     1},
+  {0xFC58EDC3UL, 0xE3BB29F1UL, 0x0D3D,     1},
+  {0x8A374F9EUL, 0xE4C9063FUL, 0x06D5,     1},
+  {0xAA67D6E6UL, 0xE554A3EDUL, 0x067D,     1},
+  {0xAA67D6E6UL, 0xE554A3EDUL, 0x08F3,     1},
+  {0xBA18933EUL, 0xE57A2B26UL, 0x06A2,     1},
+  {0x3AA3DE96UL, 0xE6018210UL, 0x04CB,     1},
+  {0xE6361E65UL, 0xE666DC80UL, 0x0724,     1},
+  {0xD3D33184UL, 0xE6B6EDD9UL, 0x0103,     1},
+  {0xA4E870D5UL, 0xE6E74B6FUL, 0x050C,     1},
+  {0x5C2BD9E1UL, 0xE719685FUL, 0x0B3A,     1},
+  {0xDD6EDCA1UL, 0xE7933E3BUL, 0x0CFA,     1},
+  {0x4B5F874DUL, 0xE8625681UL, 0x0649,     1},
+  {0x96F6E490UL, 0xE891A457UL, 0x08F3,     3},
+  {0x1E2BB588UL, 0xE893443FUL, 0x0546,     2},
+  {0x791E7D67UL, 0xE9763726UL, 0x0AFD,     1},
+  {0xA38B6D28UL, 0xE988FDF3UL, 0x048A,     1},
+  {0x9FBD0EFBUL, 0xE9AF0817UL, 0x0871,     1},
+  {0x9FBD0EFBUL, 0xE9AF0817UL, 0x0AB2,     1},
+  {0xCB1DFC82UL, 0xEA6AD4CAUL, 0x0481,     1},
+  {0x9E2700E7UL, 0xEAA30EF8UL, 0x0AFD,     1},
+  {0x2EB0904BUL, 0xEAB09F1FUL, 0x04CB,     2},
+  {0x879477C2UL, 0xEAE8CC3AUL, 0x06E4,     1},
+  {0x255CCE12UL, 0xEB29FCBCUL, 0x050C,     3},
+  {0x255CCE12UL, 0xEB29FCBCUL, 0x058E,     3},
+  {0x255CCE12UL, 0xEB29FCBCUL, 0x068A,     1},
+  {0x69213A8DUL, 0xEB3A82ECUL, 0x092C,     1},
+  {0xA8310F06UL, 0xEB86E91DUL, 0x08ED,     1},
+  {0x484726F0UL, 0xECCD354EUL, 0x0546,     7},
+  {0x484726F0UL, 0xECCD354EUL, 0x06CB,     7},
+  {0x484726F0UL, 0xECCD354EUL, 0x074D,     1},
+  {0x1C2AEB9CUL, 0xECEC383FUL, 0x06D5,     1},
+  {0x73921683UL, 0xECF7C71DUL, 0x0546,     1},
+  {0x83CAD86DUL, 0xED554391UL, 0x0FBC,     1},
+  {0xAB7DFC31UL, 0xED6F6D73UL, 0x045B,     1},
+  {0x892BEAE1UL, 0xED7FA562UL, 0x0CF9,     1},
+  {0x8FF26CDAUL, 0xED846A2DUL, 0x070C,     1},
+  {0xA3F878DCUL, 0xEE296087UL, 0x0449,     1},
+  {0x702BBA67UL, 0xEE43E280UL, 0x0724,     1},
+  {0xD536CC92UL, 0xEE755358UL, 0x048A,     1},
+  {0x1D39660FUL, 0xEF98A462UL, 0x06CB,     1},
+  {0xEFED8F5AUL, 0xEFFEABA4UL, 0x0184,     1},
+  {0x2045C9F7UL, 0xF037C4AAUL, 0x0385,     1},
+  {0x9236D732UL, 0xF05A73DEUL, 0x0DBD,     1},
+  {0x0106E497UL, 0xF0728482UL, 0x0612,     1},
+  {0x3EF3C7A2UL, 0xF08CA5ADUL, 0x0CF9,     1},
+  {0x0C8638C1UL, 0xF09478EAUL, 0x06E2,     1},
+  {0x50C5A9D5UL, 0xF17F05C6UL, 0x0402,     1},
+  {0x5EB7ADB6UL, 0xF18547FEUL, 0x0D3D,     1},
+  {0xDBACBE04UL, 0xF1A66265UL, 0x0BA4,     1},
+  {0x9FE2DC30UL, 0xF299986DUL, 0x0449,     1},
+  {0x7DE2E8D9UL, 0xF4467B80UL, 0x055E,     1},
+  {0x28D2DEA0UL, 0xF44FE56BUL, 0x08BD,     1},
+  {0x8C170B84UL, 0xF56DF45AUL, 0x050C,     1},
+  {0xE0E97EDFUL, 0xF577C101UL, 0x0FBC,     1},
+  {0x49320155UL, 0xF61B0DFBUL, 0x07CF,     1},
+  {0x0F5FA39EUL, 0xF67F7DBEUL, 0x0742,     1},
+  {0x6578B536UL, 0xF684EDC4UL, 0x09DE,     1},
+  {0x278F8482UL, 0xF68E419BUL, 0x09C3,     1},
+  {0xC4998E74UL, 0xF6B2F9B1UL, 0x0305,     1},
+  {0xE8AE7746UL, 0xF716B8FDUL, 0x0184,     1},
+  {0x0984A897UL, 0xF71A0677UL, 0x0FBC,     1},
+  {0x69534253UL, 0xF753CF60UL, 0x05EC,     1},
+  {0x9FEDFCFAUL, 0xF77D0997UL, 0x08B2,     1},
+  {0xCD7F88B8UL, 0xF7CF1014UL, 0x0B7E,     1},
+  {0x6CC889E1UL, 0xF8C9AD74UL, 0x06D5,     1},
+  {0xE715D8AEUL, 0xF8CD4B62UL, 0x0184,     1},
+  {0x8A4DD9E1UL, 0xF97F1D97UL, 0x08F3,     1},
+  {0x19207670UL, 0xF9872CCBUL, 0x0AB2,     1},
+  {0xF589DA65UL, 0xFA38F234UL, 0x08EA,     1},
+  {0x7BF921EBUL, 0xFA43882FUL, 0x02C2,     1},
+  {0x4182BFD4UL, 0xFA97265FUL, 0x068A,     1},
+  {0x0E780EE6UL, 0xFAA08C14UL, 0x0982,     1},
+  {0xD19757C3UL, 0xFAC341DEUL, 0x0481,     1},
+  {0x0FB9F1AFUL, 0xFB34E105UL, 0x0AB9,     1},
+  {0x4C268E70UL, 0xFB3DAE23UL, 0x0546,     1},
+  {0xD75951F2UL, 0xFB9EEDFCUL, 0x095C,     1},
+  {0x2ED37B8AUL, 0xFBBCBC2DUL, 0x0649,     1},
+  {0xC5916C6BUL, 0xFC147033UL, 0x070C,     1},
+  {0x17D6C598UL, 0xFC38068DUL, 0x0312,     1},
+  {0x91020E45UL, 0xFC41D2F5UL, 0x0546,     1},
+  {0xED62AA7EUL, 0xFC7D8635UL, 0x08B2,     1},
+  {0x0F3E2B00UL, 0xFCEEF51FUL, 0x08F3,     1},
+  {0x998885DFUL, 0xFD156098UL, 0x0CBB,     1},
+  {0xD7506578UL, 0xFDA162ECUL, 0x0AB9,     1},
+  {0xE964AF58UL, 0xFDE6A7D2UL, 0x0AB9,     1},
+  {0xC767A9B7UL, 0xFE202C94UL, 0x08F3,     2},
+  {0x4FBAF8AFUL, 0xFE22CCFCUL, 0x0546,     1},
+  {0xA43F0012UL, 0xFE563165UL, 0x0D3D,     1},
+  {0xD42B3234UL, 0xFE74BB72UL, 0x070C,     1},
+  {0x85A4593EUL, 0xFF19D371UL, 0x0A62,     1},
+  {0x097F7BDEUL, 0xFF55A9A6UL, 0x02C1,     1},
+};
+const u32 CHESS_OPENING_BOOK_SIZE
+  = sizeof(CHESS_OPENING_BOOK)/sizeof(CHESS_OPENING_BOOK[0]);
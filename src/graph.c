@@ -6,6 +6,7 @@
 #include "linked_list.h"
 #include "graph.h"
 #include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #define TEST_EDGE_ADDITIONS
@@ -9,6 +9,8 @@
 #include "chess_game_frontend.h"
 #include "chess_board.h"
 #include "chess_gameloop.h"
+#include "chess_bench.h"
+#include "chess_clock.h"
 
 #define ALL_KEYS KEY_STAT_KEYS_MASK
 
@@ -39,7 +41,60 @@ static void __TESTING_FUNC_save_move_log(void) {
   ChessMoveHistory_Save(&context);    
 }
 
+#ifdef _CHESS_BENCH_BUILD_
+/* Bench results go in two columns of 15 positions under a header line, with
+ * the totals below them. Glyphs are 4x8, so a column is 30 glyphs wide. */
+#define BENCH_ROWS 15
+#define BENCH_COLUMN_WIDTH (30*SubPixel_Glyph_Width)
+
+static void Bench_Report(u32 idx,
+                         const ChessAI_MoveSearch_Result_t *move,
+                         const ChessBench_Result_t *position) {
+  const BOOL NO_MOVE = INVALID_IDX_COMPACT_RAW==move->start.raw;
+  mode3_printf((idx/BENCH_ROWS)*BENCH_COLUMN_WIDTH,
+               (1+idx%BENCH_ROWS)*SubPixel_Glyph_Height,
+               0x10A5,
+               "%2lu %c%c%c%c %7lu %5lums",
+               (unsigned long)idx+1,
+               NO_MOVE ? '0' : 'a'+move->start.coord.x,
+               NO_MOVE ? '0' : '8'-move->start.coord.y,
+               NO_MOVE ? '0' : 'a'+move->dst.coord.x,
+               NO_MOVE ? '0' : '8'-move->dst.coord.y,
+               (unsigned long)position->nodes,
+               (unsigned long)CHESS_CLOCK_TICKS_TO_MS(position->ticks));
+}
+
+static void Bench_Main(void) {
+  ChessBench_Result_t total;
+  u32 searched, ms;
+  mode3_printf(0, 0, 0x10A5, "Bench: depth %lu, %lu positions",
+               (unsigned long)CHESS_BENCH_DEPTH,
+               (unsigned long)CHESS_BENCH_POSITION_COUNT);
+  searched = ChessBench_Run(CHESS_BENCH_DEPTH, Bench_Report, &total);
+  if (CHESS_BENCH_POSITION_COUNT!=searched) {
+    mode3_printf(0, (BENCH_ROWS+2)*SubPixel_Glyph_Height, 0x10A5,
+                 "Could not set up position %lu", (unsigned long)searched+1);
+    return;
+  }
+  ms = CHESS_CLOCK_TICKS_TO_MS(total.ticks);
+  mode3_printf(0, (BENCH_ROWS+2)*SubPixel_Glyph_Height, 0x10A5,
+               "nodes %lu  time %lums  nps %lu",
+               (unsigned long)total.nodes,
+               (unsigned long)ms,
+               (unsigned long)(ms ? (u64)total.nodes*1000UL/ms
+                                  : total.nodes));
+  mode3_printf(0, (BENCH_ROWS+3)*SubPixel_Glyph_Height, 0x10A5,
+               "tt probes %lu  hits %lu (%lu%%)",
+               (unsigned long)total.tt_probes,
+               (unsigned long)total.tt_hits,
+               (unsigned long)(total.tt_probes
+                                 ? (u64)total.tt_hits*100UL/total.tt_probes
+                                 : 0));
+}
+#endif  /* _CHESS_BENCH_BUILD_ */
+
 int main(void) {
+  ChessClock_Start();
 #ifdef TEST_KNIGHT_MVMT
   ChessBG_Init();
   ChessGameCtx_Init(&context);
@@ -75,6 +130,15 @@ int main(void) {
   assert(NULL!=moving_vert);
   ChessGame_AnimateMove(&context, moving_vert, NULL);
   do SUPERVISOR_CALL(0x05); while (1);
+#elifdef _CHESS_BENCH_BUILD_
+  REG_DPY_CNT = REG_FLAG(DPY_CNT, BG2)|REG_VALUE(DPY_CNT, MODE, 3);
+  REG_IME = 0;
+  REG_DPY_STAT |= REG_FLAG(DPY_STAT, VBL_IRQ);
+  REG_ISR_MAIN = ChessGameloop_ISR_Handler;
+  REG_IE |= IRQ_FLAG(VBLANK);
+  REG_IME = 1;
+  Bench_Main();
+  do SUPERVISOR_CALL(0x05); while (1);
 #elif 0
 #include "mode3_io.h"
   REG_DPY_CNT = REG_FLAG(DPY_CNT, BG2)|REG_VALUE(DPY_CNT, MODE, 3);